@@ -51,6 +51,10 @@ gcc -o genfilter build-scripts/gen_audio_resampler_filter.c -lm && ./genfilter >
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING  (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS)
 
+/* A shorter, cheaper filter for sounds that don't need the full quality. */
+#define RESAMPLER_LOW_ZERO_CROSSINGS 3
+#define RESAMPLER_LOW_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_LOW_ZERO_CROSSINGS)
+
 /* This is a "modified" bessel function, so you can't use POSIX j0() */
 static double
 bessel(const double x)
@@ -90,21 +94,33 @@ kaiser_and_sinc(double *table, const int tablelen, const double beta)
 }
 
 static double ResamplerFilter[RESAMPLER_FILTER_SIZE];
+static double ResamplerFilterLow[RESAMPLER_LOW_FILTER_SIZE];
 
 static void
-PrepareResampleFilter(void)
+PrepareResampleFilter(double *table, const int tablelen, const double dB)
 {
     /* if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab. */
-    const double dB = 80.0;
     const double beta = 0.1102 * (dB - 8.7);
-    kaiser_and_sinc(ResamplerFilter, RESAMPLER_FILTER_SIZE, beta);
+    kaiser_and_sinc(table, tablelen, beta);
 }
 
-int main(void)
+static void
+PrintResampleFilter(const char *name, const char *size, const double *table, const int tablelen, const int zero_crossings)
 {
     int i, j;
 
-    PrepareResampleFilter();
+    printf("static const float %s[%s] = {", name, size);
+    for (i = 0; i < tablelen; i++) {
+        j = (i % zero_crossings) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING + (i / zero_crossings);
+        printf("%s%12.9ff,", (i % zero_crossings) ? "" : "\n    ", table[j]);
+    }
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
+    PrepareResampleFilter(ResamplerFilter, RESAMPLER_FILTER_SIZE, 80.0);
+    PrepareResampleFilter(ResamplerFilterLow, RESAMPLER_LOW_FILTER_SIZE, 60.0);
 
     printf(
         "/*\n"
@@ -135,15 +151,13 @@ int main(void)
         "#define RESAMPLER_BITS_PER_ZERO_CROSSING ((RESAMPLER_BITS_PER_SAMPLE / 2) + 1)\n"
         "#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)\n"
         "#define RESAMPLER_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS)\n"
-        "\n", RESAMPLER_ZERO_CROSSINGS, RESAMPLER_BITS_PER_SAMPLE
+        "#define RESAMPLER_LOW_ZERO_CROSSINGS %d\n"
+        "#define RESAMPLER_LOW_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_LOW_ZERO_CROSSINGS)\n"
+        "\n", RESAMPLER_ZERO_CROSSINGS, RESAMPLER_BITS_PER_SAMPLE, RESAMPLER_LOW_ZERO_CROSSINGS
     );
 
-    printf("static const float ResamplerFilter[RESAMPLER_FILTER_SIZE] = {");
-    for (i = 0; i < RESAMPLER_FILTER_SIZE; i++) {
-        j = (i % RESAMPLER_ZERO_CROSSINGS) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING + (i / RESAMPLER_ZERO_CROSSINGS);
-        printf("%s%12.9ff,", (i % RESAMPLER_ZERO_CROSSINGS) ? "" : "\n    ", ResamplerFilter[j]);
-    }
-    printf("\n};\n\n");
+    PrintResampleFilter("ResamplerFilter", "RESAMPLER_FILTER_SIZE", ResamplerFilter, RESAMPLER_FILTER_SIZE, RESAMPLER_ZERO_CROSSINGS);
+    PrintResampleFilter("ResamplerFilterLow", "RESAMPLER_LOW_FILTER_SIZE", ResamplerFilterLow, RESAMPLER_LOW_FILTER_SIZE, RESAMPLER_LOW_ZERO_CROSSINGS);
 
     return 0;
 }
@@ -857,17 +857,41 @@ macro(CheckPTHREAD)
         endif()
       endif()
 
+      if(SDL_FUTEX)
+        check_c_source_compiles("
+            #include <unistd.h>
+            #include <sys/syscall.h>
+            #include <linux/futex.h>
+            int main(int argc, char **argv) {
+              int word = 0;
+              syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+              syscall(SYS_futex, &word, FUTEX_LOCK_PI_PRIVATE, 0, NULL, NULL, 0);
+              return 0;
+            }" HAVE_LINUX_FUTEX)
+      endif()
+
       sdl_sources(
         "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_systhread.c"
-        "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_sysmutex.c"   # Can be faked, if necessary
-        "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_syscond.c"    # Can be faked, if necessary
         "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_sysrwlock.c"   # Can be faked, if necessary
         "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_systls.c"
       )
-      if(HAVE_PTHREADS_SEM)
-        sdl_sources("${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_syssem.c")
+      if(HAVE_LINUX_FUTEX)
+        set(SDL_THREAD_LINUX_FUTEX 1)
+        sdl_sources(
+          "${SDL3_SOURCE_DIR}/src/thread/linux/SDL_sysmutex.c"
+          "${SDL3_SOURCE_DIR}/src/thread/linux/SDL_syscond.c"
+          "${SDL3_SOURCE_DIR}/src/thread/linux/SDL_syssem.c"
+        )
       else()
-        sdl_sources("${SDL3_SOURCE_DIR}/src/thread/generic/SDL_syssem.c")
+        sdl_sources(
+          "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_sysmutex.c"   # Can be faked, if necessary
+          "${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_syscond.c"    # Can be faked, if necessary
+        )
+        if(HAVE_PTHREADS_SEM)
+          sdl_sources("${SDL3_SOURCE_DIR}/src/thread/pthread/SDL_syssem.c")
+        else()
+          sdl_sources("${SDL3_SOURCE_DIR}/src/thread/generic/SDL_syssem.c")
+        endif()
       endif()
       set(HAVE_SDL_THREADS TRUE)
     endif()
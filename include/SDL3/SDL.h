@@ -47,6 +47,7 @@
 #include <SDL3/SDL_hidapi.h>
 #include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_init.h>
+#include <SDL3/SDL_jobs.h>
 #include <SDL3/SDL_joystick.h>
 #include <SDL3/SDL_keyboard.h>
 #include <SDL3/SDL_keycode.h>
@@ -73,6 +74,7 @@
 #include <SDL3/SDL_thread.h>
 #include <SDL3/SDL_timer.h>
 #include <SDL3/SDL_touch.h>
+#include <SDL3/SDL_trace.h>
 #include <SDL3/SDL_version.h>
 #include <SDL3/SDL_video.h>
 #include "SDL3/SDL_video_capture.h"
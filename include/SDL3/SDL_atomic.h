@@ -340,6 +340,44 @@ extern DECLSPEC int SDLCALL SDL_AtomicGet(SDL_AtomicInt *a);
  */
 extern DECLSPEC int SDLCALL SDL_AtomicAdd(SDL_AtomicInt *a, int v);
 
+/**
+ * Set bits in an atomic variable.
+ *
+ * This function also acts as a full memory barrier.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicInt variable to be modified
+ * \param v the bits to set
+ * \returns the previous value of the atomic variable.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_AtomicAnd
+ */
+extern DECLSPEC int SDLCALL SDL_AtomicOr(SDL_AtomicInt *a, int v);
+
+/**
+ * Clear bits in an atomic variable.
+ *
+ * The atomic variable is set to the bitwise AND of its value and `v`, so bits
+ * that are clear in `v` are cleared. This function also acts as a full memory
+ * barrier.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicInt variable to be modified
+ * \param v the bits to keep
+ * \returns the previous value of the atomic variable.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_AtomicOr
+ */
+extern DECLSPEC int SDLCALL SDL_AtomicAnd(SDL_AtomicInt *a, int v);
+
 /**
  * Increment an atomic variable used as a reference count.
  */
@@ -409,6 +447,227 @@ extern DECLSPEC void* SDLCALL SDL_AtomicSetPtr(void **a, void* v);
  */
 extern DECLSPEC void* SDLCALL SDL_AtomicGetPtr(void **a);
 
+/**
+ * A type representing an atomic 64-bit unsigned integer value.
+ *
+ * It is a struct so people don't accidentally use numeric operations on it.
+ * On platforms without 64-bit atomic instructions the operations are done
+ * under a spinlock.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+typedef struct { Uint64 value; } __attribute__((aligned(8))) SDL_AtomicU64;
+#else
+typedef struct { Uint64 value; } SDL_AtomicU64;
+#endif
+
+/**
+ * Set an atomic 64-bit variable to a new value if it is currently an old
+ * value.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicU64 variable to be modified
+ * \param oldval the old value
+ * \param newval the new value
+ * \returns SDL_TRUE if the atomic variable was set, SDL_FALSE otherwise.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_AtomicGetU64
+ * \sa SDL_AtomicSetU64
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_AtomicCASU64(SDL_AtomicU64 *a, Uint64 oldval, Uint64 newval);
+
+/**
+ * Set an atomic 64-bit variable to a value.
+ *
+ * This function also acts as a full memory barrier.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicU64 variable to be modified
+ * \param v the desired value
+ * \returns the previous value of the atomic variable.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_AtomicGetU64
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_AtomicSetU64(SDL_AtomicU64 *a, Uint64 v);
+
+/**
+ * Get the value of an atomic 64-bit variable.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicU64 variable
+ * \returns the current value of an atomic variable.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_AtomicSetU64
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_AtomicGetU64(SDL_AtomicU64 *a);
+
+/**
+ * Add to an atomic 64-bit variable.
+ *
+ * The value wraps around on overflow. This function also acts as a full
+ * memory barrier.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicU64 variable to be modified
+ * \param v the value to add, which may be negative
+ * \returns the previous value of the atomic variable.
+ *
+ * \since This function is available since SDL 3.0.0.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_AtomicAddU64(SDL_AtomicU64 *a, Sint64 v);
+
+/**
+ * A lock-free last-in, first-out stack of pointers.
+ *
+ * Any number of threads can push and pop at the same time.
+ *
+ * \sa SDL_CreateAtomicStack
+ */
+struct SDL_AtomicStack;
+typedef struct SDL_AtomicStack SDL_AtomicStack;
+
+/**
+ * Create a lock-free stack.
+ *
+ * \returns a new stack or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAtomicStack
+ * \sa SDL_PopAtomicStack
+ * \sa SDL_PushAtomicStack
+ */
+extern DECLSPEC SDL_AtomicStack *SDLCALL SDL_CreateAtomicStack(void);
+
+/**
+ * Push a pointer onto a lock-free stack.
+ *
+ * This only allocates memory when the stack holds more items than it ever
+ * has before.
+ *
+ * \param stack the stack to push onto
+ * \param item the pointer to push, which can't be NULL
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PopAtomicStack
+ */
+extern DECLSPEC int SDLCALL SDL_PushAtomicStack(SDL_AtomicStack *stack, void *item);
+
+/**
+ * Pop the most recently pushed pointer from a lock-free stack.
+ *
+ * \param stack the stack to pop from
+ * \returns the pointer, or NULL if the stack is empty.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PushAtomicStack
+ */
+extern DECLSPEC void *SDLCALL SDL_PopAtomicStack(SDL_AtomicStack *stack);
+
+/**
+ * Destroy a lock-free stack.
+ *
+ * Nothing else may be using the stack at this point. Pointers still on the
+ * stack are dropped.
+ *
+ * \param stack the stack to destroy
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateAtomicStack
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyAtomicStack(SDL_AtomicStack *stack);
+
+/**
+ * A lock-free first-in, first-out queue of pointers.
+ *
+ * Any number of threads can push at the same time, but only one thread may
+ * pop at a time.
+ *
+ * \sa SDL_CreateAtomicQueue
+ */
+struct SDL_AtomicQueue;
+typedef struct SDL_AtomicQueue SDL_AtomicQueue;
+
+/**
+ * Create a lock-free queue with many producers and a single consumer.
+ *
+ * \returns a new queue or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAtomicQueue
+ * \sa SDL_PopAtomicQueue
+ * \sa SDL_PushAtomicQueue
+ */
+extern DECLSPEC SDL_AtomicQueue *SDLCALL SDL_CreateAtomicQueue(void);
+
+/**
+ * Add a pointer to the end of a lock-free queue.
+ *
+ * This function can be called from any thread. It only allocates memory
+ * when the queue holds more items than it ever has before.
+ *
+ * \param queue the queue to add to
+ * \param item the pointer to add, which can't be NULL
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PopAtomicQueue
+ */
+extern DECLSPEC int SDLCALL SDL_PushAtomicQueue(SDL_AtomicQueue *queue, void *item);
+
+/**
+ * Remove the pointer at the front of a lock-free queue.
+ *
+ * Only one thread may call this at a time. A pointer that is in the middle
+ * of being pushed by another thread may not be seen until that push
+ * returns.
+ *
+ * \param queue the queue to remove from
+ * \returns the pointer, or NULL if the queue is empty.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PushAtomicQueue
+ */
+extern DECLSPEC void *SDLCALL SDL_PopAtomicQueue(SDL_AtomicQueue *queue);
+
+/**
+ * Destroy a lock-free queue.
+ *
+ * Nothing else may be using the queue at this point. Pointers still in the
+ * queue are dropped.
+ *
+ * \param queue the queue to destroy
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateAtomicQueue
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyAtomicQueue(SDL_AtomicQueue *queue);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -170,6 +170,23 @@ typedef struct SDL_AudioSpec
 struct SDL_AudioStream;  /* this is opaque to the outside world. */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The quality of the filter an SDL_AudioStream uses when resampling.
+ *
+ * Higher quality levels use longer filters, which sound better but cost more
+ * CPU time per sample frame. Each level needs a few more frames of history
+ * than the one before it.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLER_LINEAR,     /**< Linear interpolation, 2 taps. Cheapest, audible aliasing. */
+    SDL_AUDIO_RESAMPLER_CUBIC,      /**< Cubic (Catmull-Rom) interpolation, 4 taps. */
+    SDL_AUDIO_RESAMPLER_SINC_LOW,   /**< Windowed sinc filter, 6 taps. */
+    SDL_AUDIO_RESAMPLER_SINC_HIGH   /**< Windowed sinc filter, 10 taps. The default. */
+} SDL_AudioResamplerQuality;
+
 
 /* Function prototypes */
 
@@ -351,6 +368,47 @@ extern DECLSPEC char *SDLCALL SDL_GetAudioDeviceName(SDL_AudioDeviceID devid);
  */
 extern DECLSPEC int SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames);
 
+/**
+ * Get the properties associated with a physical audio device.
+ *
+ * If `devid` is a logical device, this reports on the physical device it is
+ * using. You may also specify SDL_AUDIO_DEVICE_DEFAULT_OUTPUT or
+ * SDL_AUDIO_DEVICE_DEFAULT_CAPTURE here.
+ *
+ * The device thread's counters are published here, so an app can see how
+ * much headroom the audio thread has:
+ *
+ * - "SDL.audio.device.buffer_ns" (number) - how long one device buffer
+ *   plays for, in nanoseconds
+ * - "SDL.audio.device.iterations" (number) - the number of buffers the
+ *   device thread has processed since the device was opened
+ * - "SDL.audio.device.underruns" (number) - the number of output buffers in
+ *   which a bound stream had some data, but not enough to fill its share
+ * - "SDL.audio.device.iterate_ns" (number) - the total time the device
+ *   thread spent getting, mixing and submitting buffers, in nanoseconds
+ * - "SDL.audio.device.iterate_max_ns" (number) - the longest time the
+ *   device thread spent on a single buffer, in nanoseconds
+ *
+ * If the longest time a buffer took gets close to the time a buffer plays
+ * for, the device is in danger of running dry.
+ *
+ * The counters are reset when the physical device is opened. They are a
+ * snapshot taken when this function is called; call it again to refresh
+ * them.
+ *
+ * \param devid the instance ID of the device to query.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioDeviceFormat
+ * \sa SDL_GetNumberProperty
+ */
+extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid);
+
 
 /**
  * Open a specific audio device.
@@ -676,6 +734,60 @@ extern DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_AudioStre
  */
 extern DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * Create a new audio stream, with the specified properties.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER`: the SDL_AudioSpec of
+ *   the input data, copied during creation
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER`: the SDL_AudioSpec of
+ *   the output data, copied during creation
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN`: true if one thread will
+ *   put data into the stream while one other thread gets data from it, and
+ *   the two shouldn't block each other. Defaults to false.
+ *
+ * A lock-free stream lets a single producer thread call
+ * SDL_PutAudioStreamData without taking the stream's lock, so it never
+ * blocks the consumer (usually an audio device the stream is bound to), and
+ * the consumer never waits on the producer. This comes with some rules:
+ *
+ * - The source spec is required, and the input format can't be changed
+ *   later.
+ * - SDL_PutAudioStreamData fails until the stream has an output format,
+ *   either from the destination spec or from binding it to a device.
+ * - SDL_PutAudioStreamData, SDL_FlushAudioStream and SDL_ClearAudioStream
+ *   must all be called from the same (producer) thread.
+ * - Any other change to the stream, such as its output format, gain or
+ *   callbacks, still takes the stream's lock, and takes effect the next time
+ *   data is retrieved from the stream.
+ * - If a put callback is set, SDL_PutAudioStreamData takes the lock to call
+ *   it, as usual. Setting or clearing the put callback is safe while the
+ *   producer is running; a put already in progress on the producer thread
+ *   may finish without calling a callback that was set during it.
+ * - The stream can't be bound to a capture device.
+ * - SDL_PutAudioStreamDataNoCopy can't be used on the stream.
+ *
+ * Data put into a lock-free stream becomes available to the consumer as
+ * soon as SDL_PutAudioStreamData returns.
+ *
+ * \param props the properties to use
+ * \returns a new audio stream on success, or NULL on failure.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateAudioStream
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_DestroyAudioStream
+ */
+extern DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStreamWithProperties(SDL_PropertiesID props);
+
+#define SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER    "SDL.audiostream.create.src_spec"
+#define SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER    "SDL.audiostream.create.dst_spec"
+#define SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN   "SDL.audiostream.create.lock_free"
+
 /**
  * Get the properties associated with an audio stream.
  *
@@ -778,6 +890,120 @@ extern DECLSPEC float SDLCALL SDL_GetAudioStreamFrequencyRatio(SDL_AudioStream *
  */
 extern DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio);
 
+/**
+ * Get the resampler quality of an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the resampler quality of the stream, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ */
+extern DECLSPEC SDL_AudioResamplerQuality SDLCALL SDL_GetAudioStreamResamplerQuality(SDL_AudioStream *stream);
+
+/**
+ * Change the resampler quality of an audio stream.
+ *
+ * Streams that don't need the best possible quality, like background
+ * ambience or interface sounds, can use a cheaper filter to save CPU time
+ * when they are resampled. This has no effect on streams that don't need
+ * resampling.
+ *
+ * Audio streams default to SDL_AUDIO_RESAMPLER_SINC_HIGH.
+ *
+ * This can be changed at any time, and takes effect the next time data is
+ * retrieved from the stream.
+ *
+ * \param stream The stream on which the resampler quality is being changed
+ * \param quality The new resampler quality.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamResamplerQuality
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamResamplerQuality(SDL_AudioStream *stream, SDL_AudioResamplerQuality quality);
+
+/**
+ * Get the gain of an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the gain of the stream, or -1.0f on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamGain
+ */
+extern DECLSPEC float SDLCALL SDL_GetAudioStreamGain(SDL_AudioStream *stream);
+
+/**
+ * Change the gain of an audio stream.
+ *
+ * The gain of a stream is its volume; a larger gain means a louder output,
+ * with a gain of zero being silence.
+ *
+ * Audio streams default to a gain of 1.0f (no change in output).
+ *
+ * This is applied during SDL_GetAudioStreamData, and can be continuously
+ * changed to create various effects. When the stream is bound to an audio
+ * device, the gain is applied while mixing the stream into the device's
+ * output, which costs no extra pass over the data.
+ *
+ * \param stream The stream on which the gain is being changed
+ * \param gain The gain. 1.0f is no change, 0.0f is silence. Must not be
+ *             negative.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamGain
+ * \sa SDL_SetAudioStreamGainRamp
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain);
+
+/**
+ * Gradually change the gain of an audio stream.
+ *
+ * The gain moves linearly from its current value to `gain` over the next
+ * `num_frames` sample frames of output (in the stream's destination format),
+ * which is useful for fading a stream in or out without audible "zipper"
+ * noise. The ramp is applied per sample frame as data is retrieved with
+ * SDL_GetAudioStreamData, or as the stream is mixed by a bound audio device.
+ *
+ * Once the ramp completes, the stream keeps `gain` as its gain. Calling
+ * SDL_SetAudioStreamGain, or this function again, replaces any ramp in
+ * progress, starting from the stream's current gain. SDL_GetAudioStreamGain
+ * reports the gain reached so far during a ramp.
+ *
+ * \param stream The stream on which the gain is being changed
+ * \param gain The gain to end up at. Must not be negative.
+ * \param num_frames The number of output sample frames to reach `gain` over.
+ *                   Zero changes the gain immediately.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamGain
+ * \sa SDL_SetAudioStreamGain
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamGainRamp(SDL_AudioStream *stream, float gain, int num_frames);
+
 /**
  * Add data to be converted/resampled to the stream.
  *
@@ -810,6 +1036,62 @@ extern DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *st
  */
 extern DECLSPEC int SDLCALL SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * A callback that fires when an audio stream is done with data added by
+ * SDL_PutAudioStreamDataNoCopy.
+ *
+ * Once this fires, the app owns `buf` again and may free or reuse it.
+ *
+ * This callback may run on any thread, often with the stream's lock held, so
+ * it should return quickly and must not call back into the stream.
+ *
+ * \param userdata An opaque pointer provided by the app for its own use.
+ * \param buf The pointer that was passed to SDL_PutAudioStreamDataNoCopy.
+ * \param buflen The length that was passed to SDL_PutAudioStreamDataNoCopy.
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+typedef void (SDLCALL *SDL_AudioStreamDataCompleteCallback)(void *userdata, const void *buf, int buflen);
+
+/**
+ * Add data to the stream without copying it.
+ *
+ * This works like SDL_PutAudioStreamData, but the stream reads straight from
+ * `buf` instead of copying it into its own buffers first. This saves a copy
+ * (and an allocation) for apps that already have large, unchanging buffers of
+ * audio, such as decoded sound effects or the output of a streaming decoder.
+ *
+ * `buf` must stay valid, and must not be changed, until `callback` fires.
+ * That happens once the stream has consumed all of the data, or when it is
+ * cleared or destroyed. If this function fails, `callback` is not called and
+ * the app still owns `buf`.
+ *
+ * This can't be used with a stream created with the
+ * `SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN` property.
+ *
+ * \param stream The stream the audio data is being added to
+ * \param buf A pointer to the audio data to add
+ * \param len The number of bytes to add to the stream
+ * \param callback A callback that fires once the stream no longer needs
+ *                 `buf`. Can be NULL.
+ * \param userdata App-controlled pointer passed to callback. Can be NULL.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if the
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_ClearAudioStream
+ * \sa SDL_DestroyAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
+
 /**
  * Get converted/resampled data from the stream.
  *
@@ -886,6 +1168,11 @@ extern DECLSPEC int SDLCALL SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
  * SDL_GetAudioStreamData, so this value should be representative of the exact
  * data that was put into the stream.
  *
+ * The exception is a stream bound to a capture device: the device converts
+ * recorded data to the stream's output format (or to SDL_AUDIO_F32, if the
+ * stream has to resample it) before queueing it, so the count is in that
+ * format instead of the device's.
+ *
  * If the stream has so much data that it would overflow an int, the return
  * value is clamped to a maximum value, but no queued data is lost; if there
  * are gigabytes of data queued, the app might need to read some of it with
@@ -1102,6 +1389,16 @@ extern DECLSPEC int SDLCALL SDL_SetAudioStreamGetCallback(SDL_AudioStream *strea
  *
  * Clearing or flushing an audio stream does not call this callback.
  *
+ * For a stream bound to a capture device, the callback usually runs on the
+ * device's thread as each buffer of audio is recorded. But the device thread
+ * never waits for the stream's lock: if another thread is using the stream
+ * at that moment, the new data is handed over later, by whichever thread
+ * next takes the stream's lock, and the callback runs on that thread. So the
+ * callback may run from inside SDL_GetAudioStreamData,
+ * SDL_GetAudioStreamAvailable, SDL_GetAudioStreamQueued,
+ * SDL_PutAudioStreamData and similar calls on your own threads, as well as
+ * on the device thread.
+ *
  * This function obtains the stream's lock, which means any existing callback
  * (get or put) in progress will finish running before setting the new
  * callback.
@@ -1388,6 +1685,66 @@ extern DECLSPEC int SDLCALL SDL_LoadWAV_RW(SDL_RWops * src, SDL_bool freesrc,
 extern DECLSPEC int SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec * spec,
                                         Uint8 ** audio_buf, Uint32 * audio_len);
 
+/**
+ * Open a WAVE file as an audio stream that decodes it as it plays.
+ *
+ * Unlike SDL_LoadWAV_RW, this doesn't decode the whole file up front. The
+ * header is read right away, but the audio data is only read from `src` and
+ * decoded, a block at a time, as the stream needs it. Memory use stays at a
+ * few blocks no matter how long the file is, which makes this a better fit
+ * for music and other long sounds.
+ *
+ * The returned stream's input format is the WAVE data's format, which is
+ * also reported in `spec`. Its output format starts out the same; change it
+ * with SDL_SetAudioStreamFormat or by binding the stream to a device. Once
+ * all the data has been decoded, the stream is flushed.
+ *
+ * The stream uses its get callback to pull data from the file, so don't
+ * replace it with SDL_SetAudioStreamGetCallback. `src` must stay open until
+ * the stream is destroyed, and must not be used by anything else meanwhile.
+ *
+ * \param src The data source for the WAVE data
+ * \param freesrc If SDL_TRUE, `src` is closed when the stream is destroyed,
+ *                or right away if this function fails
+ * \param spec A pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return.
+ * \param sample_frames A pointer filled with the number of sample frames in
+ *                      the file. Can be NULL.
+ * \returns a new audio stream on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SeekWAVStream
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_RW
+ */
+extern DECLSPEC SDL_AudioStream *SDLCALL SDL_LoadWAVStream_RW(SDL_RWops *src, SDL_bool freesrc, SDL_AudioSpec *spec, Sint64 *sample_frames);
+
+/**
+ * Move the read position of a stream created by SDL_LoadWAVStream_RW.
+ *
+ * Anything still queued in the stream is thrown away (as if by
+ * SDL_ClearAudioStream), and decoding starts again at sample frame `frame`.
+ * Seeking to the end of the file (or past it) leaves the stream flushed and
+ * empty.
+ *
+ * \param stream A stream created by SDL_LoadWAVStream_RW
+ * \param frame The sample frame to play next, counting from the start of
+ *              the file
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_LoadWAVStream_RW
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame);
+
 
 
 #define SDL_MIX_MAXVOLUME 128
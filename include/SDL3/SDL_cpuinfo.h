@@ -54,6 +54,63 @@ extern "C" {
  */
 extern DECLSPEC int SDLCALL SDL_GetCPUCount(void);
 
+/**
+ * The kind of core a logical CPU belongs to, on CPUs that mix core types.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetCPUTopology
+ */
+typedef enum
+{
+    SDL_CPU_CORE_UNKNOWN,       /**< All cores are alike, or the type couldn't be determined */
+    SDL_CPU_CORE_PERFORMANCE,   /**< A fast core, like an Intel P-core or an ARM "big" core */
+    SDL_CPU_CORE_EFFICIENCY     /**< A low power core, like an Intel E-core or an ARM "LITTLE" core */
+} SDL_CPUCoreType;
+
+/**
+ * Information about a logical CPU.
+ *
+ * Logical CPUs that share a physical core or a cache have the same value in
+ * the matching field, which is the number of the lowest logical CPU sharing
+ * it, or -1 if that isn't known.
+ *
+ * \since This struct is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetCPUTopology
+ */
+typedef struct SDL_CPUInfo
+{
+    int cpu;                /**< the logical CPU number, as used by SDL_SetThreadAffinity() */
+    int core;               /**< the physical core, shared by hyperthreads */
+    int package;            /**< the physical package (socket) number, or -1 if unknown */
+    int l2_group;           /**< the L2 cache this CPU uses */
+    int l3_group;           /**< the L3 cache this CPU uses */
+    SDL_CPUCoreType type;   /**< the kind of core */
+} SDL_CPUInfo;
+
+/**
+ * Get the layout of the logical CPUs in the system.
+ *
+ * This can be used to spread threads over physical cores, to keep threads
+ * that share data on CPUs that share a cache, or to keep background work on
+ * efficiency cores.
+ *
+ * On platforms where SDL can't query the topology, each logical CPU is
+ * reported as its own core, with unknown caches and core type.
+ *
+ * \param count a pointer filled in with the number of logical CPUs returned
+ * \returns an array of logical CPU information, ordered by CPU number, which
+ *          should be freed with SDL_free(), or NULL on error; call
+ *          SDL_GetError() for more details.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetCPUCount
+ * \sa SDL_SetThreadAffinity
+ */
+extern DECLSPEC SDL_CPUInfo *SDLCALL SDL_GetCPUTopology(int *count);
+
 /**
  * Determine the L1 cache line size of the CPU.
  *
@@ -35,6 +35,7 @@
 #include <SDL3/SDL_keyboard.h>
 #include <SDL3/SDL_mouse.h>
 #include <SDL3/SDL_pen.h>
+#include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_quit.h>
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_touch.h>
@@ -898,6 +899,70 @@ extern DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_PollEvent(SDL_Event *event);
 
+/**
+ * Categories of events, used to choose which events SDL_PollEventBatch()
+ * returns.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ *
+ * \sa SDL_PollEventBatch
+ */
+typedef enum
+{
+    SDL_EVENTCATEGORY_APPLICATION = 0x00000001, /**< application, clipboard, drag and drop and render events */
+    SDL_EVENTCATEGORY_WINDOW      = 0x00000002, /**< display and window events */
+    SDL_EVENTCATEGORY_INPUT       = 0x00000004, /**< keyboard, mouse, joystick, gamepad, touch, sensor and pen input */
+    SDL_EVENTCATEGORY_DEVICE      = 0x00000008, /**< joystick, gamepad and audio devices being added, removed or changed */
+    SDL_EVENTCATEGORY_USER        = 0x00000010, /**< events from ::SDL_EVENT_USER through ::SDL_EVENT_LAST */
+    SDL_EVENTCATEGORY_ALL         = 0xFFFFFFFF
+} SDL_EventCategory;
+
+/**
+ * Poll for currently pending events, taking many of them at once.
+ *
+ * This works like calling SDL_PollEvent() until it returns SDL_FALSE, but
+ * takes up to `numevents` events from the queue in one call. Only events in
+ * the given categories are returned, the others stay in the queue.
+ *
+ * If `group_by_type` is SDL_TRUE, the events are returned sorted by type, so
+ * all the events of one type are next to each other and can be handled
+ * together. Events of the same type stay in the order they were queued, but
+ * the order between events of different types is lost.
+ *
+ * A return value less than `numevents` means every pending event in the
+ * categories has been returned:
+ *
+ * ```c
+ * SDL_Event events[256];
+ * int i, j, count;
+ * do {
+ *     count = SDL_PollEventBatch(events, SDL_arraysize(events), SDL_EVENTCATEGORY_ALL, SDL_TRUE);
+ *     for (i = 0; i < count; i = j) {
+ *         for (j = i + 1; j < count && events[j].type == events[i].type; ++j) {
+ *         }
+ *         // handle the (j - i) events of type events[i].type, starting at events[i]
+ *     }
+ * } while (count == SDL_arraysize(events));
+ * ```
+ *
+ * As this function may implicitly call SDL_PumpEvents(), you can only call
+ * this function in the thread that set the video mode.
+ *
+ * \param events an array of at least `numevents` SDL_Event structures to fill
+ * \param numevents the most events to return
+ * \param categories a mask of SDL_EventCategory values for the events to
+ *                   return
+ * \param group_by_type SDL_TRUE to sort the events by type
+ * \returns the number of events returned, or a negative error code on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PollEvent
+ * \sa SDL_PeepEvents
+ */
+extern DECLSPEC int SDLCALL SDL_PollEventBatch(SDL_Event *events, int numevents, Uint32 categories, SDL_bool group_by_type);
+
 /**
  * Wait indefinitely for the next available event.
  *
@@ -961,9 +1026,15 @@ extern DECLSPEC SDL_bool SDLCALL SDL_WaitEventTimeout(SDL_Event *event, Sint32 t
  * of the device within SDL.
  *
  * This function is thread-safe, and can be called from other threads safely.
+ * If another thread is using the event queue, the event is handed off
+ * without waiting for it, and is added to the queue the next time the queue
+ * is read. As long as no event filter or event watcher is set, this means
+ * threads pushing events never wait for the thread reading them. Events
+ * pushed from one thread are always added in the order they were pushed.
  *
  * Note: Events pushed onto the queue with SDL_PushEvent() get passed through
- * the event filter but events added with SDL_PeepEvents() do not.
+ * the event filter but events added with SDL_PeepEvents() do not. The filter
+ * and event watchers are called on the thread pushing the event.
  *
  * For pushing application-specific events, please use SDL_RegisterEvents() to
  * get an event type that does not conflict with other code that also wants
@@ -1178,6 +1249,60 @@ extern DECLSPEC Uint32 SDLCALL SDL_RegisterEvents(int numevents);
  */
 extern DECLSPEC void * SDLCALL SDL_AllocateEventMemory(size_t size);
 
+/**
+ * Get the properties associated with the event queue.
+ *
+ * The event queue keeps counters that can show where time goes between an
+ * event happening and the app handling it:
+ *
+ * - "SDL.events.queued" (number) - the number of events in the queue now
+ * - "SDL.events.max_queued" (number) - the most events that have been in
+ *   the queue at once
+ * - "SDL.events.pushed" (number) - the number of events added to the queue
+ * - "SDL.events.pushed.N" (number) - the number of events of type N added to
+ *   the queue, where N is the event type in decimal; only present for types
+ *   that have been added
+ * - "SDL.events.coalesced" (number) - the number of motion events merged
+ *   into an event already in the queue, see SDL_HINT_EVENT_COALESCE_MOTION
+ * - "SDL.events.dropped" (number) - the number of events lost because the
+ *   queue was full
+ * - "SDL.events.latency_under_250us", "SDL.events.latency_under_1ms",
+ *   "SDL.events.latency_under_4ms", "SDL.events.latency_under_16ms",
+ *   "SDL.events.latency_under_64ms" and "SDL.events.latency_over_64ms"
+ *   (number) - a histogram of how long events had been waiting, measured
+ *   from their timestamp to when they were taken from the queue
+ * - "SDL.events.latency_max_ns" (number) - the longest time an event had
+ *   been waiting, in nanoseconds
+ * - "SDL.events.pumps" (number) - the number of times events were pumped
+ * - "SDL.events.pump_ns" (number) - the total time spent pumping events, in
+ *   nanoseconds
+ * - "SDL.events.pump_max_ns" (number) - the longest time spent pumping
+ *   events once, in nanoseconds
+ * - "SDL.events.pump_video_ns", "SDL.events.pump_audio_ns",
+ *   "SDL.events.pump_sensor_ns" and "SDL.events.pump_joystick_ns" (number) -
+ *   the part of the pumping time spent in each subsystem, in nanoseconds
+ * - "SDL.events.watcher_ns" (number) - the total time spent in the event
+ *   filter and event watchers, in nanoseconds
+ *
+ * A high latency with short pump times means events are waiting for the app
+ * to poll them, while long pump times point at the OS or a subsystem.
+ *
+ * The counters are reset when the event subsystem is shut down. They are a
+ * snapshot taken when this function is called; call it again to refresh
+ * them.
+ *
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetNumberProperty
+ * \sa SDL_EnumerateProperties
+ */
+extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetEventQueueProperties(void);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -409,6 +409,22 @@ extern "C" {
  */
 #define SDL_HINT_ENABLE_SCREEN_KEYBOARD "SDL_ENABLE_SCREEN_KEYBOARD"
 
+/**
+ *  A variable controlling whether motion events are merged as they are queued.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Every motion event is queued separately (default)
+ *    "1"       - A motion event is merged into the newest queued event, if that is motion from the same device and window
+ *
+ *  This applies to SDL_EVENT_MOUSE_MOTION, SDL_EVENT_FINGER_MOTION and SDL_EVENT_PEN_MOTION.
+ *  A merged event has the position and timestamp of the newest motion and the sum of the relative
+ *  motion. Mouse and pen motion with a different button state is not merged. With high frequency
+ *  mice this can greatly reduce the number of events that need to be handled each frame.
+ *
+ *  This hint can be toggled on and off at runtime.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION "SDL_EVENT_COALESCE_MOTION"
+
 /**
  *  A variable controlling verbosity of the logging of SDL events pushed onto the internal queue.
  *
@@ -1238,6 +1254,21 @@ extern "C" {
  */
 #define SDL_HINT_MOUSE_AUTO_CAPTURE    "SDL_MOUSE_AUTO_CAPTURE"
 
+/**
+ *  A variable controlling how many times a thread retries locking a busy mutex before sleeping.
+ *
+ *  Retrying for a short while avoids putting the thread to sleep when the
+ *  mutex is only held for a moment, which is the common case. Higher values
+ *  make threads spin longer, burning CPU time while they wait.
+ *
+ *  This variable is read when a mutex or semaphore is created, and can be set
+ *  to a number of retries, or "0" to sleep right away. The default is "100",
+ *  or "0" on single core systems.
+ *
+ *  This hint is currently only used by the Linux futex implementation.
+ */
+#define SDL_HINT_MUTEX_SPIN_COUNT    "SDL_MUTEX_SPIN_COUNT"
+
 /**
  *  Treat pen movement as separate from mouse movement
  *
@@ -1542,6 +1573,38 @@ extern "C" {
  */
 #define SDL_HINT_SCREENSAVER_INHIBIT_ACTIVITY_NAME "SDL_SCREENSAVER_INHIBIT_ACTIVITY_NAME"
 
+/**
+ *  A variable setting the logical CPUs SDL's audio threads may run on.
+ *
+ *  This applies to the threads that feed audio devices and the threads that
+ *  help them mix. The value is a list of CPU numbers and ranges, like "2,3"
+ *  or "0-3,8". SDL_GetCPUTopology() describes what the numbers refer to.
+ *
+ *  By default, audio threads may run on any CPU. This hint is checked when
+ *  each thread starts.
+ */
+#define SDL_HINT_THREAD_AFFINITY_AUDIO "SDL_THREAD_AFFINITY_AUDIO"
+
+/**
+ *  A variable setting the logical CPUs SDL's timer thread may run on.
+ *
+ *  The value is a list of CPU numbers and ranges, like "2,3" or "0-3,8".
+ *
+ *  By default, the timer thread may run on any CPU. This hint is checked
+ *  when the timer thread starts.
+ */
+#define SDL_HINT_THREAD_AFFINITY_TIMER "SDL_THREAD_AFFINITY_TIMER"
+
+/**
+ *  A variable setting the logical CPUs SDL's video capture threads may run on.
+ *
+ *  The value is a list of CPU numbers and ranges, like "2,3" or "0-3,8".
+ *
+ *  By default, video capture threads may run on any CPU. This hint is
+ *  checked when each thread starts.
+ */
+#define SDL_HINT_THREAD_AFFINITY_VIDEO_CAPTURE "SDL_THREAD_AFFINITY_VIDEO_CAPTURE"
+
 /**
  *  Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as realtime.
  *
@@ -1608,6 +1671,18 @@ extern "C" {
  */
 #define SDL_HINT_TIMER_RESOLUTION "SDL_TIMER_RESOLUTION"
 
+/**
+ *  A variable controlling whether SDL records a trace of where it spends its time.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Don't record a trace (default)
+ *    "1"       - Record a trace, that can be saved with SDL_SaveTrace_RW()
+ *
+ *  Enabling this hint starts a new trace, dropping anything recorded before.
+ *  This hint may be set at any time.
+ */
+#define SDL_HINT_TRACE "SDL_TRACE"
+
 /**
  *  A variable controlling whether touch events should generate synthetic mouse events
  *
@@ -2481,6 +2556,37 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES "SDL_AUDIO_DEVICE_SAMPLE_FRAMES"
 
+/**
+ * Set the number of extra threads used to mix an output device's streams.
+ *
+ * This hint is an integer >= 0. When it is greater than zero, each opened
+ * playback device gets that many worker threads, which convert and resample
+ * the device's bound audio streams in parallel with the device thread. The
+ * results are still summed in binding order, so the output is the same as
+ * mixing on a single thread.
+ *
+ * Streams with a get callback (see SDL_SetAudioStreamGetCallback) are still
+ * processed on the device thread, so their callbacks are called from the
+ * same thread, with the same locks held, as without this hint. Only streams
+ * without callbacks are handed to the worker threads.
+ *
+ * This defaults to 0 (mix everything on the device thread). It is checked
+ * when opening an audio device and can be changed between calls.
+ */
+#define SDL_HINT_AUDIO_MIX_THREADS "SDL_AUDIO_MIX_THREADS"
+
+/**
+ * Set the fewest bound streams a device needs before it mixes in parallel.
+ *
+ * This hint is an integer > 0. Waking the worker threads from
+ * SDL_HINT_AUDIO_MIX_THREADS costs more than it saves when only a few
+ * streams are bound, so below this count the device thread mixes alone.
+ *
+ * This defaults to 32. It is checked when opening an audio device and can
+ * be changed between calls.
+ */
+#define SDL_HINT_AUDIO_MIX_THREADS_MIN_STREAMS "SDL_AUDIO_MIX_THREADS_MIN_STREAMS"
+
 
 /**
  * Request SDL_AppIterate() be called at a specific rate.
@@ -0,0 +1,229 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_jobs_h_
+#define SDL_jobs_h_
+
+/**
+ *  \file SDL_jobs.h
+ *
+ *  Functions to run short pieces of work on a pool of threads.
+ */
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A pool of worker threads that run jobs.
+ *
+ * Each worker keeps its own queue of jobs. Jobs submitted by a job run on
+ * the same worker, and idle workers take jobs from the others, so work
+ * spreads out without the workers fighting over one queue.
+ *
+ * \sa SDL_CreateJobPool
+ */
+struct SDL_JobPool;
+typedef struct SDL_JobPool SDL_JobPool;
+
+/**
+ * A set of jobs that can be waited on together.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+struct SDL_JobGroup;
+typedef struct SDL_JobGroup SDL_JobGroup;
+
+/**
+ * The function called to run a job.
+ *
+ * \param userdata what was passed as `userdata` to SDL_SubmitJob()
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobFunction)(void *userdata);
+
+/**
+ * The function called to handle part of a range in SDL_ParallelFor().
+ *
+ * \param userdata what was passed as `userdata` to SDL_ParallelFor()
+ * \param start the first index to handle
+ * \param end one past the last index to handle
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_ParallelFor
+ */
+typedef void (SDLCALL *SDL_ParallelForFunction)(void *userdata, int start, int end);
+
+/**
+ * Create a pool of worker threads.
+ *
+ * Threads waiting for jobs with SDL_WaitJobGroup() or SDL_ParallelFor() run
+ * jobs too, so the default is one worker less than the number of CPU cores.
+ *
+ * \param num_threads the number of worker threads, or 0 to pick one based on
+ *                    SDL_GetCPUCount()
+ * \returns a new job pool or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyJobPool
+ * \sa SDL_SubmitJob
+ */
+extern DECLSPEC SDL_JobPool *SDLCALL SDL_CreateJobPool(int num_threads);
+
+/**
+ * Get the number of worker threads in a job pool.
+ *
+ * \param pool the job pool to query
+ * \returns the number of worker threads, or a negative error code on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+extern DECLSPEC int SDLCALL SDL_GetJobPoolThreadCount(SDL_JobPool *pool);
+
+/**
+ * Destroy a job pool.
+ *
+ * This waits for every job submitted to the pool to finish, then stops the
+ * worker threads. Job groups created for the pool must be destroyed first.
+ *
+ * \param pool the job pool to destroy
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyJobPool(SDL_JobPool *pool);
+
+/**
+ * Create a group of jobs that can be waited on together.
+ *
+ * A group can be reused: once SDL_WaitJobGroup() returns, more jobs can be
+ * submitted to it.
+ *
+ * \param pool the job pool that will run the jobs
+ * \returns a new job group or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyJobGroup
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobGroup
+ */
+extern DECLSPEC SDL_JobGroup *SDLCALL SDL_CreateJobGroup(SDL_JobPool *pool);
+
+/**
+ * Destroy a job group.
+ *
+ * This waits for the jobs in the group to finish first.
+ *
+ * \param group the job group to destroy
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyJobGroup(SDL_JobGroup *group);
+
+/**
+ * Submit a job to run on a job pool.
+ *
+ * Jobs submitted from one of the pool's jobs usually run on the same worker
+ * thread, most recent first, unless an idle worker takes them. Jobs
+ * submitted from other threads run roughly in the order they were submitted.
+ * Jobs shouldn't wait on anything other than job groups, as that would hold
+ * up a worker thread.
+ *
+ * This function is thread-safe, and can be called from other threads and
+ * from jobs.
+ *
+ * \param pool the job pool to run the job
+ * \param group the job group the job belongs to, or NULL if nothing is
+ *              going to wait for it
+ * \param function the function to call
+ * \param userdata a pointer that is passed to `function`
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_WaitJobGroup
+ */
+extern DECLSPEC int SDLCALL SDL_SubmitJob(SDL_JobPool *pool, SDL_JobGroup *group, SDL_JobFunction function, void *userdata);
+
+/**
+ * Wait for all the jobs in a group to finish.
+ *
+ * The calling thread runs jobs from the pool while it waits, so waiting from
+ * a job doesn't tie up a worker thread.
+ *
+ * \param group the job group to wait for
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern DECLSPEC void SDLCALL SDL_WaitJobGroup(SDL_JobGroup *group);
+
+/**
+ * Call a function on every part of a range of indices, spread over a job
+ * pool.
+ *
+ * The range from `start` up to (but not including) `end` is split into
+ * parts of `grain` indices, and `function` is called once for each part.
+ * The calling thread handles parts too, and this function returns once all
+ * of them are done.
+ *
+ * \param pool the job pool to use
+ * \param start the first index
+ * \param end one past the last index
+ * \param grain the number of indices in each part, or 0 to pick one based on
+ *              the number of worker threads
+ * \param function the function to call for each part
+ * \param userdata a pointer that is passed to `function`
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ */
+extern DECLSPEC int SDLCALL SDL_ParallelFor(SDL_JobPool *pool, int start, int end, int grain, SDL_ParallelForFunction function, void *userdata);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_jobs_h_ */
@@ -30,6 +30,7 @@
 
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_error.h>
+#include <SDL3/SDL_properties.h>
 
 /******************************************************************************/
 /* Enable thread safety attributes only with clang.
@@ -153,6 +154,33 @@ typedef struct SDL_Mutex SDL_Mutex;
  */
 extern DECLSPEC SDL_Mutex *SDLCALL SDL_CreateMutex(void);
 
+/**
+ * Create a new mutex with the specified properties.
+ *
+ * These are the supported properties:
+ *
+ * - "SDL.mutex.spin_count" (number) - the number of times to retry locking
+ *   a mutex that is held by another thread before going to sleep. Defaults
+ *   to the value of SDL_HINT_MUTEX_SPIN_COUNT.
+ * - "SDL.mutex.priority_inheritance" (boolean) - true if a thread holding
+ *   the mutex should be boosted to the priority of the highest priority
+ *   thread waiting for it. This is useful for locks shared with realtime
+ *   threads, like audio threads. Defaults to false.
+ *
+ * Platforms that don't support these properties ignore them, and create a
+ * mutex as if SDL_CreateMutex() was called.
+ *
+ * \param props the properties to use
+ * \returns the initialized and unlocked mutex or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateMutex
+ * \sa SDL_GetMutexProperties
+ */
+extern DECLSPEC SDL_Mutex *SDLCALL SDL_CreateMutexWithProperties(SDL_PropertiesID props);
+
 /**
  * Lock the mutex.
  *
@@ -236,6 +264,30 @@ extern DECLSPEC void SDLCALL SDL_UnlockMutex(SDL_Mutex *mutex) SDL_RELEASE(mutex
  */
 extern DECLSPEC void SDLCALL SDL_DestroyMutex(SDL_Mutex *mutex);
 
+/**
+ * Get the properties associated with a mutex.
+ *
+ * These counters are updated each time this function is called, and can be
+ * used to find locks that threads spend time waiting on:
+ *
+ * - "SDL.mutex.locks" (number) - the number of times the mutex was locked,
+ *   not counting recursive locks
+ * - "SDL.mutex.contentions" (number) - the number of times the mutex was
+ *   held by another thread when it was locked
+ * - "SDL.mutex.sleeps" (number) - the number of times a thread went to
+ *   sleep waiting for the mutex
+ *
+ * \param mutex the mutex to query
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information. This fails on platforms
+ *          that don't keep these counters.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetProperty
+ */
+extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetMutexProperties(SDL_Mutex *mutex);
+
 /* @} *//* Mutex functions */
 
 
@@ -627,6 +679,27 @@ extern DECLSPEC int SDLCALL SDL_PostSemaphore(SDL_Semaphore *sem);
  */
 extern DECLSPEC Uint32 SDLCALL SDL_GetSemaphoreValue(SDL_Semaphore *sem);
 
+/**
+ * Get the properties associated with a semaphore.
+ *
+ * These counters are updated each time this function is called:
+ *
+ * - "SDL.semaphore.contentions" (number) - the number of waits that found
+ *   the semaphore at zero
+ * - "SDL.semaphore.sleeps" (number) - the number of times a thread went to
+ *   sleep waiting for the semaphore
+ *
+ * \param sem the semaphore to query
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information. This fails on platforms
+ *          that don't keep these counters.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetProperty
+ */
+extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSemaphoreProperties(SDL_Semaphore *sem);
+
 /* @} *//* Semaphore functions */
 
 
@@ -307,6 +307,35 @@ extern DECLSPEC SDL_threadID SDLCALL SDL_GetThreadID(SDL_Thread * thread);
  */
 extern DECLSPEC int SDLCALL SDL_SetThreadPriority(SDL_ThreadPriority priority);
 
+/**
+ * Set the logical CPUs the current thread is allowed to run on.
+ *
+ * Pinning a thread keeps its data in the caches of the cores it runs on, and
+ * keeps it off cores that are reserved for other work. Use
+ * SDL_GetCPUTopology() to find out which logical CPUs share cores and
+ * caches.
+ *
+ * Passing no CPUs lifts the restriction, putting the thread back on the CPUs
+ * the process was allowed to run on when it started, such as those chosen
+ * by the program that launched it.
+ *
+ * Some platforms will not let you change the affinity of a thread at all, or
+ * only allow a subset of the CPUs, so be prepared for this to fail.
+ *
+ * \param cpus an array of logical CPU numbers, or NULL to lift the
+ *             restriction
+ * \param num_cpus the number of elements in `cpus`, or 0 to lift the
+ *                 restriction
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_SetThreadPriority
+ */
+extern DECLSPEC int SDLCALL SDL_SetThreadAffinity(const int *cpus, int num_cpus);
+
 /**
  * Wait for a thread to finish.
  *
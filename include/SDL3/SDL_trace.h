@@ -0,0 +1,88 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+/**
+ *  \file SDL_trace.h
+ *
+ *  Functions to save a trace of where SDL spends its time.
+ *
+ *  When SDL_HINT_TRACE is enabled, SDL records when each thread enters and
+ *  leaves its expensive operations, like flushing render commands, pumping
+ *  events, mixing audio, blitting and converting YUV data. The trace can
+ *  be saved in the Chrome trace event format, and opened in Perfetto
+ *  (https://ui.perfetto.dev) or chrome://tracing to see what happened
+ *  during a late frame.
+ *
+ *  Each thread keeps its most recent events in a fixed size ring buffer, so
+ *  a trace covers the last few seconds before it was saved.
+ */
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_rwops.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Save the trace recorded since SDL_HINT_TRACE was last enabled.
+ *
+ * The trace is written as Chrome trace event JSON. Recording can continue
+ * while the trace is saved, and saving doesn't clear it.
+ *
+ * \param dst the data stream to write the trace to
+ * \param freedst if SDL_TRUE, calls SDL_RWclose() on `dst` before returning,
+ *                even in the case of an error
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SaveTrace
+ */
+extern DECLSPEC int SDLCALL SDL_SaveTrace_RW(SDL_RWops *dst, SDL_bool freedst);
+
+/**
+ * Save the trace recorded since SDL_HINT_TRACE was last enabled to a file.
+ *
+ * \param file the file to write the trace to
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SaveTrace_RW
+ */
+extern DECLSPEC int SDLCALL SDL_SaveTrace(const char *file);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_trace_h_ */
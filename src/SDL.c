@@ -39,6 +39,7 @@
 #include "SDL_assert_c.h"
 #include "SDL_log_c.h"
 #include "SDL_properties_c.h"
+#include "SDL_trace_c.h"
 #include "audio/SDL_sysaudio.h"
 #include "video/SDL_video_c.h"
 #include "events/SDL_events_c.h"
@@ -206,6 +207,8 @@ int SDL_InitSubSystem(Uint32 flags)
     SDL_InitTicks();
 #endif
 
+    SDL_InitTrace();
+
     /* Initialize the event subsystem */
     if (flags & SDL_INIT_EVENTS) {
 #ifndef SDL_EVENTS_DISABLED
@@ -513,6 +516,8 @@ void SDL_Quit(void)
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
+    SDL_QuitTrace();
+
 #ifndef SDL_TIMERS_DISABLED
     SDL_QuitTicks();
 #endif
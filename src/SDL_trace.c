@@ -0,0 +1,275 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_hints_c.h"
+#include "SDL_trace_c.h"
+
+/* Each thread records into its own ring buffer, so recording never takes a
+   lock. The owning thread is the only writer: it fills in the next event and
+   then publishes it by advancing head. Readers copy the buffer, then throw
+   away anything the writer may have overwritten while they were copying. */
+
+#define SDL_TRACE_BUFFER_SIZE 16384 /* events per thread, must be a power of two */
+#define SDL_TRACE_MAX_DEPTH   64
+
+typedef struct SDL_TraceEvent
+{
+    const char *name; /* NULL for the end of a zone */
+    Uint64 timestamp;
+} SDL_TraceEvent;
+
+typedef struct SDL_TraceBuffer
+{
+    SDL_AtomicU64 head; /* the number of events ever recorded */
+    SDL_threadID thread;
+    struct SDL_TraceBuffer *next;
+    SDL_TraceEvent events[SDL_TRACE_BUFFER_SIZE];
+} SDL_TraceBuffer;
+
+SDL_bool SDL_trace_enabled;
+static Uint64 SDL_trace_start;
+static SDL_TLSID SDL_trace_tls;
+static SDL_SpinLock SDL_trace_lock;
+static SDL_TraceBuffer *SDL_trace_buffers;
+
+static void SDLCALL SDL_TraceChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    const SDL_bool enabled = SDL_GetStringBoolean(hint, SDL_FALSE);
+
+    /* Events from before this are left in the buffers, but not saved */
+    if (enabled && !SDL_trace_enabled) {
+        SDL_trace_start = SDL_GetTicksNS();
+    }
+    SDL_trace_enabled = enabled;
+}
+
+void SDL_InitTrace(void)
+{
+    if (SDL_trace_tls) {
+        return;
+    }
+
+    /* A new TLS slot, so threads don't find buffers freed by an earlier SDL_QuitTrace() */
+    SDL_trace_tls = SDL_CreateTLS();
+    SDL_AddHintCallback(SDL_HINT_TRACE, SDL_TraceChanged, NULL);
+}
+
+void SDL_QuitTrace(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    if (!SDL_trace_tls) {
+        return;
+    }
+
+    SDL_DelHintCallback(SDL_HINT_TRACE, SDL_TraceChanged, NULL);
+    SDL_trace_enabled = SDL_FALSE;
+    SDL_trace_tls = 0;
+
+    SDL_AtomicLock(&SDL_trace_lock);
+    buffer = SDL_trace_buffers;
+    SDL_trace_buffers = NULL;
+    SDL_AtomicUnlock(&SDL_trace_lock);
+
+    while (buffer) {
+        SDL_TraceBuffer *next = buffer->next;
+        SDL_free(buffer);
+        buffer = next;
+    }
+}
+
+static SDL_TraceBuffer *SDL_CreateTraceBuffer(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    /* Don't set an error on failure, we're in the middle of some other SDL call */
+    buffer = (SDL_TraceBuffer *)SDL_calloc(1, sizeof(*buffer));
+    if (!buffer) {
+        return NULL;
+    }
+    buffer->thread = SDL_ThreadID();
+
+    /* The buffer outlives the thread, so it can still be saved */
+    if (SDL_SetTLS(SDL_trace_tls, buffer, NULL) < 0) {
+        SDL_free(buffer);
+        return NULL;
+    }
+
+    SDL_AtomicLock(&SDL_trace_lock);
+    buffer->next = SDL_trace_buffers;
+    SDL_trace_buffers = buffer;
+    SDL_AtomicUnlock(&SDL_trace_lock);
+    return buffer;
+}
+
+void SDL_RecordTraceEvent(const char *name)
+{
+    SDL_TraceBuffer *buffer;
+    SDL_TraceEvent *event;
+    Uint64 head;
+
+    buffer = (SDL_TraceBuffer *)SDL_GetTLS(SDL_trace_tls);
+    if (!buffer) {
+        buffer = SDL_CreateTraceBuffer();
+        if (!buffer) {
+            return;
+        }
+    }
+
+    head = SDL_AtomicGetU64(&buffer->head);
+    event = &buffer->events[head & (SDL_TRACE_BUFFER_SIZE - 1)];
+    event->name = name;
+    event->timestamp = SDL_GetTicksNS();
+    /* The event has to be complete before anyone sees it counted */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSetU64(&buffer->head, head + 1);
+}
+
+/* Copy out the events that are safe to read, returns how many there are */
+static int SDL_CopyTraceEvents(SDL_TraceBuffer *buffer, SDL_TraceEvent *events)
+{
+    Uint64 start, end, head, i;
+
+    end = SDL_AtomicGetU64(&buffer->head);
+    SDL_MemoryBarrierAcquire();
+    start = (end > SDL_TRACE_BUFFER_SIZE) ? (end - SDL_TRACE_BUFFER_SIZE) : 0;
+    for (i = start; i < end; ++i) {
+        events[i - start] = buffer->events[i & (SDL_TRACE_BUFFER_SIZE - 1)];
+    }
+
+    /* The writer may be filling in the event at head, and everything a
+       buffer's length before it has been overwritten. The copies have to
+       be done before head is checked again. */
+    SDL_MemoryBarrierAcquire();
+    head = SDL_AtomicGetU64(&buffer->head);
+    if (head >= start + SDL_TRACE_BUFFER_SIZE) {
+        const Uint64 skip = head - (start + SDL_TRACE_BUFFER_SIZE) + 1;
+        if (skip >= end - start) {
+            return 0;
+        }
+        SDL_memmove(events, events + skip, (size_t)(end - start - skip) * sizeof(*events));
+        return (int)(end - start - skip);
+    }
+    return (int)(end - start);
+}
+
+static SDL_bool SDL_WriteTraceZone(SDL_RWops *dst, int tid, const SDL_TraceEvent *begin, const SDL_TraceEvent *end, SDL_bool *first)
+{
+    const Uint64 duration = end->timestamp - begin->timestamp;
+    size_t written;
+
+    /* Chrome traces are in microseconds, keep the nanoseconds as decimals */
+    written = SDL_RWprintf(dst, "%s\n{\"name\":\"%s\",\"cat\":\"SDL\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                                "\"ts\":%" SDL_PRIu64 ".%03u,\"dur\":%" SDL_PRIu64 ".%03u}",
+                           *first ? "" : ",", begin->name, tid,
+                           begin->timestamp / 1000, (unsigned int)(begin->timestamp % 1000),
+                           duration / 1000, (unsigned int)(duration % 1000));
+    *first = SDL_FALSE;
+    return written > 0 ? SDL_TRUE : SDL_FALSE;
+}
+
+static SDL_bool SDL_WriteTraceBuffer(SDL_RWops *dst, SDL_TraceBuffer *buffer, int tid, SDL_TraceEvent *events, SDL_bool *first)
+{
+    int stack[SDL_TRACE_MAX_DEPTH];
+    int count, depth = 0, i;
+
+    if (!SDL_RWprintf(dst, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Thread %lu\"}}",
+                      *first ? "" : ",", tid, buffer->thread)) {
+        return SDL_FALSE;
+    }
+    *first = SDL_FALSE;
+
+    /* Pair up the zones. An end with nothing open lost its beginning when
+       the buffer wrapped, and zones still open when copying are skipped. */
+    count = SDL_CopyTraceEvents(buffer, events);
+    for (i = 0; i < count; ++i) {
+        if (events[i].name) {
+            if (depth < SDL_TRACE_MAX_DEPTH) {
+                stack[depth] = i;
+            }
+            ++depth;
+        } else if (depth > 0) {
+            --depth;
+            if (depth < SDL_TRACE_MAX_DEPTH && events[stack[depth]].timestamp >= SDL_trace_start) {
+                if (!SDL_WriteTraceZone(dst, tid, &events[stack[depth]], &events[i], first)) {
+                    return SDL_FALSE;
+                }
+            }
+        }
+    }
+    return SDL_TRUE;
+}
+
+int SDL_SaveTrace_RW(SDL_RWops *dst, SDL_bool freedst)
+{
+    SDL_TraceBuffer *buffers, *buffer;
+    SDL_TraceEvent *events = NULL;
+    SDL_bool first = SDL_TRUE;
+    int tid = 0;
+    int retval = -1;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+
+    events = (SDL_TraceEvent *)SDL_malloc(SDL_TRACE_BUFFER_SIZE * sizeof(*events));
+    if (!events) {
+        SDL_OutOfMemory();
+        goto done;
+    }
+
+    /* Buffers are only ever added at the front, and only freed on quit */
+    SDL_AtomicLock(&SDL_trace_lock);
+    buffers = SDL_trace_buffers;
+    SDL_AtomicUnlock(&SDL_trace_lock);
+
+    if (!SDL_RWprintf(dst, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[")) {
+        goto done;
+    }
+    for (buffer = buffers; buffer; buffer = buffer->next) {
+        if (!SDL_WriteTraceBuffer(dst, buffer, ++tid, events, &first)) {
+            goto done;
+        }
+    }
+    if (!SDL_RWprintf(dst, "\n]}\n")) {
+        goto done;
+    }
+    retval = 0;
+
+done:
+    SDL_free(events);
+    if (freedst) {
+        if (SDL_RWclose(dst) < 0) {
+            retval = -1;
+        }
+    }
+    return retval;
+}
+
+int SDL_SaveTrace(const char *file)
+{
+    SDL_RWops *dst = SDL_RWFromFile(file, "wb");
+    if (!dst) {
+        return -1;
+    }
+    return SDL_SaveTrace_RW(dst, SDL_TRUE);
+}
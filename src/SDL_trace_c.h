@@ -0,0 +1,53 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* Low overhead tracing of SDL's expensive operations, see SDL_trace.h */
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+extern SDL_bool SDL_trace_enabled;
+
+extern void SDL_InitTrace(void);
+extern void SDL_QuitTrace(void);
+
+/* Records the start of a zone, or the end of the innermost one if name is NULL */
+extern void SDL_RecordTraceEvent(const char *name);
+
+/* Zones must be strictly nested on each thread, and named with string
+   literals, since only the pointer is kept. While tracing is disabled,
+   these are a single branch on SDL_trace_enabled. */
+#define SDL_BeginTraceZone(name)          \
+    do {                                  \
+        if (SDL_trace_enabled) {          \
+            SDL_RecordTraceEvent(name);   \
+        }                                 \
+    } while (0)
+
+#define SDL_EndTraceZone()                \
+    do {                                  \
+        if (SDL_trace_enabled) {          \
+            SDL_RecordTraceEvent(NULL);   \
+        }                                 \
+    } while (0)
+
+#endif /* SDL_trace_c_h_ */
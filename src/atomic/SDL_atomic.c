@@ -104,7 +104,14 @@ extern __inline int _SDL_xadd_watcom(volatile int *a, int v);
 #define EMULATE_CAS 1
 #endif
 
-#ifdef EMULATE_CAS
+/* 64-bit operations need cmpxchg8b or similar on 32-bit CPUs, which the compiler tells us about */
+#if defined(HAVE_GCC_ATOMICS) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#define HAVE_GCC_ATOMICS64 1
+#elif !defined(HAVE_MSC_ATOMICS) && !defined(__SOLARIS__)
+#define EMULATE_CAS64 1
+#endif
+
+#if defined(EMULATE_CAS) || defined(EMULATE_CAS64)
 static SDL_SpinLock locks[32];
 
 static SDL_INLINE void enterLock(void *a)
@@ -243,6 +250,38 @@ int SDL_AtomicAdd(SDL_AtomicInt *a, int v)
 #endif
 }
 
+int SDL_AtomicOr(SDL_AtomicInt *a, int v)
+{
+#ifdef HAVE_MSC_ATOMICS
+    SDL_COMPILE_TIME_ASSERT(atomic_or, sizeof(long) == sizeof(a->value));
+    return _InterlockedOr((long *)&a->value, v);
+#elif defined(HAVE_GCC_ATOMICS)
+    return __sync_fetch_and_or(&a->value, v);
+#else
+    int value;
+    do {
+        value = a->value;
+    } while (!SDL_AtomicCAS(a, value, (value | v)));
+    return value;
+#endif
+}
+
+int SDL_AtomicAnd(SDL_AtomicInt *a, int v)
+{
+#ifdef HAVE_MSC_ATOMICS
+    SDL_COMPILE_TIME_ASSERT(atomic_and, sizeof(long) == sizeof(a->value));
+    return _InterlockedAnd((long *)&a->value, v);
+#elif defined(HAVE_GCC_ATOMICS)
+    return __sync_fetch_and_and(&a->value, v);
+#else
+    int value;
+    do {
+        value = a->value;
+    } while (!SDL_AtomicCAS(a, value, (value & v)));
+    return value;
+#endif
+}
+
 int SDL_AtomicGet(SDL_AtomicInt *a)
 {
 #ifdef HAVE_ATOMIC_LOAD_N
@@ -286,6 +325,109 @@ void *SDL_AtomicGetPtr(void **a)
 #endif
 }
 
+SDL_bool SDL_AtomicCASU64(SDL_AtomicU64 *a, Uint64 oldval, Uint64 newval)
+{
+#ifdef HAVE_MSC_ATOMICS
+    return _InterlockedCompareExchange64((__int64 *)&a->value, (__int64)newval, (__int64)oldval) == (__int64)oldval;
+#elif defined(HAVE_GCC_ATOMICS64)
+    return __sync_bool_compare_and_swap(&a->value, oldval, newval);
+#elif defined(__SOLARIS__)
+    return (atomic_cas_64((volatile uint64_t *)&a->value, oldval, newval) == oldval);
+#elif defined(EMULATE_CAS64)
+    SDL_bool retval = SDL_FALSE;
+
+    enterLock(a);
+    if (a->value == oldval) {
+        a->value = newval;
+        retval = SDL_TRUE;
+    }
+    leaveLock(a);
+
+    return retval;
+#else
+#error Please define your platform.
+#endif
+}
+
+Uint64 SDL_AtomicSetU64(SDL_AtomicU64 *a, Uint64 v)
+{
+#if defined(HAVE_MSC_ATOMICS) && !defined(_M_IX86)
+    return (Uint64)_InterlockedExchange64((__int64 *)&a->value, (__int64)v);
+#elif defined(HAVE_ATOMIC_LOAD_N) && defined(HAVE_GCC_ATOMICS64)
+    return __atomic_exchange_n(&a->value, v, __ATOMIC_SEQ_CST);
+#elif defined(HAVE_GCC_ATOMICS64)
+    /* __sync_lock_test_and_set() is only an acquire barrier, so order earlier stores before it */
+    SDL_MemoryBarrierRelease();
+    return __sync_lock_test_and_set(&a->value, v);
+#elif defined(__SOLARIS__)
+    return atomic_swap_64((volatile uint64_t *)&a->value, v);
+#elif defined(EMULATE_CAS64)
+    Uint64 value;
+
+    enterLock(a);
+    value = a->value;
+    a->value = v;
+    leaveLock(a);
+
+    return value;
+#else
+    Uint64 value;
+    do {
+        value = SDL_AtomicGetU64(a);
+    } while (!SDL_AtomicCASU64(a, value, v));
+    return value;
+#endif
+}
+
+Uint64 SDL_AtomicAddU64(SDL_AtomicU64 *a, Sint64 v)
+{
+#if defined(HAVE_MSC_ATOMICS) && !defined(_M_IX86)
+    return (Uint64)_InterlockedExchangeAdd64((__int64 *)&a->value, (__int64)v);
+#elif defined(HAVE_GCC_ATOMICS64)
+    return __sync_fetch_and_add(&a->value, (Uint64)v);
+#elif defined(__SOLARIS__)
+    return atomic_add_64_nv((volatile uint64_t *)&a->value, v) - (Uint64)v;
+#elif defined(EMULATE_CAS64)
+    Uint64 value;
+
+    enterLock(a);
+    value = a->value;
+    a->value = value + (Uint64)v;
+    leaveLock(a);
+
+    return value;
+#else
+    Uint64 value;
+    do {
+        value = SDL_AtomicGetU64(a);
+    } while (!SDL_AtomicCASU64(a, value, value + (Uint64)v));
+    return value;
+#endif
+}
+
+Uint64 SDL_AtomicGetU64(SDL_AtomicU64 *a)
+{
+#if defined(HAVE_ATOMIC_LOAD_N) && defined(HAVE_GCC_ATOMICS64)
+    return __atomic_load_n(&a->value, __ATOMIC_SEQ_CST);
+#elif defined(HAVE_MSC_ATOMICS)
+    return (Uint64)_InterlockedCompareExchange64((__int64 *)&a->value, 0, 0);
+#elif defined(HAVE_GCC_ATOMICS64)
+    return __sync_val_compare_and_swap(&a->value, 0, 0);
+#elif defined(__SOLARIS__)
+    return atomic_cas_64((volatile uint64_t *)&a->value, 0, 0);
+#elif defined(EMULATE_CAS64)
+    Uint64 value;
+
+    enterLock(a);
+    value = a->value;
+    leaveLock(a);
+
+    return value;
+#else
+#error Please define your platform.
+#endif
+}
+
 #ifdef SDL_MEMORY_BARRIER_USES_FUNCTION
 #error This file should be built in arm mode so the mcr instruction is available for memory barriers
 #endif
@@ -0,0 +1,313 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* Lock-free stack and queue built on 64-bit compare-and-swap
+
+   Lock-free lists have two classic problems: a node can be popped, reused
+   and pushed again between another thread reading it and swapping it out
+   (ABA), and a thread can read a node that another thread has just freed.
+
+   Both are avoided here by never freeing nodes while the list exists, and by
+   referring to nodes with 32-bit indices instead of pointers. The head of a
+   list is the index of the first node plus a 32-bit tag that changes with
+   every update, so both fit in one SDL_AtomicU64 and a stale swap always
+   fails, without needing a double-width CAS on 64-bit platforms.
+*/
+
+/* Nodes are allocated in chunks that double in size, chunk N holding
+   SDL_ATOMIC_NODE_CHUNK << N nodes. Index 0 means "no node". */
+#define SDL_ATOMIC_NODE_CHUNK      16
+#define SDL_ATOMIC_NODE_MAX_CHUNKS 26
+
+typedef struct SDL_AtomicNode
+{
+    SDL_AtomicInt next;
+    void *item;
+} SDL_AtomicNode;
+
+typedef struct SDL_AtomicNodePool
+{
+    SDL_AtomicU64 free_list;
+    SDL_SpinLock grow_lock;
+    int num_chunks;
+    void *chunks[SDL_ATOMIC_NODE_MAX_CHUNKS];
+} SDL_AtomicNodePool;
+
+struct SDL_AtomicStack
+{
+    SDL_AtomicU64 top;
+    char pad[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicU64)];
+    SDL_AtomicNodePool pool;
+};
+
+struct SDL_AtomicQueue
+{
+    /* Written by producers */
+    SDL_AtomicInt tail;
+    char pad[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+    /* Only touched by the consumer */
+    Uint32 head;
+    SDL_AtomicNodePool pool;
+};
+
+static SDL_AtomicNode *SDL_GetAtomicNode(SDL_AtomicNodePool *pool, Uint32 index)
+{
+    Uint32 offset = index - 1;
+    int chunk = SDL_MostSignificantBitIndex32((offset / SDL_ATOMIC_NODE_CHUNK) + 1);
+    SDL_AtomicNode *nodes = (SDL_AtomicNode *)SDL_AtomicGetPtr(&pool->chunks[chunk]);
+
+    offset -= SDL_ATOMIC_NODE_CHUNK * ((1u << chunk) - 1);
+    return &nodes[offset];
+}
+
+static void SDL_PushAtomicNode(SDL_AtomicNodePool *pool, SDL_AtomicU64 *list, Uint32 index)
+{
+    SDL_AtomicNode *node = SDL_GetAtomicNode(pool, index);
+    Uint64 head, tag;
+
+    do {
+        head = SDL_AtomicGetU64(list);
+        tag = (head >> 32) + 1;
+        SDL_AtomicSet(&node->next, (int)(Uint32)head);
+    } while (!SDL_AtomicCASU64(list, head, (tag << 32) | index));
+}
+
+static Uint32 SDL_PopAtomicNode(SDL_AtomicNodePool *pool, SDL_AtomicU64 *list)
+{
+    Uint64 head, tag;
+    Uint32 index, next;
+
+    do {
+        head = SDL_AtomicGetU64(list);
+        index = (Uint32)head;
+        if (!index) {
+            return 0;
+        }
+        /* This node may be taken by someone else in the meantime, but it's
+           never freed, and the tag makes our swap fail if that happens */
+        next = (Uint32)SDL_AtomicGet(&SDL_GetAtomicNode(pool, index)->next);
+        tag = (head >> 32) + 1;
+    } while (!SDL_AtomicCASU64(list, head, (tag << 32) | next));
+
+    return index;
+}
+
+static Uint32 SDL_AllocAtomicNode(SDL_AtomicNodePool *pool)
+{
+    SDL_AtomicNode *nodes;
+    Uint32 index, first, count, i;
+
+    index = SDL_PopAtomicNode(pool, &pool->free_list);
+    if (index) {
+        return index;
+    }
+
+    SDL_AtomicLock(&pool->grow_lock);
+
+    /* Someone else may have grown the pool while we waited */
+    index = SDL_PopAtomicNode(pool, &pool->free_list);
+    if (index) {
+        SDL_AtomicUnlock(&pool->grow_lock);
+        return index;
+    }
+
+    if (pool->num_chunks == SDL_ATOMIC_NODE_MAX_CHUNKS) {
+        SDL_AtomicUnlock(&pool->grow_lock);
+        SDL_SetError("Too many items");
+        return 0;
+    }
+
+    count = SDL_ATOMIC_NODE_CHUNK << pool->num_chunks;
+    nodes = (SDL_AtomicNode *)SDL_calloc(count, sizeof(*nodes));
+    if (!nodes) {
+        SDL_AtomicUnlock(&pool->grow_lock);
+        SDL_OutOfMemory();
+        return 0;
+    }
+    first = SDL_ATOMIC_NODE_CHUNK * ((1u << pool->num_chunks) - 1) + 1;
+    SDL_AtomicSetPtr(&pool->chunks[pool->num_chunks], nodes);
+    ++pool->num_chunks;
+
+    /* Keep the first new node, the rest go on the free list */
+    for (i = 1; i < count; ++i) {
+        SDL_PushAtomicNode(pool, &pool->free_list, first + i);
+    }
+
+    SDL_AtomicUnlock(&pool->grow_lock);
+    return first;
+}
+
+static void SDL_FreeAtomicNodePool(SDL_AtomicNodePool *pool)
+{
+    int i;
+
+    for (i = 0; i < pool->num_chunks; ++i) {
+        SDL_free(pool->chunks[i]);
+    }
+}
+
+SDL_AtomicStack *SDL_CreateAtomicStack(void)
+{
+    SDL_AtomicStack *stack = (SDL_AtomicStack *)SDL_aligned_alloc(SDL_CACHELINE_SIZE, sizeof(*stack));
+    if (!stack) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_zerop(stack);
+    return stack;
+}
+
+int SDL_PushAtomicStack(SDL_AtomicStack *stack, void *item)
+{
+    Uint32 index;
+
+    if (!stack) {
+        return SDL_InvalidParamError("stack");
+    }
+    if (!item) {
+        return SDL_InvalidParamError("item");
+    }
+
+    index = SDL_AllocAtomicNode(&stack->pool);
+    if (!index) {
+        return -1;
+    }
+    SDL_GetAtomicNode(&stack->pool, index)->item = item;
+    SDL_PushAtomicNode(&stack->pool, &stack->top, index);
+    return 0;
+}
+
+void *SDL_PopAtomicStack(SDL_AtomicStack *stack)
+{
+    Uint32 index;
+    void *item;
+
+    if (!stack) {
+        SDL_InvalidParamError("stack");
+        return NULL;
+    }
+
+    index = SDL_PopAtomicNode(&stack->pool, &stack->top);
+    if (!index) {
+        return NULL;
+    }
+    item = SDL_GetAtomicNode(&stack->pool, index)->item;
+    SDL_PushAtomicNode(&stack->pool, &stack->pool.free_list, index);
+    return item;
+}
+
+void SDL_DestroyAtomicStack(SDL_AtomicStack *stack)
+{
+    if (!stack) {
+        return;
+    }
+
+    SDL_FreeAtomicNodePool(&stack->pool);
+    SDL_aligned_free(stack);
+}
+
+/* The queue is the multiple producer, single consumer design by Dmitry Vyukov.
+   The head is always a dummy node whose item has already been taken, and
+   producers swap themselves into the tail before linking the old tail to
+   the new node. */
+SDL_AtomicQueue *SDL_CreateAtomicQueue(void)
+{
+    SDL_AtomicQueue *queue;
+    Uint32 index;
+
+    queue = (SDL_AtomicQueue *)SDL_aligned_alloc(SDL_CACHELINE_SIZE, sizeof(*queue));
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_zerop(queue);
+
+    index = SDL_AllocAtomicNode(&queue->pool);
+    if (!index) {
+        SDL_DestroyAtomicQueue(queue);
+        return NULL;
+    }
+    queue->head = index;
+    SDL_AtomicSet(&queue->tail, (int)index);
+    return queue;
+}
+
+int SDL_PushAtomicQueue(SDL_AtomicQueue *queue, void *item)
+{
+    SDL_AtomicNode *node;
+    Uint32 index, prev;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    if (!item) {
+        return SDL_InvalidParamError("item");
+    }
+
+    index = SDL_AllocAtomicNode(&queue->pool);
+    if (!index) {
+        return -1;
+    }
+    node = SDL_GetAtomicNode(&queue->pool, index);
+    node->item = item;
+    SDL_AtomicSet(&node->next, 0);
+
+    /* SDL_AtomicSet() doesn't order the item before it, and the consumer must see it before the link */
+    SDL_MemoryBarrierRelease();
+    prev = (Uint32)SDL_AtomicSet(&queue->tail, (int)index);
+    SDL_AtomicSet(&SDL_GetAtomicNode(&queue->pool, prev)->next, (int)index);
+    return 0;
+}
+
+void *SDL_PopAtomicQueue(SDL_AtomicQueue *queue)
+{
+    Uint32 head, next;
+    void *item;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    }
+
+    head = queue->head;
+    next = (Uint32)SDL_AtomicGet(&SDL_GetAtomicNode(&queue->pool, head)->next);
+    if (!next) {
+        return NULL;
+    }
+    SDL_MemoryBarrierAcquire();
+
+    /* The next node becomes the new dummy */
+    item = SDL_GetAtomicNode(&queue->pool, next)->item;
+    queue->head = next;
+    SDL_PushAtomicNode(&queue->pool, &queue->pool.free_list, head);
+    return item;
+}
+
+void SDL_DestroyAtomicQueue(SDL_AtomicQueue *queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    SDL_FreeAtomicNodePool(&queue->pool);
+    SDL_aligned_free(queue);
+}
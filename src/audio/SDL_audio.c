@@ -22,8 +22,11 @@
 
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
+#include "SDL_audiomixpool.h"
+#include "SDL_audioqueue.h"
 #include "../thread/SDL_systhread.h"
 #include "../SDL_utils_c.h"
+#include "../SDL_trace_c.h"
 
 // Available audio drivers
 static const AudioBootStrap *const bootstrap[] = {
@@ -116,6 +119,12 @@ const char *SDL_GetCurrentAudioDriver(void)
     return current_audio.name;
 }
 
+static int GetAudioHintInt(const char *name, const int default_value)
+{
+    const char *hint = SDL_GetHint(name);
+    return hint ? SDL_atoi(hint) : default_value;
+}
+
 static int GetDefaultSampleFramesFromFreq(const int freq)
 {
     const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES);
@@ -451,6 +460,7 @@ static void DestroyLogicalAudioDevice(SDL_LogicalAudioDevice *logdev)
     }
 
     UpdateAudioStreamFormatsPhysical(logdev->physical_device);
+    SDL_AudioDeviceStreamsChanged(logdev->physical_device);
     SDL_free(logdev);
 }
 
@@ -473,13 +483,23 @@ static void DestroyPhysicalAudioDevice(SDL_AudioDevice *device)
 
     SDL_UnlockMutex(device->lock);  // don't use ReleaseAudioDevice because we don't want to change refcounts while destroying.
 
+    SDL_DestroyProperties(device->props);
     SDL_DestroyMutex(device->lock);
     SDL_DestroyCondition(device->close_cond);
+    SDL_DestroySemaphore(device->streams_changed);
     SDL_free(device->work_buffer);
     SDL_free(device->name);
     SDL_free(device);
 }
 
+void SDL_AudioDeviceStreamsChanged(SDL_AudioDevice *device)
+{
+    // One wakeup is enough for any number of changes; the waiter looks at all the streams again when it wakes.
+    if (SDL_GetSemaphoreValue(device->streams_changed) == 0) {
+        SDL_PostSemaphore(device->streams_changed);
+    }
+}
+
 // Don't hold the device lock when calling this, as we may destroy the device!
 void UnrefPhysicalAudioDevice(SDL_AudioDevice *device)
 {
@@ -499,6 +519,20 @@ void RefPhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_AtomicIncRef(&device->refcount);
 }
 
+SDL_Mutex *SDL_CreateAudioMutex(void)
+{
+    const SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_Mutex *retval;
+
+    if (!props) {
+        return NULL;
+    }
+    SDL_SetBooleanProperty(props, "SDL.mutex.priority_inheritance", SDL_TRUE);
+    retval = SDL_CreateMutexWithProperties(props);
+    SDL_DestroyProperties(props);
+    return retval;
+}
+
 static SDL_AudioDevice *CreatePhysicalAudioDevice(const char *name, SDL_bool iscapture, const SDL_AudioSpec *spec, void *handle, SDL_AtomicInt *device_count)
 {
     SDL_assert(name != NULL);
@@ -521,7 +555,7 @@ static SDL_AudioDevice *CreatePhysicalAudioDevice(const char *name, SDL_bool isc
         return NULL;
     }
 
-    device->lock = SDL_CreateMutex();
+    device->lock = SDL_CreateAudioMutex();
     if (!device->lock) {
         SDL_free(device->name);
         SDL_free(device);
@@ -536,6 +570,15 @@ static SDL_AudioDevice *CreatePhysicalAudioDevice(const char *name, SDL_bool isc
         return NULL;
     }
 
+    device->streams_changed = SDL_CreateSemaphore(0);
+    if (!device->streams_changed) {
+        SDL_DestroyCondition(device->close_cond);
+        SDL_DestroyMutex(device->lock);
+        SDL_free(device->name);
+        SDL_free(device);
+        return NULL;
+    }
+
     SDL_AtomicSet(&device->shutdown, 0);
     SDL_AtomicSet(&device->zombie, 0);
     device->iscapture = iscapture;
@@ -810,6 +853,7 @@ int SDL_InitAudio(const char *driver_name)
     SDL_AtomicCAS(&last_device_instance_id, 0, 2);
 
     SDL_ChooseAudioConverters();
+    SDL_ChooseAudioMixers();
     SDL_SetupAudioResampler();
 
     SDL_RWLock *device_hash_lock = SDL_CreateRWLock();  // create this early, so if it fails we don't have to tear down the whole audio subsystem.
@@ -993,22 +1037,164 @@ void SDL_AudioThreadFinalize(SDL_AudioDevice *device)
 {
 }
 
-static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
-{
-    if (SDL_MixAudioFormat((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, buffer_size, SDL_MIX_MAXVOLUME) < 0) {
-        SDL_assert(!"This shouldn't happen.");
-    }
-}
-
 
 // Output device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
 void SDL_OutputAudioThreadSetup(SDL_AudioDevice *device)
 {
     SDL_assert(!device->iscapture);
+    SDL_SetThreadAffinityFromHint(SDL_HINT_THREAD_AFFINITY_AUDIO);
     current_audio.impl.ThreadInit(device);
 }
 
+static void SDLCALL RunAudioMixJob(void *userdata, int index)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioMixJob *job = &device->mix_jobs[index];
+
+    if (job->stream) {
+        SDL_AudioStream *stream = job->stream;
+
+        // The device thread holds the device lock while we run. An app callback that takes it (or anything else the
+        //  device thread holds) would deadlock on this thread, so leave streams with callbacks for the device thread,
+        //  where the lock is recursive. The stream lock keeps the callback from being set between the check and the get.
+        SDL_LockMutex(stream->lock);
+        if (stream->get_callback) {
+            job->deferred = SDL_TRUE;
+        } else {
+            job->gain = 1.0f;
+            job->bytes = GetAudioStreamDataForMixing(stream, job->buffer, device->mix_job_request_size, &job->gain);
+        }
+        SDL_UnlockMutex(stream->lock);
+    }
+}
+
+// Get data from every bound stream on the worker pool, then mix it in the same order as the serial path, so the output is identical.
+// Returns SDL_FALSE, without touching anything, if there aren't enough streams to be worth it (or we're out of memory).
+static SDL_bool MixAudioStreamsInParallel(SDL_AudioDevice *device, float *final_mix_buffer, int work_buffer_size, const SDL_AudioSpec *outspec, SDL_bool *failed, SDL_bool *underrun)
+{
+    int num_streams = 0;
+    int num_jobs = 0;
+    int i;
+
+    if (!device->mix_pool) {
+        return SDL_FALSE;
+    }
+
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        ++num_jobs;
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            ++num_streams;
+        }
+    }
+
+    if (num_streams < device->mix_pool_min_streams) {
+        return SDL_FALSE;
+    }
+
+    num_jobs += num_streams;
+
+    if (num_jobs > device->mix_jobs_allocation) {
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(device->mix_jobs, num_jobs * sizeof (SDL_AudioMixJob));
+        if (!jobs) {
+            return SDL_FALSE;
+        }
+        device->mix_jobs = jobs;
+        device->mix_jobs_allocation = num_jobs;
+    }
+
+    if (num_streams > device->mix_job_buffers_count) {
+        SDL_aligned_free(device->mix_job_buffers);
+        device->mix_job_buffers_count = 0;
+        device->mix_job_buffers = (Uint8 *) SDL_aligned_alloc(SDL_SIMDGetAlignment(), (size_t) num_streams * device->work_buffer_size);
+        if (!device->mix_job_buffers) {
+            return SDL_FALSE;
+        }
+        device->mix_job_buffers_count = num_streams;
+    }
+
+    // Check each logical device's paused state exactly once, so the jobs and the mix below agree on it.
+    num_jobs = 0;
+    num_streams = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (SDL_AtomicGet(&logdev->paused)) {
+            continue;  // paused? Skip this logical device.
+        }
+
+        SDL_AudioMixJob *job = &device->mix_jobs[num_jobs++];
+        job->logdev = logdev;
+        job->stream = NULL;
+        job->deferred = SDL_FALSE;
+
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            // We should have updated this elsewhere if the format changed!
+            SDL_assert(AUDIO_SPECS_EQUAL(stream->dst_spec, *outspec));
+
+            job = &device->mix_jobs[num_jobs++];
+            job->logdev = logdev;
+            job->stream = stream;
+            job->buffer = (float *) (device->mix_job_buffers + ((size_t) num_streams++ * device->work_buffer_size));
+            job->deferred = SDL_FALSE;
+        }
+    }
+
+    device->mix_job_request_size = work_buffer_size;
+    SDL_RunAudioMixPool(device->mix_pool, num_jobs, RunAudioMixJob, device);
+
+    // Streams with callbacks were left for us, so their callbacks run on the device thread, like they do without the pool.
+    for (i = 0; i < num_jobs; i++) {
+        SDL_AudioMixJob *job = &device->mix_jobs[i];
+        if (job->deferred) {
+            job->gain = 1.0f;
+            job->bytes = GetAudioStreamDataForMixing(job->stream, job->buffer, work_buffer_size, &job->gain);
+        }
+    }
+
+    // Now sum everything up, one stream at a time, in binding order.
+    for (i = 0; i < num_jobs; ) {
+        SDL_LogicalAudioDevice *logdev = device->mix_jobs[i++].logdev;
+        const SDL_AudioPostmixCallback postmix = logdev->postmix;
+        float *mix_buffer = final_mix_buffer;
+        if (postmix) {
+            mix_buffer = device->postmix_buffer;
+            SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
+        }
+
+        for (; (i < num_jobs) && device->mix_jobs[i].stream; i++) {
+            const SDL_AudioMixJob *job = &device->mix_jobs[i];
+            if (job->bytes < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                *failed = SDL_TRUE;
+            } else if (job->bytes > 0) {  // it's okay if we get less than requested, we mix what we have.
+                if (job->bytes < work_buffer_size) {
+                    *underrun = SDL_TRUE;
+                }
+                if (job->gain != 0.0f) {
+                    SDL_MixFloat32Audio(mix_buffer, job->buffer, job->bytes / (int) sizeof (float), job->gain);
+                }
+            }
+        }
+
+        if (postmix) {
+            SDL_assert(mix_buffer == device->postmix_buffer);
+            postmix(logdev->postmix_userdata, outspec, mix_buffer, work_buffer_size);
+            SDL_MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size / (int) sizeof (float), 1.0f);
+        }
+    }
+
+    return SDL_TRUE;
+}
+
+// Count an iteration of the device thread that started at `start`. The device lock must be held.
+static void UpdateAudioThreadStats(SDL_AudioDevice *device, Uint64 start)
+{
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+    device->stats_iterations++;
+    device->stats_iterate_ns += elapsed;
+    if (elapsed > device->stats_iterate_max_ns) {
+        device->stats_iterate_max_ns = elapsed;
+    }
+}
+
 SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(!device->iscapture);
@@ -1020,7 +1206,10 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         return SDL_FALSE;  // we're done, shut it down.
     }
 
+    const Uint64 iterate_start = SDL_GetTicksNS();
     SDL_bool failed = SDL_FALSE;
+    SDL_bool underrun = SDL_FALSE;
+    SDL_BeginTraceZone("MixAudioDevice");
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
     if (buffer_size == 0) {
@@ -1044,6 +1233,7 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                 failed = SDL_TRUE;
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
             } else if (br < buffer_size) {
+                underrun = (br > 0);
                 SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
             }
         } else {  // need to actually mix (or silence the buffer)
@@ -1060,7 +1250,9 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
-            for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+            const SDL_bool mixed_in_parallel = MixAudioStreamsInParallel(device, final_mix_buffer, work_buffer_size, &outspec, &failed, &underrun);
+
+            for (SDL_LogicalAudioDevice *logdev = mixed_in_parallel ? NULL : device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_AtomicGet(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
                 }
@@ -1079,27 +1271,34 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                     /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
-                       the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamData(stream, device->work_buffer, work_buffer_size);
+                       the same stream to different devices at the same time, though.)
+                       The stream's gain is applied during the mix instead of during conversion, to save a pass over the data. */
+                    float gain = 1.0f;
+                    const int br = GetAudioStreamDataForMixing(stream, (float *) device->work_buffer, work_buffer_size, &gain);
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = SDL_TRUE;
                         break;
                     } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
+                        if (br < work_buffer_size) {
+                            underrun = SDL_TRUE;
+                        }
+                        if (gain != 0.0f) {
+                            SDL_MixFloat32Audio(mix_buffer, (const float *) device->work_buffer, br / (int) sizeof (float), gain);
+                        }
                     }
                 }
 
                 if (postmix) {
                     SDL_assert(mix_buffer == device->postmix_buffer);
                     postmix(logdev->postmix_userdata, &outspec, mix_buffer, work_buffer_size);
-                    MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size);
+                    SDL_MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size / (int) sizeof (float), 1.0f);
                 }
             }
 
             if (((Uint8 *) final_mix_buffer) != device_buffer) {
                 // !!! FIXME: we can't promise the device buf is aligned/padded for SIMD.
-                //ConvertAudio(needed_samples * device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device_buffer, device->spec.format, device->spec.channels, device->work_buffer);
-                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL);
+                //ConvertAudio(needed_samples * device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device_buffer, device->spec.format, device->spec.channels, device->work_buffer, 1.0f);
+                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL, 1.0f);
                 SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
             }
         }
@@ -1110,6 +1309,13 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         }
     }
 
+    SDL_EndTraceZone();
+
+    if (underrun) {
+        device->stats_underruns++;
+    }
+    UpdateAudioThreadStats(device, iterate_start);
+
     SDL_UnlockMutex(device->lock);
 
     if (failed) {
@@ -1155,9 +1361,103 @@ static int SDLCALL OutputAudioThread(void *devicep)  // thread entry point
 void SDL_CaptureAudioThreadSetup(SDL_AudioDevice *device)
 {
     SDL_assert(device->iscapture);
+    SDL_SetThreadAffinityFromHint(SDL_HINT_THREAD_AFFINITY_AUDIO);
     current_audio.impl.ThreadInit(device);
 }
 
+// The format a capture device converts its data to before handing it to `stream`. If the stream is going to
+// resample, that's float (what the resampler works in), otherwise it's the stream's output format.
+// A stream can't change its output format while it's bound to a capture device, so this is safe without the stream lock.
+static void GetCapturePublishSpec(const SDL_AudioStream *stream, const SDL_AudioSpec *spec, SDL_AudioSpec *publish_spec)
+{
+    publish_spec->freq = spec->freq;
+    if (stream->dst_spec.freq == spec->freq) {
+        publish_spec->format = stream->dst_spec.format;
+        publish_spec->channels = stream->dst_spec.channels;
+    } else {
+        publish_spec->format = SDL_AUDIO_F32;
+        publish_spec->channels = SDL_min(spec->channels, stream->dst_spec.channels);
+    }
+}
+
+// Hand captured data to every stream bound to `logdev`. Each distinct format the streams want is converted once, here,
+// instead of every stream converting its own copy later. Each stream then gets the result as a new track that's published
+// without waiting on the stream's lock, so an app holding a stream locked (say, in a slow callback) can't stall this thread.
+// The device lock must be held, which keeps the list of bound streams from changing.
+static int PublishCapturedAudio(SDL_AudioDevice *device, SDL_LogicalAudioDevice *logdev, const Uint8 *buffer, const SDL_AudioSpec *spec, int buflen)
+{
+    const int frames = buflen / SDL_AUDIO_FRAMESIZE(*spec);
+
+    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+        // We should have updated this elsewhere if the format changed!
+        SDL_assert(stream->src_spec.format == spec->format);
+        SDL_assert(stream->src_spec.channels == spec->channels);
+        SDL_assert(stream->src_spec.freq == spec->freq);
+        SDL_assert(!stream->lock_free);  // SDL_BindAudioStreams refuses these for capture devices.
+
+        SDL_AudioSpec publish_spec;
+        GetCapturePublishSpec(stream, spec, &publish_spec);
+
+        // If an earlier stream wanted the same format, this one already got it.
+        SDL_bool published = SDL_FALSE;
+        for (SDL_AudioStream *prev = logdev->bound_streams; prev != stream; prev = prev->next_binding) {
+            SDL_AudioSpec prev_spec;
+            GetCapturePublishSpec(prev, spec, &prev_spec);
+            if (AUDIO_SPECS_EQUAL(prev_spec, publish_spec)) {
+                published = SDL_TRUE;
+                break;
+            }
+        }
+
+        if (published) {
+            continue;
+        }
+
+        const Uint8 *data = buffer;
+        int datalen = buflen;
+
+        if ((publish_spec.format != spec->format) || (publish_spec.channels != spec->channels)) {
+            SDL_AudioConvertPlan plan;
+            SDL_BuildAudioConvertPlan(&plan, spec->format, spec->channels, publish_spec.format, publish_spec.channels, SDL_FALSE);
+
+            const int needed = frames * plan.max_frame_size;
+            if (needed > device->capture_convert_buffer_allocation) {
+                Uint8 *ptr = (Uint8 *) SDL_aligned_alloc(SDL_SIMDGetAlignment(), needed);
+                if (!ptr) {
+                    return -1;
+                }
+                SDL_aligned_free(device->capture_convert_buffer);
+                device->capture_convert_buffer = ptr;
+                device->capture_convert_buffer_allocation = needed;
+            }
+
+            SDL_RunAudioConvertPlan(&plan, frames, buffer, device->capture_convert_buffer, NULL, 1.0f);
+            data = device->capture_convert_buffer;
+            datalen = frames * SDL_AUDIO_FRAMESIZE(publish_spec);
+        }
+
+        for (SDL_AudioStream *target = stream; target; target = target->next_binding) {
+            if (target != stream) {
+                SDL_AudioSpec target_spec;
+                GetCapturePublishSpec(target, spec, &target_spec);
+                if (!AUDIO_SPECS_EQUAL(target_spec, publish_spec)) {
+                    continue;
+                }
+            }
+
+            // The queue's chunk size never changes, so this is safe without the stream lock. Tracks the stream
+            //  has finished reading come back to be filled again, so this doesn't allocate every period.
+            SDL_AudioTrack *track = SDL_CreateRecyclableAudioTrack(&target->spare_capture_tracks, &target->recycled_capture_tracks, &publish_spec, data, datalen, SDL_GetAudioQueueChunkSize(target->queue));
+            if (!track) {
+                return -1;
+            }
+            PublishAudioStreamTrack(target, track);
+        }
+    }
+
+    return 0;
+}
+
 SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(device->iscapture);
@@ -1169,7 +1469,9 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
         return SDL_FALSE;  // we're done, shut it down.
     }
 
+    const Uint64 iterate_start = SDL_GetTicksNS();
     SDL_bool failed = SDL_FALSE;
+    SDL_BeginTraceZone("CaptureAudioDevice");
 
     if (!device->logical_devices) {
         device->FlushCapture(device); // nothing wants data, dump anything pending.
@@ -1184,42 +1486,35 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
                     continue;  // paused? Skip this logical device.
                 }
 
-                void *output_buffer = device->work_buffer;
+                const Uint8 *output_buffer = device->work_buffer;
+                SDL_AudioSpec outspec;
+                SDL_copyp(&outspec, &device->spec);
+                int output_len = br;
 
                 // I don't know why someone would want a postmix on a capture device, but we offer it for API consistency.
                 if (logdev->postmix) {
                     // move to float format.
-                    SDL_AudioSpec outspec;
                     outspec.format = SDL_AUDIO_F32;
-                    outspec.channels = device->spec.channels;
-                    outspec.freq = device->spec.freq;
-                    output_buffer = device->postmix_buffer;
                     const int frames = br / SDL_AUDIO_FRAMESIZE(device->spec);
-                    br = frames * SDL_AUDIO_FRAMESIZE(outspec);
-                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL);
-                    logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, br);
+                    output_len = frames * SDL_AUDIO_FRAMESIZE(outspec);
+                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL, 1.0f);
+                    logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, output_len);
+                    output_buffer = (const Uint8 *) device->postmix_buffer;
                 }
 
-                for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
-                    // We should have updated this elsewhere if the format changed!
-                    SDL_assert(stream->src_spec.format == (logdev->postmix ? SDL_AUDIO_F32 : device->spec.format));
-                    SDL_assert(stream->src_spec.channels == device->spec.channels);
-                    SDL_assert(stream->src_spec.freq == device->spec.freq);
-
-                    /* this will hold a lock on `stream` while putting. We don't explicitly lock the streams
-                       for iterating here because the binding linked list can only change while the device lock is held.
-                       (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
-                       the same stream to different devices at the same time, though.) */
-                    if (SDL_PutAudioStreamData(stream, output_buffer, br) < 0) {
-                        // oh crud, we probably ran out of memory. This is possibly an overreaction to kill the audio device, but it's likely the whole thing is going down in a moment anyhow.
-                        failed = SDL_TRUE;
-                        break;
-                    }
+                if (PublishCapturedAudio(device, logdev, output_buffer, &outspec, output_len) < 0) {
+                    // oh crud, we probably ran out of memory. This is possibly an overreaction to kill the audio device, but it's likely the whole thing is going down in a moment anyhow.
+                    failed = SDL_TRUE;
+                    break;
                 }
             }
         }
     }
 
+    SDL_EndTraceZone();
+
+    UpdateAudioThreadStats(device, iterate_start);
+
     SDL_UnlockMutex(device->lock);
 
     if (failed) {
@@ -1383,6 +1678,31 @@ int SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *
     return retval;
 }
 
+SDL_PropertiesID SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid)
+{
+    SDL_PropertiesID retval = 0;
+    SDL_AudioDevice *device = ObtainPhysicalAudioDeviceDefaultAllowed(devid);
+    if (device) {
+        if (device->props == 0) {
+            device->props = SDL_CreateProperties();
+        }
+        retval = device->props;
+
+        // Refresh the counters; the device thread doesn't touch the properties itself, as setting them allocates.
+        if (retval) {
+            const Uint64 buffer_ns = (device->spec.freq > 0) ? (((Uint64) device->sample_frames * SDL_NS_PER_SECOND) / device->spec.freq) : 0;
+            SDL_SetNumberProperty(retval, "SDL.audio.device.buffer_ns", (Sint64) buffer_ns);
+            SDL_SetNumberProperty(retval, "SDL.audio.device.iterations", (Sint64) device->stats_iterations);
+            SDL_SetNumberProperty(retval, "SDL.audio.device.underruns", (Sint64) device->stats_underruns);
+            SDL_SetNumberProperty(retval, "SDL.audio.device.iterate_ns", (Sint64) device->stats_iterate_ns);
+            SDL_SetNumberProperty(retval, "SDL.audio.device.iterate_max_ns", (Sint64) device->stats_iterate_max_ns);
+        }
+    }
+    ReleaseAudioDevice(device);
+
+    return retval;
+}
+
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
 //  race to close or open the device while the lock is unprotected.
@@ -1402,6 +1722,7 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SerializePhysicalDeviceClose(device);
 
     SDL_AtomicSet(&device->shutdown, 1);
+    SDL_AudioDeviceStreamsChanged(device);  // in case the device thread is waiting on the app.
 
     // YOU MUST PROTECT KEY POINTS WITH SerializePhysicalDeviceClose() WHILE THE THREAD JOINS
     SDL_UnlockMutex(device->lock);
@@ -1430,6 +1751,21 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_aligned_free(device->postmix_buffer);
     device->postmix_buffer = NULL;
 
+    SDL_DestroyAudioMixPool(device->mix_pool);
+    device->mix_pool = NULL;
+
+    SDL_free(device->mix_jobs);
+    device->mix_jobs = NULL;
+    device->mix_jobs_allocation = 0;
+
+    SDL_aligned_free(device->mix_job_buffers);
+    device->mix_job_buffers = NULL;
+    device->mix_job_buffers_count = 0;
+
+    SDL_aligned_free(device->capture_convert_buffer);
+    device->capture_convert_buffer = NULL;
+    device->capture_convert_buffer_allocation = 0;
+
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
@@ -1556,6 +1892,11 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     device->sample_frames = GetDefaultSampleFramesFromFreq(device->spec.freq);
     SDL_UpdatedAudioDeviceFormat(device);  // start this off sane.
 
+    device->stats_iterations = 0;
+    device->stats_underruns = 0;
+    device->stats_iterate_ns = 0;
+    device->stats_iterate_max_ns = 0;
+
     device->currently_opened = SDL_TRUE;  // mark this true even if impl.OpenDevice fails, so we know to clean up.
     if (current_audio.impl.OpenDevice(device) < 0) {
         ClosePhysicalAudioDevice(device);  // clean up anything the backend left half-initialized.
@@ -1579,6 +1920,20 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    if (!device->iscapture) {
+        const int mix_threads = GetAudioHintInt(SDL_HINT_AUDIO_MIX_THREADS, 0);
+        if (mix_threads > 0) {
+            char threadname[64];
+            SDL_GetAudioThreadName(device, threadname, sizeof (threadname));
+            device->mix_pool = SDL_CreateAudioMixPool(threadname, SDL_min(mix_threads, 64));
+            if (!device->mix_pool) {
+                ClosePhysicalAudioDevice(device);
+                return -1;
+            }
+            device->mix_pool_min_streams = SDL_max(GetAudioHintInt(SDL_HINT_AUDIO_MIX_THREADS_MIN_STREAMS, 32), 1);
+        }
+    }
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         const size_t stacksize = 0;  // just take the system default, since audio streams might have callbacks.
@@ -1662,6 +2017,7 @@ static int SetLogicalAudioDevicePauseState(SDL_AudioDeviceID devid, int value)
     SDL_LogicalAudioDevice *logdev = ObtainLogicalAudioDevice(devid, &device);
     if (logdev) {
         SDL_AtomicSet(&logdev->paused, value);
+        SDL_AudioDeviceStreamsChanged(device);
     }
     ReleaseAudioDevice(device);
     return logdev ? 0 : -1;  // ObtainLogicalAudioDevice will have set an error.
@@ -1765,6 +2121,8 @@ int SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream **streams, int
                     retval = SDL_SetError("Stream #%d is already bound to a device", i);
                 } else if (stream->simplified) {  // You can get here if you closed the device instead of destroying the stream.
                     retval = SDL_SetError("Cannot change binding on a stream created with SDL_OpenAudioDeviceStream");
+                } else if (stream->lock_free && device->iscapture) {  // the device would be changing the input format under the producer.
+                    retval = SDL_SetError("Lock-free streams can't be bound to capture devices");
                 }
             }
 
@@ -1819,6 +2177,10 @@ int SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream **streams, int
 
     UpdateAudioStreamFormatsPhysical(device);
 
+    if (retval == 0) {
+        SDL_AudioDeviceStreamsChanged(device);
+    }
+
     ReleaseAudioDevice(device);
 
     return retval;
@@ -1891,6 +2253,7 @@ void SDL_UnbindAudioStreams(SDL_AudioStream **streams, int num_streams)
             SDL_UnlockMutex(stream->lock);
             if (logdev) {
                 UpdateAudioStreamFormatsPhysical(logdev->physical_device);
+                SDL_AudioDeviceStreamsChanged(logdev->physical_device);
                 SDL_UnlockMutex(logdev->physical_device->lock);
             }
         }
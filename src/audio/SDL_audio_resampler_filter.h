@@ -26,6 +26,8 @@
 #define RESAMPLER_BITS_PER_ZERO_CROSSING ((RESAMPLER_BITS_PER_SAMPLE / 2) + 1)
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS)
+#define RESAMPLER_LOW_ZERO_CROSSINGS 3
+#define RESAMPLER_LOW_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_LOW_ZERO_CROSSINGS)
 
 static const float ResamplerFilter[RESAMPLER_FILTER_SIZE] = {
      1.000000000f, 0.000000000f,-0.000000000f, 0.000000000f,-0.000000000f,
@@ -542,3 +544,518 @@ static const float ResamplerFilter[RESAMPLER_FILTER_SIZE] = {
      0.001688435f,-0.000531434f, 0.000152351f,-0.000027682f, 0.000001057f,
 };
 
+static const float ResamplerFilterLow[RESAMPLER_LOW_FILTER_SIZE] = {
+     1.000000000f, 0.000000000f,-0.000000000f,
+     0.999992639f,-0.001453746f, 0.000269811f,
+     0.999970556f,-0.002898372f, 0.000537538f,
+     0.999933751f,-0.004333870f, 0.000803180f,
+     0.999882227f,-0.005760237f, 0.001066736f,
+     0.999815984f,-0.007177465f, 0.001328206f,
+     0.999735024f,-0.008585551f, 0.001587588f,
+     0.999639351f,-0.009984489f, 0.001844884f,
+     0.999528967f,-0.011374275f, 0.002100091f,
+     0.999403875f,-0.012754905f, 0.002353209f,
+     0.999264079f,-0.014126375f, 0.002604240f,
+     0.999109584f,-0.015488681f, 0.002853182f,
+     0.998940395f,-0.016841822f, 0.003100036f,
+     0.998756517f,-0.018185793f, 0.003344801f,
+     0.998557955f,-0.019520593f, 0.003587479f,
+     0.998344716f,-0.020846220f, 0.003828070f,
+     0.998116806f,-0.022162671f, 0.004066575f,
+     0.997874232f,-0.023469946f, 0.004302993f,
+     0.997617003f,-0.024768043f, 0.004537326f,
+     0.997345126f,-0.026056962f, 0.004769576f,
+     0.997058609f,-0.027336702f, 0.004999742f,
+     0.996757462f,-0.028607264f, 0.005227827f,
+     0.996441693f,-0.029868646f, 0.005453831f,
+     0.996111313f,-0.031120851f, 0.005677756f,
+     0.995766332f,-0.032363879f, 0.005899603f,
+     0.995406761f,-0.033597731f, 0.006119375f,
+     0.995032610f,-0.034822409f, 0.006337072f,
+     0.994643892f,-0.036037914f, 0.006552697f,
+     0.994240619f,-0.037244249f, 0.006766252f,
+     0.993822803f,-0.038441416f, 0.006977739f,
+     0.993390457f,-0.039629419f, 0.007187160f,
+     0.992943594f,-0.040808260f, 0.007394517f,
+     0.992482229f,-0.041977943f, 0.007599814f,
+     0.992006376f,-0.043138471f, 0.007803051f,
+     0.991516050f,-0.044289849f, 0.008004232f,
+     0.991011265f,-0.045432081f, 0.008203361f,
+     0.990492038f,-0.046565172f, 0.008400438f,
+     0.989958385f,-0.047689127f, 0.008595469f,
+     0.989410322f,-0.048803951f, 0.008788454f,
+     0.988847867f,-0.049909650f, 0.008979399f,
+     0.988271036f,-0.051006230f, 0.009168306f,
+     0.987679848f,-0.052093698f, 0.009355178f,
+     0.987074321f,-0.053172059f, 0.009540018f,
+     0.986454475f,-0.054241321f, 0.009722832f,
+     0.985820327f,-0.055301491f, 0.009903621f,
+     0.985171899f,-0.056352576f, 0.010082390f,
+     0.984509209f,-0.057394584f, 0.010259143f,
+     0.983832279f,-0.058427524f, 0.010433884f,
+     0.983141130f,-0.059451404f, 0.010606616f,
+     0.982435783f,-0.060466232f, 0.010777345f,
+     0.981716259f,-0.061472018f, 0.010946073f,
+     0.980982582f,-0.062468771f, 0.011112806f,
+     0.980234774f,-0.063456500f, 0.011277548f,
+     0.979472859f,-0.064435215f, 0.011440303f,
+     0.978696859f,-0.065404927f, 0.011601076f,
+     0.977906799f,-0.066365646f, 0.011759872f,
+     0.977102704f,-0.067317382f, 0.011916696f,
+     0.976284598f,-0.068260148f, 0.012071552f,
+     0.975452507f,-0.069193954f, 0.012224445f,
+     0.974606456f,-0.070118811f, 0.012375381f,
+     0.973746472f,-0.071034733f, 0.012524365f,
+     0.972872581f,-0.071941730f, 0.012671401f,
+     0.971984810f,-0.072839816f, 0.012816495f,
+     0.971083188f,-0.073729003f, 0.012959653f,
+     0.970167741f,-0.074609305f, 0.013100880f,
+     0.969238498f,-0.075480734f, 0.013240182f,
+     0.968295488f,-0.076343304f, 0.013377564f,
+     0.967338740f,-0.077197029f, 0.013513031f,
+     0.966368284f,-0.078041924f, 0.013646591f,
+     0.965384149f,-0.078878002f, 0.013778248f,
+     0.964386366f,-0.079705279f, 0.013908009f,
+     0.963374966f,-0.080523769f, 0.014035879f,
+     0.962349979f,-0.081333488f, 0.014161866f,
+     0.961311439f,-0.082134451f, 0.014285974f,
+     0.960259376f,-0.082926674f, 0.014408210f,
+     0.959193824f,-0.083710173f, 0.014528581f,
+     0.958114814f,-0.084484964f, 0.014647093f,
+     0.957022381f,-0.085251064f, 0.014763753f,
+     0.955916558f,-0.086008489f, 0.014878566f,
+     0.954797380f,-0.086757258f, 0.014991540f,
+     0.953664880f,-0.087497386f, 0.015102682f,
+     0.952519093f,-0.088228892f, 0.015211998f,
+     0.951360055f,-0.088951794f, 0.015319494f,
+     0.950187802f,-0.089666109f, 0.015425179f,
+     0.949002369f,-0.090371856f, 0.015529058f,
+     0.947803794f,-0.091069054f, 0.015631139f,
+     0.946592112f,-0.091757722f, 0.015731430f,
+     0.945367362f,-0.092437878f, 0.015829936f,
+     0.944129580f,-0.093109541f, 0.015926666f,
+     0.942878805f,-0.093772733f, 0.016021626f,
+     0.941615076f,-0.094427471f, 0.016114825f,
+     0.940338431f,-0.095073777f, 0.016206269f,
+     0.939048910f,-0.095711671f, 0.016295966f,
+     0.937746551f,-0.096341173f, 0.016383923f,
+     0.936431395f,-0.096962304f, 0.016470148f,
+     0.935103483f,-0.097575085f, 0.016554649f,
+     0.933762854f,-0.098179538f, 0.016637434f,
+     0.932409551f,-0.098775683f, 0.016718509f,
+     0.931043614f,-0.099363543f, 0.016797884f,
+     0.929665085f,-0.099943139f, 0.016875566f,
+     0.928274007f,-0.100514494f, 0.016951562f,
+     0.926870423f,-0.101077630f, 0.017025881f,
+     0.925454374f,-0.101632570f, 0.017098531f,
+     0.924025905f,-0.102179336f, 0.017169519f,
+     0.922585059f,-0.102717951f, 0.017238855f,
+     0.921131880f,-0.103248440f, 0.017306546f,
+     0.919666412f,-0.103770824f, 0.017372600f,
+     0.918188701f,-0.104285129f, 0.017437026f,
+     0.916698792f,-0.104791377f, 0.017499833f,
+     0.915196729f,-0.105289594f, 0.017561027f,
+     0.913682559f,-0.105779803f, 0.017620618f,
+     0.912156328f,-0.106262029f, 0.017678615f,
+     0.910618082f,-0.106736296f, 0.017735025f,
+     0.909067868f,-0.107202630f, 0.017789858f,
+     0.907505734f,-0.107661056f, 0.017843122f,
+     0.905931727f,-0.108111599f, 0.017894825f,
+     0.904345895f,-0.108554285f, 0.017944976f,
+     0.902748286f,-0.108989139f, 0.017993585f,
+     0.901138948f,-0.109416188f, 0.018040659f,
+     0.899517932f,-0.109835457f, 0.018086207f,
+     0.897885285f,-0.110246973f, 0.018130239f,
+     0.896241057f,-0.110650763f, 0.018172763f,
+     0.894585299f,-0.111046852f, 0.018213788f,
+     0.892918060f,-0.111435269f, 0.018253324f,
+     0.891239391f,-0.111816040f, 0.018291378f,
+     0.889549343f,-0.112189192f, 0.018327960f,
+     0.887847968f,-0.112554754f, 0.018363079f,
+     0.886135315f,-0.112912751f, 0.018396745f,
+     0.884411439f,-0.113263214f, 0.018428965f,
+     0.882676390f,-0.113606168f, 0.018459750f,
+     0.880930221f,-0.113941643f, 0.018489108f,
+     0.879172984f,-0.114269667f, 0.018517049f,
+     0.877404734f,-0.114590268f, 0.018543582f,
+     0.875625523f,-0.114903475f, 0.018568716f,
+     0.873835405f,-0.115209318f, 0.018592461f,
+     0.872034433f,-0.115507824f, 0.018614825f,
+     0.870222663f,-0.115799023f, 0.018635819f,
+     0.868400149f,-0.116082945f, 0.018655450f,
+     0.866566945f,-0.116359618f, 0.018673730f,
+     0.864723107f,-0.116629073f, 0.018690666f,
+     0.862868690f,-0.116891340f, 0.018706269f,
+     0.861003751f,-0.117146448f, 0.018720549f,
+     0.859128344f,-0.117394428f, 0.018733513f,
+     0.857242527f,-0.117635309f, 0.018745173f,
+     0.855346355f,-0.117869123f, 0.018755537f,
+     0.853439886f,-0.118095900f, 0.018764615f,
+     0.851523178f,-0.118315670f, 0.018772417f,
+     0.849596286f,-0.118528465f, 0.018778951f,
+     0.847659270f,-0.118734315f, 0.018784228f,
+     0.845712186f,-0.118933252f, 0.018788258f,
+     0.843755094f,-0.119125306f, 0.018791049f,
+     0.841788052f,-0.119310511f, 0.018792612f,
+     0.839811118f,-0.119488896f, 0.018792955f,
+     0.837824351f,-0.119660493f, 0.018792090f,
+     0.835827812f,-0.119825335f, 0.018790025f,
+     0.833821559f,-0.119983454f, 0.018786769f,
+     0.831805651f,-0.120134881f, 0.018782334f,
+     0.829780150f,-0.120279649f, 0.018776727f,
+     0.827745116f,-0.120417789f, 0.018769960f,
+     0.825700608f,-0.120549336f, 0.018762041f,
+     0.823646688f,-0.120674320f, 0.018752981f,
+     0.821583417f,-0.120792776f, 0.018742789f,
+     0.819510856f,-0.120904735f, 0.018731475f,
+     0.817429066f,-0.121010231f, 0.018719049f,
+     0.815338109f,-0.121109296f, 0.018705520f,
+     0.813238048f,-0.121201964f, 0.018690898f,
+     0.811128944f,-0.121288268f, 0.018675193f,
+     0.809010859f,-0.121368242f, 0.018658414f,
+     0.806883857f,-0.121441919f, 0.018640572f,
+     0.804748001f,-0.121509332f, 0.018621676f,
+     0.802603352f,-0.121570516f, 0.018601736f,
+     0.800449975f,-0.121625503f, 0.018580761f,
+     0.798287933f,-0.121674329f, 0.018558762f,
+     0.796117290f,-0.121717026f, 0.018535747f,
+     0.793938110f,-0.121753630f, 0.018511728f,
+     0.791750456f,-0.121784174f, 0.018486713f,
+     0.789554394f,-0.121808692f, 0.018460712f,
+     0.787349987f,-0.121827220f, 0.018433735f,
+     0.785137301f,-0.121839790f, 0.018405793f,
+     0.782916399f,-0.121846439f, 0.018376893f,
+     0.780687349f,-0.121847200f, 0.018347047f,
+     0.778450214f,-0.121842108f, 0.018316264f,
+     0.776205060f,-0.121831198f, 0.018284554f,
+     0.773951953f,-0.121814505f, 0.018251926f,
+     0.771690959f,-0.121792064f, 0.018218390f,
+     0.769422144f,-0.121763909f, 0.018183956f,
+     0.767145574f,-0.121730077f, 0.018148634f,
+     0.764861315f,-0.121690602f, 0.018112432f,
+     0.762569434f,-0.121645519f, 0.018075362f,
+     0.760269998f,-0.121594863f, 0.018037432f,
+     0.757963074f,-0.121538671f, 0.017998652f,
+     0.755648728f,-0.121476977f, 0.017959031f,
+     0.753327028f,-0.121409817f, 0.017918580f,
+     0.750998041f,-0.121337227f, 0.017877308f,
+     0.748661835f,-0.121259242f, 0.017835225f,
+     0.746318477f,-0.121175897f, 0.017792340f,
+     0.743968036f,-0.121087229f, 0.017748662f,
+     0.741610579f,-0.120993274f, 0.017704202f,
+     0.739246175f,-0.120894066f, 0.017658969f,
+     0.736874892f,-0.120789643f, 0.017612972f,
+     0.734496797f,-0.120680040f, 0.017566220f,
+     0.732111960f,-0.120565293f, 0.017518724f,
+     0.729720450f,-0.120445437f, 0.017470493f,
+     0.727322335f,-0.120320510f, 0.017421536f,
+     0.724917684f,-0.120190547f, 0.017371862f,
+     0.722506567f,-0.120055585f, 0.017321482f,
+     0.720089051f,-0.119915659f, 0.017270404f,
+     0.717665208f,-0.119770806f, 0.017218638f,
+     0.715235106f,-0.119621062f, 0.017166193f,
+     0.712798814f,-0.119466463f, 0.017113078f,
+     0.710356404f,-0.119307046f, 0.017059304f,
+     0.707907943f,-0.119142847f, 0.017004878f,
+     0.705453502f,-0.118973903f, 0.016949811f,
+     0.702993152f,-0.118800249f, 0.016894111f,
+     0.700526962f,-0.118621923f, 0.016837788f,
+     0.698055002f,-0.118438961f, 0.016780851f,
+     0.695577343f,-0.118251399f, 0.016723309f,
+     0.693094055f,-0.118059273f, 0.016665172f,
+     0.690605208f,-0.117862621f, 0.016606447f,
+     0.688110874f,-0.117661479f, 0.016547146f,
+     0.685611122f,-0.117455883f, 0.016487276f,
+     0.683106024f,-0.117245870f, 0.016426846f,
+     0.680595650f,-0.117031477f, 0.016365866f,
+     0.678080071f,-0.116812740f, 0.016304344f,
+     0.675559359f,-0.116589696f, 0.016242290f,
+     0.673033584f,-0.116362380f, 0.016179713f,
+     0.670502817f,-0.116130831f, 0.016116621f,
+     0.667967129f,-0.115895084f, 0.016053023f,
+     0.665426593f,-0.115655177f, 0.015988928f,
+     0.662881278f,-0.115411145f, 0.015924344f,
+     0.660331256f,-0.115163026f, 0.015859282f,
+     0.657776600f,-0.114910855f, 0.015793748f,
+     0.655217379f,-0.114654670f, 0.015727753f,
+     0.652653667f,-0.114394507f, 0.015661304f,
+     0.650085534f,-0.114130403f, 0.015594411f,
+     0.647513051f,-0.113862394f, 0.015527082f,
+     0.644936291f,-0.113590516f, 0.015459325f,
+     0.642355326f,-0.113314807f, 0.015391149f,
+     0.639770226f,-0.113035303f, 0.015322563f,
+     0.637181064f,-0.112752041f, 0.015253575f,
+     0.634587912f,-0.112465056f, 0.015184194f,
+     0.631990841f,-0.112174386f, 0.015114427f,
+     0.629389923f,-0.111880066f, 0.015044284f,
+     0.626785230f,-0.111582134f, 0.014973772f,
+     0.624176834f,-0.111280625f, 0.014902900f,
+     0.621564807f,-0.110975576f, 0.014831676f,
+     0.618949221f,-0.110667024f, 0.014760109f,
+     0.616330147f,-0.110355004f, 0.014688207f,
+     0.613707658f,-0.110039553f, 0.014615977f,
+     0.611081826f,-0.109720708f, 0.014543427f,
+     0.608452722f,-0.109398504f, 0.014470567f,
+     0.605820418f,-0.109072977f, 0.014397404f,
+     0.603184987f,-0.108744164f, 0.014323946f,
+     0.600546500f,-0.108412102f, 0.014250200f,
+     0.597905029f,-0.108076825f, 0.014176175f,
+     0.595260646f,-0.107738370f, 0.014101880f,
+     0.592613424f,-0.107396773f, 0.014027320f,
+     0.589963433f,-0.107052070f, 0.013952505f,
+     0.587310746f,-0.106704296f, 0.013877442f,
+     0.584655435f,-0.106353489f, 0.013802139f,
+     0.581997572f,-0.105999682f, 0.013726603f,
+     0.579337228f,-0.105642913f, 0.013650843f,
+     0.576674475f,-0.105283217f, 0.013574865f,
+     0.574009385f,-0.104920630f, 0.013498677f,
+     0.571342029f,-0.104555186f, 0.013422287f,
+     0.568672480f,-0.104186923f, 0.013345702f,
+     0.566000808f,-0.103815874f, 0.013268930f,
+     0.563327086f,-0.103442076f, 0.013191978f,
+     0.560651385f,-0.103065564f, 0.013114854f,
+     0.557973777f,-0.102686373f, 0.013037564f,
+     0.555294332f,-0.102304539f, 0.012960116f,
+     0.552613123f,-0.101920096f, 0.012882517f,
+     0.549930221f,-0.101533080f, 0.012804774f,
+     0.547245697f,-0.101143526f, 0.012726895f,
+     0.544559622f,-0.100751468f, 0.012648886f,
+     0.541872067f,-0.100356942f, 0.012570754f,
+     0.539183104f,-0.099959983f, 0.012492507f,
+     0.536492803f,-0.099560625f, 0.012414152f,
+     0.533801236f,-0.099158903f, 0.012335694f,
+     0.531108473f,-0.098754851f, 0.012257142f,
+     0.528414586f,-0.098348505f, 0.012178502f,
+     0.525719644f,-0.097939898f, 0.012099780f,
+     0.523023719f,-0.097529065f, 0.012020984f,
+     0.520326881f,-0.097116040f, 0.011942120f,
+     0.517629200f,-0.096700858f, 0.011863195f,
+     0.514930748f,-0.096283552f, 0.011784215f,
+     0.512231594f,-0.095864157f, 0.011705186f,
+     0.509531808f,-0.095442707f, 0.011626116f,
+     0.506831461f,-0.095019235f, 0.011547011f,
+     0.504130623f,-0.094593775f, 0.011467876f,
+     0.501429363f,-0.094166361f, 0.011388719f,
+     0.498727752f,-0.093737027f, 0.011309546f,
+     0.496025858f,-0.093305806f, 0.011230362f,
+     0.493323752f,-0.092872731f, 0.011151175f,
+     0.490621504f,-0.092437837f, 0.011071989f,
+     0.487919181f,-0.092001156f, 0.010992813f,
+     0.485216855f,-0.091562720f, 0.010913650f,
+     0.482514593f,-0.091122565f, 0.010834508f,
+     0.479812465f,-0.090680721f, 0.010755392f,
+     0.477110540f,-0.090237223f, 0.010676308f,
+     0.474408886f,-0.089792103f, 0.010597263f,
+     0.471707573f,-0.089345393f, 0.010518261f,
+     0.469006668f,-0.088897126f, 0.010439309f,
+     0.466306240f,-0.088447335f, 0.010360412f,
+     0.463606357f,-0.087996052f, 0.010281577f,
+     0.460907087f,-0.087543309f, 0.010202807f,
+     0.458208499f,-0.087089139f, 0.010124110f,
+     0.455510660f,-0.086633572f, 0.010045491f,
+     0.452813637f,-0.086176642f, 0.009966955f,
+     0.450117499f,-0.085718380f, 0.009888507f,
+     0.447422312f,-0.085258818f, 0.009810153f,
+     0.444728144f,-0.084797987f, 0.009731899f,
+     0.442035062f,-0.084335919f, 0.009653748f,
+     0.439343133f,-0.083872645f, 0.009575708f,
+     0.436652423f,-0.083408197f, 0.009497782f,
+     0.433962999f,-0.082942605f, 0.009419976f,
+     0.431274928f,-0.082475901f, 0.009342296f,
+     0.428588276f,-0.082008115f, 0.009264745f,
+     0.425903108f,-0.081539279f, 0.009187329f,
+     0.423219491f,-0.081069422f, 0.009110053f,
+     0.420537490f,-0.080598576f, 0.009032922f,
+     0.417857172f,-0.080126770f, 0.008955940f,
+     0.415178600f,-0.079654036f, 0.008879113f,
+     0.412501842f,-0.079180403f, 0.008802445f,
+     0.409826961f,-0.078705901f, 0.008725940f,
+     0.407154022f,-0.078230561f, 0.008649604f,
+     0.404483091f,-0.077754412f, 0.008573441f,
+     0.401814231f,-0.077277483f, 0.008497455f,
+     0.399147507f,-0.076799805f, 0.008421651f,
+     0.396482984f,-0.076321407f, 0.008346033f,
+     0.393820723f,-0.075842317f, 0.008270606f,
+     0.391160791f,-0.075362565f, 0.008195373f,
+     0.388503249f,-0.074882181f, 0.008120340f,
+     0.385848162f,-0.074401193f, 0.008045510f,
+     0.383195592f,-0.073919629f, 0.007970888f,
+     0.380545602f,-0.073437519f, 0.007896478f,
+     0.377898255f,-0.072954891f, 0.007822283f,
+     0.375253614f,-0.072471773f, 0.007748308f,
+     0.372611740f,-0.071988194f, 0.007674557f,
+     0.369972696f,-0.071504181f, 0.007601034f,
+     0.367336543f,-0.071019762f, 0.007527742f,
+     0.364703344f,-0.070534966f, 0.007454685f,
+     0.362073159f,-0.070049820f, 0.007381868f,
+     0.359446049f,-0.069564352f, 0.007309293f,
+     0.356822076f,-0.069078588f, 0.007236964f,
+     0.354201301f,-0.068592556f, 0.007164886f,
+     0.351583783f,-0.068106284f, 0.007093062f,
+     0.348969584f,-0.067619798f, 0.007021494f,
+     0.346358762f,-0.067133125f, 0.006950188f,
+     0.343751378f,-0.066646291f, 0.006879145f,
+     0.341147492f,-0.066159324f, 0.006808370f,
+     0.338547163f,-0.065672250f, 0.006737865f,
+     0.335950449f,-0.065185094f, 0.006667635f,
+     0.333357410f,-0.064697884f, 0.006597682f,
+     0.330768104f,-0.064210644f, 0.006528009f,
+     0.328182590f,-0.063723402f, 0.006458620f,
+     0.325600926f,-0.063236181f, 0.006389518f,
+     0.323023169f,-0.062749009f, 0.006320705f,
+     0.320449378f,-0.062261909f, 0.006252185f,
+     0.317879609f,-0.061774909f, 0.006183960f,
+     0.315313920f,-0.061288032f, 0.006116034f,
+     0.312752367f,-0.060801303f, 0.006048409f,
+     0.310195007f,-0.060314747f, 0.005981089f,
+     0.307641897f,-0.059828390f, 0.005914075f,
+     0.305093092f,-0.059342254f, 0.005847371f,
+     0.302548649f,-0.058856366f, 0.005780979f,
+     0.300008623f,-0.058370748f, 0.005714902f,
+     0.297473069f,-0.057885425f, 0.005649142f,
+     0.294942042f,-0.057400420f, 0.005583702f,
+     0.292415596f,-0.056915758f, 0.005518584f,
+     0.289893788f,-0.056431461f, 0.005453791f,
+     0.287376670f,-0.055947554f, 0.005389326f,
+     0.284864296f,-0.055464059f, 0.005325189f,
+     0.282356721f,-0.054981000f, 0.005261385f,
+     0.279853998f,-0.054498399f, 0.005197914f,
+     0.277356179f,-0.054016279f, 0.005134779f,
+     0.274863318f,-0.053534663f, 0.005071983f,
+     0.272375466f,-0.053053573f, 0.005009527f,
+     0.269892678f,-0.052573032f, 0.004947414f,
+     0.267415003f,-0.052093061f, 0.004885644f,
+     0.264942494f,-0.051613683f, 0.004824221f,
+     0.262475203f,-0.051134919f, 0.004763147f,
+     0.260013181f,-0.050656791f, 0.004702422f,
+     0.257556478f,-0.050179321f, 0.004642050f,
+     0.255105144f,-0.049702530f, 0.004582031f,
+     0.252659231f,-0.049226438f, 0.004522367f,
+     0.250218788f,-0.048751068f, 0.004463061f,
+     0.247783864f,-0.048276439f, 0.004404113f,
+     0.245354510f,-0.047802574f, 0.004345526f,
+     0.242930774f,-0.047329491f, 0.004287301f,
+     0.240512705f,-0.046857211f, 0.004229439f,
+     0.238100351f,-0.046385755f, 0.004171942f,
+     0.235693761f,-0.045915143f, 0.004114812f,
+     0.233292981f,-0.045445395f, 0.004058049f,
+     0.230898061f,-0.044976529f, 0.004001655f,
+     0.228509047f,-0.044508567f, 0.003945632f,
+     0.226125986f,-0.044041527f, 0.003889980f,
+     0.223748925f,-0.043575428f, 0.003834701f,
+     0.221377910f,-0.043110289f, 0.003779796f,
+     0.219012987f,-0.042646130f, 0.003725266f,
+     0.216654201f,-0.042182969f, 0.003671112f,
+     0.214301599f,-0.041720825f, 0.003617336f,
+     0.211955225f,-0.041259716f, 0.003563937f,
+     0.209615123f,-0.040799660f, 0.003510918f,
+     0.207281339f,-0.040340675f, 0.003458280f,
+     0.204953917f,-0.039882780f, 0.003406022f,
+     0.202632899f,-0.039425992f, 0.003354146f,
+     0.200318331f,-0.038970329f, 0.003302653f,
+     0.198010254f,-0.038515807f, 0.003251543f,
+     0.195708712f,-0.038062445f, 0.003200817f,
+     0.193413747f,-0.037610260f, 0.003150476f,
+     0.191125401f,-0.037159267f, 0.003100521f,
+     0.188843717f,-0.036709485f, 0.003050952f,
+     0.186568736f,-0.036260929f, 0.003001770f,
+     0.184300498f,-0.035813617f, 0.002952974f,
+     0.182039046f,-0.035367564f, 0.002904567f,
+     0.179784418f,-0.034922786f, 0.002856548f,
+     0.177536657f,-0.034479300f, 0.002808917f,
+     0.175295801f,-0.034037121f, 0.002761675f,
+     0.173061890f,-0.033596265f, 0.002714822f,
+     0.170834963f,-0.033156747f, 0.002668360f,
+     0.168615059f,-0.032718583f, 0.002622287f,
+     0.166402218f,-0.032281787f, 0.002576604f,
+     0.164196476f,-0.031846374f, 0.002531311f,
+     0.161997872f,-0.031412360f, 0.002486409f,
+     0.159806444f,-0.030979759f, 0.002441897f,
+     0.157622228f,-0.030548586f, 0.002397777f,
+     0.155445261f,-0.030118854f, 0.002354047f,
+     0.153275581f,-0.029690578f, 0.002310707f,
+     0.151113223f,-0.029263772f, 0.002267759f,
+     0.148958223f,-0.028838449f, 0.002225201f,
+     0.146810617f,-0.028414623f, 0.002183034f,
+     0.144670440f,-0.027992308f, 0.002141257f,
+     0.142537726f,-0.027571518f, 0.002099870f,
+     0.140412510f,-0.027152264f, 0.002058874f,
+     0.138294827f,-0.026734560f, 0.002018268f,
+     0.136184710f,-0.026318419f, 0.001978051f,
+     0.134082192f,-0.025903854f, 0.001938224f,
+     0.131987307f,-0.025490877f, 0.001898786f,
+     0.129900087f,-0.025079500f, 0.001859737f,
+     0.127820565f,-0.024669735f, 0.001821076f,
+     0.125748774f,-0.024261595f, 0.001782803f,
+     0.123684743f,-0.023855092f, 0.001744917f,
+     0.121628506f,-0.023450236f, 0.001707419f,
+     0.119580093f,-0.023047040f, 0.001670307f,
+     0.117539535f,-0.022645515f, 0.001633581f,
+     0.115506862f,-0.022245672f, 0.001597241f,
+     0.113482104f,-0.021847521f, 0.001561285f,
+     0.111465291f,-0.021451075f, 0.001525714f,
+     0.109456451f,-0.021056344f, 0.001490526f,
+     0.107455615f,-0.020663337f, 0.001455721f,
+     0.105462810f,-0.020272067f, 0.001421299f,
+     0.103478065f,-0.019882542f, 0.001387257f,
+     0.101501408f,-0.019494773f, 0.001353597f,
+     0.099532866f,-0.019108769f, 0.001320316f,
+     0.097572466f,-0.018724541f, 0.001287415f,
+     0.095620235f,-0.018342099f, 0.001254891f,
+     0.093676200f,-0.017961450f, 0.001222745f,
+     0.091740387f,-0.017582606f, 0.001190976f,
+     0.089812822f,-0.017205574f, 0.001159581f,
+     0.087893529f,-0.016830365f, 0.001128562f,
+     0.085982534f,-0.016456986f, 0.001097916f,
+     0.084079862f,-0.016085446f, 0.001067642f,
+     0.082185538f,-0.015715754f, 0.001037740f,
+     0.080299584f,-0.015347918f, 0.001008209f,
+     0.078422025f,-0.014981947f, 0.000979047f,
+     0.076552884f,-0.014617847f, 0.000950253f,
+     0.074692184f,-0.014255628f, 0.000921826f,
+     0.072839948f,-0.013895297f, 0.000893765f,
+     0.070996197f,-0.013536861f, 0.000866069f,
+     0.069160954f,-0.013180329f, 0.000838737f,
+     0.067334240f,-0.012825706f, 0.000811767f,
+     0.065516076f,-0.012473000f, 0.000785158f,
+     0.063706483f,-0.012122219f, 0.000758909f,
+     0.061905482f,-0.011773368f, 0.000733018f,
+     0.060113093f,-0.011426455f, 0.000707485f,
+     0.058329335f,-0.011081486f, 0.000682307f,
+     0.056554228f,-0.010738468f, 0.000657484f,
+     0.054787790f,-0.010397406f, 0.000633014f,
+     0.053030041f,-0.010058307f, 0.000608896f,
+     0.051280999f,-0.009721176f, 0.000585128f,
+     0.049540682f,-0.009386019f, 0.000561709f,
+     0.047809107f,-0.009052843f, 0.000538637f,
+     0.046086292f,-0.008721651f, 0.000515911f,
+     0.044372253f,-0.008392450f, 0.000493530f,
+     0.042667007f,-0.008065245f, 0.000471492f,
+     0.040970571f,-0.007740041f, 0.000449794f,
+     0.039282960f,-0.007416842f, 0.000428437f,
+     0.037604189f,-0.007095654f, 0.000407418f,
+     0.035934275f,-0.006776481f, 0.000386735f,
+     0.034273230f,-0.006459326f, 0.000366387f,
+     0.032621071f,-0.006144196f, 0.000346373f,
+     0.030977811f,-0.005831093f, 0.000326690f,
+     0.029343464f,-0.005520022f, 0.000307337f,
+     0.027718043f,-0.005210987f, 0.000288313f,
+     0.026101561f,-0.004903991f, 0.000269615f,
+     0.024494031f,-0.004599038f, 0.000251242f,
+     0.022895465f,-0.004296131f, 0.000233192f,
+     0.021305875f,-0.003995273f, 0.000215464f,
+     0.019725274f,-0.003696469f, 0.000198055f,
+     0.018153671f,-0.003399720f, 0.000180964f,
+     0.016591078f,-0.003105030f, 0.000164189f,
+     0.015037506f,-0.002812402f, 0.000147729f,
+     0.013492965f,-0.002521837f, 0.000131581f,
+     0.011957465f,-0.002233339f, 0.000115743f,
+     0.010431015f,-0.001946910f, 0.000100215f,
+     0.008913624f,-0.001662552f, 0.000084993f,
+     0.007405302f,-0.001380266f, 0.000070076f,
+     0.005906056f,-0.001100056f, 0.000055462f,
+     0.004415896f,-0.000821923f, 0.000041150f,
+     0.002934828f,-0.000545868f, 0.000027136f,
+     0.001462860f,-0.000271893f, 0.000013420f,
+};
+
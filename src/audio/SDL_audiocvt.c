@@ -161,27 +161,67 @@ static void AudioConvertByteswap(void *dst, const void *src, int num_samples, in
     }
 }
 
-static void AudioConvertToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
+// Conversion steps. Each one reads `num_frames` sample frames from `src` and writes them to `dst`, which may be the same buffer.
+
+static void AudioConvertStepByteswap(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain)
 {
-    // Endian conversion is handled separately
-    switch (src_fmt & ~SDL_AUDIO_MASK_BIG_ENDIAN) {
-        case SDL_AUDIO_S8: SDL_Convert_S8_to_F32(dst, (const Sint8 *) src, num_samples); break;
-        case SDL_AUDIO_U8: SDL_Convert_U8_to_F32(dst, (const Uint8 *) src, num_samples); break;
-        case SDL_AUDIO_S16LE: SDL_Convert_S16_to_F32(dst, (const Sint16 *) src, num_samples); break;
-        case SDL_AUDIO_S32LE: SDL_Convert_S32_to_F32(dst, (const Sint32 *) src, num_samples); break;
-        default: SDL_assert(!"Unexpected audio format!"); break;
+    AudioConvertByteswap(dst, src, num_frames * step->channels, (int) SDL_AUDIO_BITSIZE(step->format));
+}
+
+#define AUDIOCONVERT_STEP_TOFROMFLOAT(fmt, type) \
+    static void AudioConvertStep_##fmt##_to_F32(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain) \
+    { \
+        SDL_Convert_##fmt##_to_F32((float *) dst, (const type *) src, num_frames * step->channels); \
+    } \
+    static void AudioConvertStep_F32_to_##fmt(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain) \
+    { \
+        SDL_Convert_F32_to_##fmt((type *) dst, (const float *) src, num_frames * step->channels); \
+    }
+
+AUDIOCONVERT_STEP_TOFROMFLOAT(S8, Sint8)
+AUDIOCONVERT_STEP_TOFROMFLOAT(U8, Uint8)
+AUDIOCONVERT_STEP_TOFROMFLOAT(S16, Sint16)
+AUDIOCONVERT_STEP_TOFROMFLOAT(S32, Sint32)
+
+#undef AUDIOCONVERT_STEP_TOFROMFLOAT
+
+static void AudioConvertStepGain(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain)
+{
+#if DEBUG_AUDIO_CONVERT
+    SDL_Log("SDL_AUDIO_CONVERT: Applying gain of %f", gain);
+#endif
+
+    const int num_samples = num_frames * step->channels;
+    const float *fsrc = (const float *) src;
+    float *fdst = (float *) dst;
+
+    for (int i = 0; i < num_samples; i++) {
+        fdst[i] = fsrc[i] * gain;
     }
 }
 
-static void AudioConvertFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt)
+static void AudioConvertStepChannels(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain)
 {
-    // Endian conversion is handled separately
-    switch (dst_fmt & ~SDL_AUDIO_MASK_BIG_ENDIAN) {
-        case SDL_AUDIO_S8: SDL_Convert_F32_to_S8((Sint8 *) dst, src, num_samples); break;
-        case SDL_AUDIO_U8: SDL_Convert_F32_to_U8((Uint8 *) dst, src, num_samples); break;
-        case SDL_AUDIO_S16LE: SDL_Convert_F32_to_S16((Sint16 *) dst, src, num_samples); break;
-        case SDL_AUDIO_S32LE: SDL_Convert_F32_to_S32((Sint32 *) dst, src, num_samples); break;
-        default: SDL_assert(!"Unexpected audio format!"); break;
+    step->channel_converter((float *) dst, (const float *) src, num_frames);
+}
+
+// S16 stereo straight to F32 mono (with gain), in one pass instead of three. This is a very common case for
+// mono output devices. The math is done in the same order as the separate steps, so the results are the same.
+static void AudioConvertStep_S16Stereo_to_F32Mono(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain)
+{
+    const float DIVBY32768 = 0.000030517578125f;  // same scale as SDL_Convert_S16_to_F32.
+    const Sint16 *isrc = (const Sint16 *) src;
+    float *fdst = (float *) dst;
+
+    // Each output frame takes up the same space as the input frame it came from, so this is safe in-place going forwards.
+    if (gain == 1.0f) {
+        for (int i = 0; i < num_frames; i++, isrc += 2) {
+            fdst[i] = (((float) isrc[0] * DIVBY32768) * 0.5f) + (((float) isrc[1] * DIVBY32768) * 0.5f);
+        }
+    } else {
+        for (int i = 0; i < num_frames; i++, isrc += 2) {
+            fdst[i] = ((((float) isrc[0] * DIVBY32768) * gain) * 0.5f) + ((((float) isrc[1] * DIVBY32768) * gain) * 0.5f);
+        }
     }
 }
 
@@ -211,77 +251,83 @@ static SDL_bool SDL_IsSupportedChannelCount(const int channels)
 }
 
 
-// This does type and channel conversions _but not resampling_ (resampling happens in SDL_AudioStream).
-// This does not check parameter validity, (beyond asserts), it expects you did that already!
-// All of this has to function as if src==dst==scratch (conversion in-place), but as a convenience
-// if you're just going to copy the final output elsewhere, you can specify a different output pointer.
-//
-// The scratch buffer must be able to store `num_frames * CalculateMaxSampleFrameSize(src_format, src_channels, dst_format, dst_channels)` bytes.
-// If the scratch buffer is NULL, this restriction applies to the output buffer instead.
-void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch)
+// Calculate the largest frame size needed to convert between the two formats.
+static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, SDL_AudioFormat dst_format, int dst_channels)
+{
+    const int src_format_size = SDL_AUDIO_BYTESIZE(src_format);
+    const int dst_format_size = SDL_AUDIO_BYTESIZE(dst_format);
+    const int max_app_format_size = SDL_max(src_format_size, dst_format_size);
+    const int max_format_size = SDL_max(max_app_format_size, sizeof (float));  // ConvertAudio and ResampleAudio use floats.
+    const int max_channels = SDL_max(src_channels, dst_channels);
+    return max_format_size * max_channels;
+}
+
+static void AddAudioConvertStep(SDL_AudioConvertPlan *plan, SDL_AudioConvertKernel kernel, SDL_AudioFormat format, int channels)
+{
+    SDL_assert(plan->num_steps < SDL_arraysize(plan->steps));
+    SDL_AudioConvertStep *step = &plan->steps[plan->num_steps++];
+    step->kernel = kernel;
+    step->format = format;
+    step->channels = channels;
+    step->channel_converter = NULL;
+}
+
+/* Type conversion goes like this now:
+    - byteswap to CPU native format first if necessary.
+    - convert to native Float32 if necessary.
+    - apply gain if necessary.
+    - change channel count if necessary.
+    - convert to final data format.
+    - byteswap back to foreign format if necessary.
+
+   The expectation is we can process data faster in float32
+   (possibly with SIMD), and making several passes over the same
+   buffer is likely to be CPU cache-friendly, avoiding the
+   biggest performance hit in modern times. Previously we had
+   (script-generated) custom converters for every data type and
+   it was a bloat on SDL compile times and final library size.
+
+   All the decisions are made here, once, so running the plan is just a few indirect calls. */
+void SDL_BuildAudioConvertPlan(SDL_AudioConvertPlan *plan, SDL_AudioFormat src_format, int src_channels,
+                               SDL_AudioFormat dst_format, int dst_channels, SDL_bool gain)
 {
-    SDL_assert(src != NULL);
-    SDL_assert(dst != NULL);
     SDL_assert(SDL_IsSupportedAudioFormat(src_format));
     SDL_assert(SDL_IsSupportedAudioFormat(dst_format));
     SDL_assert(SDL_IsSupportedChannelCount(src_channels));
     SDL_assert(SDL_IsSupportedChannelCount(dst_channels));
 
-    if (!num_frames) {
-        return;  // no data to convert, quit.
-    }
-
 #if DEBUG_AUDIO_CONVERT
-    SDL_Log("SDL_AUDIO_CONVERT: Convert format %04x->%04x, channels %u->%u", src_format, dst_format, src_channels, dst_channels);
+    SDL_Log("SDL_AUDIO_CONVERT: Planning format %04x->%04x, channels %u->%u, gain %d", src_format, dst_format, src_channels, dst_channels, (int) gain);
 #endif
 
+    plan->src_format = src_format;
+    plan->src_channels = src_channels;
+    plan->dst_format = dst_format;
+    plan->dst_channels = dst_channels;
+    plan->gain = gain;
+    plan->max_frame_size = CalculateMaxFrameSize(src_format, src_channels, dst_format, dst_channels);
+    plan->copy_frame_size = 0;
+    plan->num_steps = 0;
+
     const int src_bitsize = (int) SDL_AUDIO_BITSIZE(src_format);
     const int dst_bitsize = (int) SDL_AUDIO_BITSIZE(dst_format);
 
-    const int dst_sample_frame_size = (dst_bitsize / 8) * dst_channels;
-
-    /* Type conversion goes like this now:
-        - byteswap to CPU native format first if necessary.
-        - convert to native Float32 if necessary.
-        - change channel count if necessary.
-        - convert to final data format.
-        - byteswap back to foreign format if necessary.
-
-       The expectation is we can process data faster in float32
-       (possibly with SIMD), and making several passes over the same
-       buffer is likely to be CPU cache-friendly, avoiding the
-       biggest performance hit in modern times. Previously we had
-       (script-generated) custom converters for every data type and
-       it was a bloat on SDL compile times and final library size. */
-
     // see if we can skip float conversion entirely.
-    if (src_channels == dst_channels) {
-        if (src_format == dst_format) {
-            // nothing to do, we're already in the right format, just copy it over if necessary.
-            if (src != dst) {
-                SDL_memcpy(dst, src, num_frames * dst_sample_frame_size);
-            }
+    if ((src_channels == dst_channels) && !gain) {
+        // nothing to do if we're already in the right format (or just need to byteswap a 1-byte format), just copy it over if necessary.
+        if ((src_format == dst_format) ||
+            ((src_bitsize == 8) && ((src_format & ~SDL_AUDIO_MASK_BIG_ENDIAN) == (dst_format & ~SDL_AUDIO_MASK_BIG_ENDIAN)))) {
+            plan->copy_frame_size = (dst_bitsize / 8) * dst_channels;
             return;
         }
 
         // just a byteswap needed?
         if ((src_format & ~SDL_AUDIO_MASK_BIG_ENDIAN) == (dst_format & ~SDL_AUDIO_MASK_BIG_ENDIAN)) {
-            if (src_bitsize == 8) {
-                if (src != dst) {
-                    SDL_memcpy(dst, src, num_frames * dst_sample_frame_size);
-                }
-                return;  // nothing to do, it's a 1-byte format.
-            }
-            AudioConvertByteswap(dst, src, num_frames * src_channels, src_bitsize);
+            AddAudioConvertStep(plan, AudioConvertStepByteswap, src_format, src_channels);
             return;  // all done.
         }
     }
 
-    if (!scratch) {
-        scratch = dst;
-    }
-
     const SDL_bool srcbyteswap = (SDL_AUDIO_ISBIGENDIAN(src_format) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && (src_bitsize > 8);
     const SDL_bool srcconvert = !SDL_AUDIO_ISFLOAT(src_format);
     const SDL_bool channelconvert = src_channels != dst_channels;
@@ -290,77 +336,162 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
 
     // make sure we're in native byte order.
     if (srcbyteswap) {
-        // No point writing straight to dst. If we only need a byteswap, we wouldn't be bere.
-        AudioConvertByteswap(scratch, src, num_frames * src_channels, src_bitsize);
-        src = scratch;
-    }
-
-    // get us to float format.
-    if (srcconvert) {
-        void* buf = (channelconvert || dstconvert || dstbyteswap) ? scratch : dst;
-        AudioConvertToFloat((float *) buf, src, num_frames * src_channels, src_format);
-        src = buf;
+        AddAudioConvertStep(plan, AudioConvertStepByteswap, src_format, src_channels);
     }
 
-    // Channel conversion
-
-    if (channelconvert) {
-        SDL_AudioChannelConverter channel_converter;
-        SDL_AudioChannelConverter override = NULL;
+    if (srcconvert && (src_bitsize == 16) && (src_channels == 2) && (dst_channels == 1)) {
+        // get us to float format, apply gain and downmix all at once.
+        AddAudioConvertStep(plan, AudioConvertStep_S16Stereo_to_F32Mono, src_format, src_channels);
+    } else {
+        // get us to float format.
+        if (srcconvert) {
+            SDL_AudioConvertKernel kernel = NULL;
+            switch (src_format & ~SDL_AUDIO_MASK_BIG_ENDIAN) {
+                case SDL_AUDIO_S8: kernel = AudioConvertStep_S8_to_F32; break;
+                case SDL_AUDIO_U8: kernel = AudioConvertStep_U8_to_F32; break;
+                case SDL_AUDIO_S16LE: kernel = AudioConvertStep_S16_to_F32; break;
+                case SDL_AUDIO_S32LE: kernel = AudioConvertStep_S32_to_F32; break;
+                default: SDL_assert(!"Unexpected audio format!"); break;
+            }
+            AddAudioConvertStep(plan, kernel, src_format, src_channels);
+        }
 
-        // SDL_IsSupportedChannelCount should have caught these asserts, or we added a new format and forgot to update the table.
-        SDL_assert(src_channels <= SDL_arraysize(channel_converters));
-        SDL_assert(dst_channels <= SDL_arraysize(channel_converters[0]));
+        // Gain adjustment
+        if (gain) {
+            AddAudioConvertStep(plan, AudioConvertStepGain, SDL_AUDIO_F32, src_channels);
+        }
 
-        channel_converter = channel_converters[src_channels - 1][dst_channels - 1];
-        SDL_assert(channel_converter != NULL);
+        // Channel conversion
+        if (channelconvert) {
+            SDL_AudioChannelConverter channel_converter;
+            SDL_AudioChannelConverter override = NULL;
+
+            // SDL_IsSupportedChannelCount should have caught these asserts, or we added a new format and forgot to update the table.
+            SDL_assert(src_channels <= SDL_arraysize(channel_converters));
+            SDL_assert(dst_channels <= SDL_arraysize(channel_converters[0]));
+
+            channel_converter = channel_converters[src_channels - 1][dst_channels - 1];
+            SDL_assert(channel_converter != NULL);
+
+            // swap in some SIMD versions for a few of these.
+            if (channel_converter == SDL_ConvertStereoToMono) {
+                #ifdef SDL_SSE3_INTRINSICS
+                if (!override && SDL_HasSSE3()) { override = SDL_ConvertStereoToMono_SSE3; }
+                #endif
+            } else if (channel_converter == SDL_ConvertMonoToStereo) {
+                #ifdef SDL_SSE_INTRINSICS
+                if (!override && SDL_HasSSE()) { override = SDL_ConvertMonoToStereo_SSE; }
+                #endif
+            }
 
-        // swap in some SIMD versions for a few of these.
-        if (channel_converter == SDL_ConvertStereoToMono) {
-            #ifdef SDL_SSE3_INTRINSICS
-            if (!override && SDL_HasSSE3()) { override = SDL_ConvertStereoToMono_SSE3; }
-            #endif
-        } else if (channel_converter == SDL_ConvertMonoToStereo) {
-            #ifdef SDL_SSE_INTRINSICS
-            if (!override && SDL_HasSSE()) { override = SDL_ConvertMonoToStereo_SSE; }
-            #endif
-        }
+            if (override) {
+                channel_converter = override;
+            }
 
-        if (override) {
-            channel_converter = override;
+            AddAudioConvertStep(plan, AudioConvertStepChannels, SDL_AUDIO_F32, src_channels);
+            plan->steps[plan->num_steps - 1].channel_converter = channel_converter;
         }
-
-        void* buf = (dstconvert || dstbyteswap) ? scratch : dst;
-        channel_converter((float *) buf, (const float *) src, num_frames);
-        src = buf;
     }
 
     // Resampling is not done in here. SDL_AudioStream handles that.
 
     // Move to final data type.
     if (dstconvert) {
-        AudioConvertFromFloat(dst, (const float *) src, num_frames * dst_channels, dst_format);
-        src = dst;
+        SDL_AudioConvertKernel kernel = NULL;
+        switch (dst_format & ~SDL_AUDIO_MASK_BIG_ENDIAN) {
+            case SDL_AUDIO_S8: kernel = AudioConvertStep_F32_to_S8; break;
+            case SDL_AUDIO_U8: kernel = AudioConvertStep_F32_to_U8; break;
+            case SDL_AUDIO_S16LE: kernel = AudioConvertStep_F32_to_S16; break;
+            case SDL_AUDIO_S32LE: kernel = AudioConvertStep_F32_to_S32; break;
+            default: SDL_assert(!"Unexpected audio format!"); break;
+        }
+        AddAudioConvertStep(plan, kernel, dst_format, dst_channels);
     }
 
     // make sure we're in final byte order.
     if (dstbyteswap) {
-        AudioConvertByteswap(dst, src, num_frames * dst_channels, dst_bitsize);
-        src = dst;  // we've written to dst, future work will convert in-place.
+        AddAudioConvertStep(plan, AudioConvertStepByteswap, dst_format, dst_channels);
     }
 
-    SDL_assert(src == dst);  // if we got here, we _had_ to have done _something_. Otherwise, we should have memcpy'd!
+    SDL_assert(plan->num_steps > 0);  // if we got here, we _had_ to have done _something_. Otherwise, we should have memcpy'd!
 }
 
-// Calculate the largest frame size needed to convert between the two formats.
-static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, SDL_AudioFormat dst_format, int dst_channels)
+// All of this has to function as if src==dst==scratch (conversion in-place), but as a convenience
+// if you're just going to copy the final output elsewhere, you can specify a different output pointer.
+//
+// The scratch buffer must be able to store `num_frames * plan->max_frame_size` bytes.
+// If the scratch buffer is NULL, this restriction applies to the output buffer instead.
+void SDL_RunAudioConvertPlan(const SDL_AudioConvertPlan *plan, int num_frames, const void *src, void *dst, void *scratch, float gain)
 {
-    const int src_format_size = SDL_AUDIO_BYTESIZE(src_format);
-    const int dst_format_size = SDL_AUDIO_BYTESIZE(dst_format);
-    const int max_app_format_size = SDL_max(src_format_size, dst_format_size);
-    const int max_format_size = SDL_max(max_app_format_size, sizeof (float));  // ConvertAudio and ResampleAudio use floats.
-    const int max_channels = SDL_max(src_channels, dst_channels);
-    return max_format_size * max_channels;
+    SDL_assert(src != NULL);
+    SDL_assert(dst != NULL);
+    SDL_assert(plan->gain || (gain == 1.0f));
+
+    if (!num_frames) {
+        return;  // no data to convert, quit.
+    }
+
+    const int last_step = plan->num_steps - 1;
+
+    if (last_step < 0) {
+        if (src != dst) {
+            SDL_memcpy(dst, src, num_frames * plan->copy_frame_size);
+        }
+        return;
+    }
+
+    if (!scratch) {
+        scratch = dst;
+    }
+
+    // Everything goes through the scratch buffer, except the last step, which writes the output.
+    for (int i = 0; i < last_step; i++) {
+        plan->steps[i].kernel(&plan->steps[i], scratch, src, num_frames, gain);
+        src = scratch;
+    }
+
+    plan->steps[last_step].kernel(&plan->steps[last_step], dst, src, num_frames, gain);
+}
+
+// This does type and channel conversions _but not resampling_ (resampling happens in SDL_AudioStream).
+// If `gain` isn't 1.0f, it is applied while the data is in float format.
+// This does not check parameter validity, (beyond asserts), it expects you did that already!
+// See SDL_RunAudioConvertPlan for the rules on `dst` and `scratch`; things that convert the
+// same formats over and over should build a plan once and run that instead.
+void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
+                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, float gain)
+{
+    SDL_AudioConvertPlan plan;
+    SDL_BuildAudioConvertPlan(&plan, src_format, src_channels, dst_format, dst_channels, gain != 1.0f);
+    SDL_RunAudioConvertPlan(&plan, num_frames, src, dst, scratch, gain);
+}
+
+// Get a conversion plan, rebuilding it only if the formats have changed since it was last used.
+static const SDL_AudioConvertPlan *GetAudioConvertPlan(SDL_AudioConvertPlan *plan, SDL_AudioFormat src_format, int src_channels,
+                                                       SDL_AudioFormat dst_format, int dst_channels, SDL_bool gain)
+{
+    if ((plan->src_format != src_format) || (plan->src_channels != src_channels) ||
+        (plan->dst_format != dst_format) || (plan->dst_channels != dst_channels) || (plan->gain != gain)) {
+        SDL_BuildAudioConvertPlan(plan, src_format, src_channels, dst_format, dst_channels, gain);
+    }
+    return plan;
+}
+
+// Build the plans a stream will need for its current formats, so the audio thread doesn't have to.
+static void UpdateAudioStreamConvertPlans(SDL_AudioStream *stream)
+{
+    const SDL_AudioSpec *src_spec = &stream->input_spec;
+    const SDL_AudioSpec *dst_spec = &stream->dst_spec;
+
+    if (!src_spec->format || !dst_spec->format) {
+        return;  // not set up yet.
+    }
+
+    // Streams bound to a device apply their gain while mixing, so plan for no gain here.
+    const int resample_channels = SDL_min(src_spec->channels, dst_spec->channels);
+    GetAudioConvertPlan(&stream->convert_plan, src_spec->format, src_spec->channels, dst_spec->format, dst_spec->channels, SDL_FALSE);
+    GetAudioConvertPlan(&stream->resample_input_plan, src_spec->format, src_spec->channels, SDL_AUDIO_F32, resample_channels, SDL_FALSE);
+    GetAudioConvertPlan(&stream->resample_output_plan, SDL_AUDIO_F32, resample_channels, dst_spec->format, dst_spec->channels, SDL_FALSE);
 }
 
 static Sint64 GetAudioStreamResampleRate(SDL_AudioStream* stream, int src_freq, Sint64 resample_offset)
@@ -383,7 +514,8 @@ static int UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSp
         return 0;
     }
 
-    const size_t history_buffer_allocation = SDL_GetResamplerHistoryFrames() * SDL_AUDIO_FRAMESIZE(*spec);
+    // Allocate enough history for any resampler quality, so it can be changed without reallocating.
+    const size_t history_buffer_allocation = SDL_GetResamplerMaxHistoryFrames() * SDL_AUDIO_FRAMESIZE(*spec);
     Uint8 *history_buffer = stream->history_buffer;
 
     if (stream->history_buffer_allocation < history_buffer_allocation) {
@@ -398,21 +530,29 @@ static int UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSp
 
     SDL_memset(history_buffer, SDL_GetSilenceValueForFormat(spec->format), history_buffer_allocation);
     SDL_copyp(&stream->input_spec, spec);
+    UpdateAudioStreamConvertPlans(stream);
 
     return 0;
 }
 
-SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+static SDL_AudioStream *CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, SDL_bool lock_free)
 {
     SDL_ChooseAudioConverters();
     SDL_SetupAudioResampler();
 
+    if (lock_free && !src_spec) {
+        SDL_InvalidParamError("src_spec");
+        return NULL;
+    }
+
     SDL_AudioStream *retval = (SDL_AudioStream *)SDL_calloc(1, sizeof(SDL_AudioStream));
     if (!retval) {
         return NULL;
     }
 
     retval->freq_ratio = 1.0f;
+    retval->gain = 1.0f;
+    retval->resampler_quality = SDL_AUDIO_RESAMPLER_SINC_HIGH;
     retval->queue = SDL_CreateAudioQueue(4096);
 
     if (!retval->queue) {
@@ -420,7 +560,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
         return NULL;
     }
 
-    retval->lock = SDL_CreateMutex();
+    retval->lock = SDL_CreateAudioMutex();
     if (!retval->lock) {
         SDL_free(retval->queue);
         SDL_free(retval);
@@ -434,9 +574,26 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
         return NULL;
     }
 
+    // Set this last, so SDL_SetAudioStreamFormat above is still allowed to set the input format.
+    retval->lock_free = lock_free;
+
     return retval;
 }
 
+SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+{
+    return CreateAudioStream(src_spec, dst_spec, SDL_FALSE);
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamWithProperties(SDL_PropertiesID props)
+{
+    const SDL_AudioSpec *src_spec = (const SDL_AudioSpec *)SDL_GetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER, NULL);
+    const SDL_AudioSpec *dst_spec = (const SDL_AudioSpec *)SDL_GetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER, NULL);
+    const SDL_bool lock_free = SDL_GetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN, SDL_FALSE);
+
+    return CreateAudioStream(src_spec, dst_spec, lock_free);
+}
+
 SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -449,6 +606,14 @@ SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
     return stream->props;
 }
 
+// Let the bound device know the stream has something new for it. The stream lock must be held.
+static void AudioStreamDataChanged(SDL_AudioStream *stream)
+{
+    if (stream->bound_device) {
+        SDL_AudioDeviceStreamsChanged(stream->bound_device->physical_device);
+    }
+}
+
 int SDL_SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata)
 {
     if (!stream) {
@@ -457,6 +622,7 @@ int SDL_SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallba
     SDL_LockMutex(stream->lock);
     stream->get_callback = callback;
     stream->get_callback_userdata = userdata;
+    AudioStreamDataChanged(stream);
     SDL_UnlockMutex(stream->lock);
     return 0;
 }
@@ -469,6 +635,7 @@ int SDL_SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallba
     SDL_LockMutex(stream->lock);
     stream->put_callback = callback;
     stream->put_callback_userdata = userdata;
+    SDL_AtomicSet(&stream->has_put_callback, callback ? 1 : 0);
     SDL_UnlockMutex(stream->lock);
     return 0;
 }
@@ -555,6 +722,12 @@ int SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_s
 
     SDL_LockMutex(stream->lock);
 
+    // The producer of a lock-free stream writes without the lock, so it can't know about a new input format.
+    if (stream->lock_free && src_spec && !AUDIO_SPECS_EQUAL(stream->src_spec, *src_spec)) {
+        SDL_UnlockMutex(stream->lock);
+        return SDL_SetError("Can't change the input format of a lock-free audio stream");
+    }
+
     // quietly refuse to change the format of the end currently bound to a device.
     if (stream->bound_device) {
         if (stream->bound_device->physical_device->iscapture) {
@@ -570,6 +743,7 @@ int SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_s
 
     if (dst_spec) {
         SDL_copyp(&stream->dst_spec, dst_spec);
+        UpdateAudioStreamConvertPlans(stream);
     }
 
     SDL_UnlockMutex(stream->lock);
@@ -614,6 +788,105 @@ int SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
     return 0;
 }
 
+SDL_AudioResamplerQuality SDL_GetAudioStreamResamplerQuality(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return (SDL_AudioResamplerQuality)-1;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const SDL_AudioResamplerQuality quality = stream->resampler_quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return quality;
+}
+
+int SDL_SetAudioStreamResamplerQuality(SDL_AudioStream *stream, SDL_AudioResamplerQuality quality)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if ((int)quality < SDL_AUDIO_RESAMPLER_LINEAR || quality > SDL_AUDIO_RESAMPLER_SINC_HIGH) {
+        return SDL_InvalidParamError("quality");
+    }
+
+    SDL_LockMutex(stream->lock);
+
+    // The history buffer only tracks as many frames as the current quality needs, newest last.
+    // Keep the newest frames in place, and pad with silence if the new quality needs more.
+    if (stream->input_spec.format) {
+        const int frame_size = SDL_AUDIO_FRAMESIZE(stream->input_spec);
+        const int old_bytes = SDL_GetResamplerHistoryFrames(stream->resampler_quality) * frame_size;
+        const int new_bytes = SDL_GetResamplerHistoryFrames(quality) * frame_size;
+        Uint8 *history_buffer = stream->history_buffer;
+
+        SDL_assert((size_t)SDL_max(old_bytes, new_bytes) <= stream->history_buffer_allocation);
+
+        if (new_bytes < old_bytes) {
+            SDL_memmove(history_buffer, history_buffer + (old_bytes - new_bytes), new_bytes);
+        } else if (new_bytes > old_bytes) {
+            SDL_memmove(history_buffer + (new_bytes - old_bytes), history_buffer, old_bytes);
+            SDL_memset(history_buffer, SDL_GetSilenceValueForFormat(stream->input_spec.format), new_bytes - old_bytes);
+        }
+    }
+
+    stream->resampler_quality = quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+float SDL_GetAudioStreamGain(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return -1.0f;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const float gain = stream->gain;
+    SDL_UnlockMutex(stream->lock);
+
+    return gain;
+}
+
+int SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (gain < 0.0f) {
+        return SDL_InvalidParamError("gain");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->gain = gain;
+    stream->gain_ramp_frames = 0;  // cancel any ramp in progress.
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+int SDL_SetAudioStreamGainRamp(SDL_AudioStream *stream, float gain, int num_frames)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (gain < 0.0f) {
+        return SDL_InvalidParamError("gain");
+    } else if (num_frames < 0) {
+        return SDL_InvalidParamError("num_frames");
+    }
+
+    SDL_LockMutex(stream->lock);
+    if (num_frames == 0) {
+        stream->gain = gain;
+    }
+    stream->gain_ramp_target = gain;
+    stream->gain_ramp_frames = num_frames;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
 static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == 0) {
@@ -625,6 +898,71 @@ static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
     return 0;
 }
 
+static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, Sint64 *out_resample_offset);
+
+// Move anything a capture device published without the lock into the queue. The stream lock must be held.
+static void TakePublishedAudioStreamTracks(SDL_AudioStream *stream)
+{
+    if (!SDL_AtomicGetPtr(&stream->published_tracks)) {
+        return;  // the usual case.
+    }
+
+    const SDL_bool notify = (stream->put_callback && CheckAudioStreamIsFullySetup(stream) == 0);
+    const Sint64 prev_available = notify ? GetAudioStreamAvailableFrames(stream, NULL) : 0;
+
+    SDL_AddAudioTrackListToQueue(stream->queue, &stream->published_tracks);
+
+    if (notify) {
+        const Sint64 newavail = (GetAudioStreamAvailableFrames(stream, NULL) - prev_available) * SDL_AUDIO_FRAMESIZE(stream->dst_spec);
+        stream->put_callback(stream->put_callback_userdata, stream, (int) SDL_min(newavail, SDL_INT_MAX), (int) SDL_min(newavail, SDL_INT_MAX));
+    }
+}
+
+void PublishAudioStreamTrack(SDL_AudioStream *stream, SDL_AudioTrack *track)
+{
+    SDL_PushAudioTrackList(&stream->published_tracks, track);
+
+    // If nobody is using the stream right now, queue it straight away, so a put callback hears about it promptly.
+    // Otherwise, whoever has the stream locked will pick it up next time they touch it.
+    if (SDL_TryLockMutex(stream->lock) == 0) {
+        TakePublishedAudioStreamTracks(stream);
+        SDL_UnlockMutex(stream->lock);
+    }
+}
+
+// The producer of a lock-free stream only takes the lock to start a new track, which is needed
+// for the first put, and the first put after a flush or clear. Everything else goes straight in.
+// Formats can be set but never unset, so a stream that was fully set up for the track still is.
+static int PutLockFreeAudioStreamData(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    SDL_AudioTrack *track = stream->lock_free_track;
+
+    if (!track) {
+        SDL_LockMutex(stream->lock);
+
+        if (CheckAudioStreamIsFullySetup(stream) != 0) {
+            SDL_UnlockMutex(stream->lock);
+            return -1;
+        }
+
+        track = SDL_CreateLockFreeAudioTrack(&stream->src_spec, SDL_GetAudioQueueChunkSize(stream->queue));
+
+        if (!track) {
+            SDL_UnlockMutex(stream->lock);
+            return -1;
+        }
+
+        SDL_AddTrackToAudioQueue(stream->queue, track);
+        stream->lock_free_track = track;
+        SDL_UnlockMutex(stream->lock);
+
+        // Writes after this one don't take the lock, so they can't tell the device about themselves; the lock
+        // isn't held here either, so this can't safely look at stream->bound_device. Waiters have to time out.
+    }
+
+    return SDL_WriteToLockFreeAudioTrack(track, buf, len);
+}
+
 int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
 {
 #if DEBUG_AUDIOSTREAM
@@ -641,8 +979,19 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return 0; // nothing to do.
     }
 
+    // src_spec can't change on a lock-free stream, so it's safe to look at without the lock.
+    // If a put callback gets set while we're here, it hears about the next put.
+    if (stream->lock_free && !SDL_AtomicGet(&stream->has_put_callback)) {
+        if ((len % SDL_AUDIO_FRAMESIZE(stream->src_spec)) != 0) {
+            return SDL_SetError("Can't add partial sample frames");
+        }
+        return PutLockFreeAudioStreamData(stream, (const Uint8 *)buf, len);
+    }
+
     SDL_LockMutex(stream->lock);
 
+    TakePublishedAudioStreamTracks(stream);  // anything captured so far goes before this.
+
     if (CheckAudioStreamIsFullySetup(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
         return -1;
@@ -659,7 +1008,7 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 1024 * 1024;
 
-    if (len >= large_input_thresh) {
+    if ((len >= large_input_thresh) && !stream->lock_free) {
         SDL_AudioSpec src_spec;
         SDL_copyp(&src_spec, &stream->src_spec);
 
@@ -681,16 +1030,18 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
 
     if (track) {
         SDL_AddTrackToAudioQueue(stream->queue, track);
+    } else if (stream->lock_free) {
+        retval = PutLockFreeAudioStreamData(stream, (const Uint8 *)buf, len);
     } else {
         retval = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, buf, len);
     }
 
     if (retval == 0) {
-        stream->total_bytes_queued += len;
         if (stream->put_callback) {
             const int newavail = SDL_GetAudioStreamAvailable(stream) - prev_available;
             stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
         }
+        AudioStreamDataChanged(stream);
     }
 
     SDL_UnlockMutex(stream->lock);
@@ -698,6 +1049,64 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     return retval;
 }
 
+int SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: wants to put %d bytes without copying", len);
+#endif
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (stream->lock_free) {
+        // This would end the producer's track while it might be writing to it without the lock.
+        return SDL_SetError("Can't add data without copying to a lock-free stream");
+    } else if (len == 0) {
+        if (callback) {
+            callback(userdata, buf, len);  // nothing to do, so we're already done with it.
+        }
+        return 0;
+    }
+
+    SDL_LockMutex(stream->lock);
+
+    TakePublishedAudioStreamTracks(stream);  // anything captured so far goes before this.
+
+    if (CheckAudioStreamIsFullySetup(stream) != 0) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    if ((len % SDL_AUDIO_FRAMESIZE(stream->src_spec)) != 0) {
+        SDL_UnlockMutex(stream->lock);
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    SDL_AudioTrack *track = SDL_CreateReferencedAudioTrack(&stream->src_spec, (const Uint8 *)buf, len, callback, userdata);
+
+    if (!track) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    const int prev_available = stream->put_callback ? SDL_GetAudioStreamAvailable(stream) : 0;
+
+    SDL_AddTrackToAudioQueue(stream->queue, track);
+
+    if (stream->put_callback) {
+        const int newavail = SDL_GetAudioStreamAvailable(stream) - prev_available;
+        stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
+    }
+    AudioStreamDataChanged(stream);
+
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
 int SDL_FlushAudioStream(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -705,7 +1114,10 @@ int SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    TakePublishedAudioStreamTracks(stream);
     SDL_FlushAudioQueue(stream->queue);
+    stream->lock_free_track = NULL;  // the next put starts a new track.
+    AudioStreamDataChanged(stream);
     SDL_UnlockMutex(stream->lock);
 
     return 0;
@@ -733,7 +1145,7 @@ static Uint8 *EnsureAudioStreamWorkBufferSize(SDL_AudioStream *stream, size_t ne
 static void UpdateAudioStreamHistoryBuffer(SDL_AudioStream* stream,
     Uint8* input_buffer, int input_bytes, Uint8* left_padding, int padding_bytes)
 {
-    const int history_buffer_frames = SDL_GetResamplerHistoryFrames();
+    const int history_buffer_frames = SDL_GetResamplerHistoryFrames(stream->resampler_quality);
 
     // Even if we aren't currently resampling, we always need to update the history buffer
     Uint8 *history_buffer = stream->history_buffer;
@@ -786,7 +1198,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resampler_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -843,9 +1255,41 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream* stream, SDL_AudioSpec* out_spe
     return NextAudioStreamIter(stream, &iter, &resample_offset, out_spec, out_flushed);
 }
 
+// Scale float32 output frames by the stream's gain ramp, advancing the ramp. Frames past the end of the ramp get the final gain.
+static void ApplyAudioStreamGainRamp(SDL_AudioStream *stream, float *buf, int num_frames, int channels)
+{
+    SDL_assert(stream->gain_ramp_frames > 0);
+
+    const int ramp_frames = SDL_min(num_frames, stream->gain_ramp_frames);
+    const float step = (stream->gain_ramp_target - stream->gain) / (float) stream->gain_ramp_frames;
+    float gain = stream->gain;
+    int i = 0;
+
+    for (; i < ramp_frames; i++) {
+        gain += step;
+        for (int chan = 0; chan < channels; chan++) {
+            *(buf++) *= gain;
+        }
+    }
+
+    stream->gain_ramp_frames -= ramp_frames;
+
+    if (stream->gain_ramp_frames == 0) {
+        gain = stream->gain_ramp_target;  // don't let rounding errors accumulate past the end of the ramp.
+        if (gain != 1.0f) {
+            for (int j = (num_frames - i) * channels; j > 0; j--) {
+                *(buf++) *= gain;
+            }
+        }
+    }
+
+    stream->gain = gain;
+}
+
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
-static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames)
+// `gain` is applied to the output, unless the stream is ramping its gain, in which case the ramp is applied instead.
+static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain)
 {
     const SDL_AudioSpec* src_spec = &stream->input_spec;
     const SDL_AudioSpec* dst_spec = &stream->dst_spec;
@@ -857,7 +1301,6 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     const SDL_AudioFormat dst_format = dst_spec->format;
     const int dst_channels = dst_spec->channels;
 
-    const int max_frame_size = CalculateMaxFrameSize(src_format, src_channels, dst_format, dst_channels);
     const Sint64 resample_rate = GetAudioStreamResampleRate(stream, src_spec->freq, stream->resample_offset);
 
 #if DEBUG_AUDIOSTREAM
@@ -866,6 +1309,15 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     SDL_assert(output_frames > 0);
 
+    const SDL_bool ramping = (stream->gain_ramp_frames > 0);
+    if (ramping) {
+        gain = 1.0f;
+    }
+
+    // The plans only change when the formats do, so this is almost always just a few comparisons.
+    const SDL_AudioConvertPlan *convert_plan = GetAudioConvertPlan(&stream->convert_plan, src_format, src_channels, dst_format, dst_channels, gain != 1.0f);
+    const int max_frame_size = convert_plan->max_frame_size;
+
     // Not resampling? It's an easy conversion (and maybe not even that!)
     if (resample_rate == 0) {
         Uint8* input_buffer = NULL;
@@ -873,7 +1325,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
         // If no conversion is happening, read straight into the output buffer.
         // Note, this is just to avoid extra copies.
         // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-        if ((src_format == dst_format) && (src_channels == dst_channels)) {
+        if ((src_format == dst_format) && (src_channels == dst_channels) && (gain == 1.0f) && !ramping) {
             input_buffer = buf;
         } else {
             input_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
@@ -888,14 +1340,16 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
             SDL_assert(!"Not enough data in queue (read)");
         }
 
-        stream->total_bytes_queued -= input_bytes;
-
         // Even if we aren't currently resampling, we always need to update the history buffer
         UpdateAudioStreamHistoryBuffer(stream, input_buffer, input_bytes, NULL, 0);
 
-        // Convert the data, if necessary
-        if (buf != input_buffer) {
-            ConvertAudio(output_frames, input_buffer, src_format, src_channels, buf, dst_format, dst_channels, input_buffer);
+        // Ramps are applied per-frame while the data is in float format, in-place in the work buffer.
+        if (ramping) {
+            ConvertAudio(output_frames, input_buffer, src_format, src_channels, input_buffer, SDL_AUDIO_F32, dst_channels, NULL, 1.0f);
+            ApplyAudioStreamGainRamp(stream, (float *) input_buffer, output_frames, dst_channels);
+            ConvertAudio(output_frames, input_buffer, SDL_AUDIO_F32, dst_channels, buf, dst_format, dst_channels, input_buffer, 1.0f);
+        } else if (buf != input_buffer) {  // Convert the data, if necessary
+            SDL_RunAudioConvertPlan(convert_plan, output_frames, input_buffer, buf, input_buffer, gain);
         }
 
         return 0;
@@ -909,7 +1363,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
     const int input_bytes = input_frames * src_frame_size;
 
-    const int resampler_padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int resampler_padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resampler_quality);
 
     // If increasing channels, do it after resampling, since we'd just
     // do more work to resample duplicate channels. If we're decreasing, do
@@ -978,7 +1432,6 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     if (SDL_ReadFromAudioQueue(stream->queue, input_buffer, input_bytes) != 0) {
         SDL_assert(!"Not enough data in queue (resample read)");
     }
-    stream->total_bytes_queued -= input_bytes;
 
     // Update the history buffer and fill in the left padding
     UpdateAudioStreamHistoryBuffer(stream, input_buffer, input_bytes, left_padding, padding_bytes);
@@ -991,7 +1444,8 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     SDL_assert(work_buffer_frames == input_frames + (resampler_padding_frames * 2));
 
     // Resampling! get the work buffer to float32 format, etc, in-place.
-    ConvertAudio(work_buffer_frames, work_buffer, src_format, src_channels, work_buffer, SDL_AUDIO_F32, resample_channels, NULL);
+    const SDL_AudioConvertPlan *resample_input_plan = GetAudioConvertPlan(&stream->resample_input_plan, src_format, src_channels, SDL_AUDIO_F32, resample_channels, gain != 1.0f);
+    SDL_RunAudioConvertPlan(resample_input_plan, work_buffer_frames, work_buffer, work_buffer, NULL, gain);
 
     // Update the work_buffer pointers based on the new frame size
     input_buffer = work_buffer + ((input_buffer - work_buffer) / src_frame_size * resample_frame_size);
@@ -1004,18 +1458,23 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resampler_quality);
+
+    if (ramping) {
+        ApplyAudioStreamGainRamp(stream, (float *) resample_buffer, output_frames, resample_channels);
+    }
 
     // Convert to the final format, if necessary
     if (buf != resample_buffer) {
-        ConvertAudio(output_frames, resample_buffer, SDL_AUDIO_F32, resample_channels, buf, dst_format, dst_channels, work_buffer);
+        const SDL_AudioConvertPlan *resample_output_plan = GetAudioConvertPlan(&stream->resample_output_plan, SDL_AUDIO_F32, resample_channels, dst_format, dst_channels, SDL_FALSE);
+        SDL_RunAudioConvertPlan(resample_output_plan, output_frames, resample_buffer, buf, work_buffer, 1.0f);
     }
 
     return 0;
 }
 
-// get converted/resampled data from the stream
-int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
+// get converted/resampled data from the stream. If `out_gain` is non-NULL, the stream's gain is reported there instead of being applied.
+static int GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len, float *out_gain)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
@@ -1035,6 +1494,8 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 
     SDL_LockMutex(stream->lock);
 
+    TakePublishedAudioStreamTracks(stream);
+
     if (CheckAudioStreamIsFullySetup(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
         return -1;
@@ -1066,6 +1527,18 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
     }
 
+    // the callback might have changed the gain, so don't look at it until now.
+    // A gain ramp changes per-frame, so the caller can't apply that for us; we'll do it here.
+    SDL_bool apply_gain = SDL_TRUE;
+    if (out_gain) {
+        if (stream->gain_ramp_frames > 0) {
+            *out_gain = 1.0f;
+        } else {
+            *out_gain = stream->gain;
+            apply_gain = SDL_FALSE;
+        }
+    }
+
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
     const int chunk_size = 4096;
 
@@ -1080,6 +1553,7 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         if (available_frames == 0) {
             if (flushed) {
                 SDL_PopAudioQueueHead(stream->queue);
+                stream->drained = (SDL_BeginAudioQueueIter(stream->queue) == NULL);
                 SDL_zero(stream->input_spec);
                 stream->resample_offset = 0;
                 continue;
@@ -1099,7 +1573,8 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (GetAudioStreamDataInternal(stream, &buf[total], output_frames) != 0) {
+        // (a gain ramp might have finished in a previous chunk, so check the gain every time.)
+        if (GetAudioStreamDataInternal(stream, &buf[total], output_frames, apply_gain ? stream->gain : 1.0f) != 0) {
             total = total ? total : -1;
             break;
         }
@@ -1116,6 +1591,45 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
     return total;
 }
 
+int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *buf, int len)
+{
+    return GetAudioStreamData(stream, buf, len, NULL);
+}
+
+int GetAudioStreamDataForMixing(SDL_AudioStream *stream, float *buf, int len, float *gain)
+{
+    SDL_assert(gain != NULL);
+    return GetAudioStreamData(stream, buf, len, gain);
+}
+
+SDL_AudioStreamReadiness GetAudioStreamReadiness(SDL_AudioStream *stream, int frames)
+{
+    SDL_AudioStreamReadiness retval = SDL_AUDIOSTREAM_WAITING;
+
+    SDL_LockMutex(stream->lock);
+
+    TakePublishedAudioStreamTracks(stream);
+
+    if (CheckAudioStreamIsFullySetup(stream) == 0) {
+        if (stream->get_callback) {
+            retval = SDL_AUDIOSTREAM_READY;
+        } else {
+            const Sint64 available = GetAudioStreamAvailableFrames(stream, NULL);
+            const SDL_bool empty = (SDL_BeginAudioQueueIter(stream->queue) == NULL);
+            const SDL_bool flushed = SDL_IsAudioQueueFlushed(stream->queue);
+            if ((available >= frames) || ((available > 0) && flushed)) {
+                retval = SDL_AUDIOSTREAM_READY;
+            } else if ((available == 0) && (flushed || (empty && stream->drained))) {
+                retval = SDL_AUDIOSTREAM_DRAINED;
+            }
+        }
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
 // number of converted/resampled bytes available for output
 int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
 {
@@ -1125,6 +1639,8 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    TakePublishedAudioStreamTracks(stream);
+
     if (CheckAudioStreamIsFullySetup(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
         return 0;
@@ -1149,7 +1665,8 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
-    const Uint64 total = stream->total_bytes_queued;
+    TakePublishedAudioStreamTracks(stream);
+    const size_t total = SDL_GetAudioQueueQueued(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
     // if this overflows an int, just clamp it to a maximum.
@@ -1164,10 +1681,12 @@ int SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    SDL_AddAudioTrackListToQueue(stream->queue, &stream->published_tracks);  // so it gets cleared, too.
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->resample_offset = 0;
-    stream->total_bytes_queued = 0;
+    stream->lock_free_track = NULL;
+    stream->drained = SDL_FALSE;  // there's nothing to have played out; wait for the app to put something again.
 
     SDL_UnlockMutex(stream->lock);
     return 0;
@@ -1195,7 +1714,9 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
 
     SDL_aligned_free(stream->history_buffer);
     SDL_aligned_free(stream->work_buffer);
+    SDL_AddAudioTrackListToQueue(stream->queue, &stream->published_tracks);  // it's unbound now, so nothing else can be published.
     SDL_DestroyAudioQueue(stream->queue);
+    SDL_DestroyRecyclableAudioTracks(&stream->spare_capture_tracks, &stream->recycled_capture_tracks);  // after the queue, which hands its tracks back.
     SDL_DestroyMutex(stream->lock);
 
     SDL_free(stream);
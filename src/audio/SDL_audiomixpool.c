@@ -0,0 +1,147 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_audiomixpool.h"
+#include "../thread/SDL_systhread.h"
+
+struct SDL_AudioMixPool
+{
+    SDL_Thread **threads;
+    int num_threads;
+
+    SDL_Semaphore *start;  // posted once per worker to start a batch of jobs.
+    SDL_Semaphore *done;   // posted once by each worker when it runs out of jobs.
+    SDL_AtomicInt shutdown;
+
+    // The current batch. Only changed while all the workers are waiting on `start`.
+    SDL_AudioMixPoolFunc job;
+    void *userdata;
+    int num_jobs;
+    SDL_AtomicInt next_job;
+};
+
+static void RunAudioMixJobs(SDL_AudioMixPool *pool)
+{
+    for (;;) {
+        const int index = SDL_AtomicAdd(&pool->next_job, 1);
+        if (index >= pool->num_jobs) {
+            break;
+        }
+        pool->job(pool->userdata, index);
+    }
+}
+
+static int SDLCALL AudioMixPoolThread(void *data)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *)data;
+
+    // These do the same work as the device thread, so they need the same priority.
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+    SDL_SetThreadAffinityFromHint(SDL_HINT_THREAD_AFFINITY_AUDIO);
+
+    for (;;) {
+        SDL_WaitSemaphore(pool->start);
+        if (SDL_AtomicGet(&pool->shutdown)) {
+            break;
+        }
+        RunAudioMixJobs(pool);
+        SDL_PostSemaphore(pool->done);
+    }
+
+    return 0;
+}
+
+SDL_AudioMixPool *SDL_CreateAudioMixPool(const char *name, int num_threads)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *)SDL_calloc(1, sizeof(*pool));
+    int i;
+
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(SDL_Thread *));
+    pool->start = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+
+    if (!pool->threads || !pool->start || !pool->done) {
+        SDL_DestroyAudioMixPool(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        char threadname[64];
+        (void)SDL_snprintf(threadname, sizeof(threadname), "%sMix%d", name, i);
+        pool->threads[i] = SDL_CreateThreadInternal(AudioMixPoolThread, threadname, 0, pool);
+        if (!pool->threads[i]) {
+            SDL_DestroyAudioMixPool(pool);
+            return NULL;
+        }
+        ++pool->num_threads;
+    }
+
+    return pool;
+}
+
+void SDL_DestroyAudioMixPool(SDL_AudioMixPool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->shutdown, 1);
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_PostSemaphore(pool->start);
+    }
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    SDL_DestroySemaphore(pool->start);
+    SDL_DestroySemaphore(pool->done);
+    SDL_free(pool->threads);
+    SDL_free(pool);
+}
+
+void SDL_RunAudioMixPool(SDL_AudioMixPool *pool, int num_jobs, SDL_AudioMixPoolFunc job, void *userdata)
+{
+    // Don't wake more workers than there are jobs for them to do; the calling thread takes one, too.
+    const int num_workers = SDL_min(pool->num_threads, num_jobs - 1);
+    int i;
+
+    pool->job = job;
+    pool->userdata = userdata;
+    pool->num_jobs = num_jobs;
+    SDL_AtomicSet(&pool->next_job, 0);
+
+    for (i = 0; i < num_workers; ++i) {
+        SDL_PostSemaphore(pool->start);
+    }
+
+    RunAudioMixJobs(pool);
+
+    for (i = 0; i < num_workers; ++i) {
+        SDL_WaitSemaphore(pool->done);
+    }
+}
@@ -0,0 +1,43 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_audiomixpool_h_
+#define SDL_audiomixpool_h_
+
+// Internal worker threads used by the output device thread to get data from many bound streams in parallel.
+
+typedef struct SDL_AudioMixPool SDL_AudioMixPool;
+
+typedef void (SDLCALL *SDL_AudioMixPoolFunc)(void *userdata, int index);
+
+// Create a pool with `num_threads` worker threads, named after `name`
+SDL_AudioMixPool *SDL_CreateAudioMixPool(const char *name, int num_threads);
+
+// Stop and join the worker threads, and free the pool
+void SDL_DestroyAudioMixPool(SDL_AudioMixPool *pool);
+
+// Call `job` once for each index in [0, num_jobs), spread across the workers and the calling thread.
+// Returns once every job has finished. The order jobs run in, and which thread runs them, is not defined.
+// REQUIRES: Only one thread runs jobs on a pool at a time
+void SDL_RunAudioMixPool(SDL_AudioMixPool *pool, int num_jobs, SDL_AudioMixPoolFunc job, void *userdata);
+
+#endif // SDL_audiomixpool_h_
@@ -24,11 +24,14 @@
 
 #define AUDIO_SPECS_EQUAL(x, y) (((x).format == (y).format) && ((x).channels == (y).channels) && ((x).freq == (y).freq))
 
+typedef struct SDL_AudioChunk SDL_AudioChunk;
+
 struct SDL_AudioTrack
 {
     SDL_AudioSpec spec;
     SDL_bool flushed;
     SDL_AudioTrack *next;
+    SDL_AudioQueue *queue;  // the queue this track is in, which takes its chunks when they're finished with. NULL until it's added.
 
     size_t (*avail)(void *ctx);
     int (*write)(void *ctx, const Uint8 *buf, size_t len);
@@ -41,13 +44,18 @@ struct SDL_AudioQueue
     SDL_AudioTrack *head;
     SDL_AudioTrack *tail;
     size_t chunk_size;
-};
 
-typedef struct SDL_AudioChunk SDL_AudioChunk;
+    // Finished chunks are kept here for the queue's next tracks, so tracks that come and go (every flush
+    // or format change starts a new one) don't have to go back to the allocator each time. Queues are
+    // only used by whoever holds their owner's lock, so this needs no lock of its own.
+    SDL_AudioChunk *free_chunks;
+    size_t num_free_chunks;
+};
 
 struct SDL_AudioChunk
 {
     SDL_AudioChunk *next;
+    size_t size;  // how many bytes `data` can hold.
     size_t head;
     size_t tail;
     Uint8 data[SDL_VARIABLE_LENGTH_ARRAY];
@@ -63,20 +71,31 @@ typedef struct SDL_ChunkedAudioTrack
     SDL_AudioChunk *tail;
     size_t queued_bytes;
 
-    SDL_AudioChunk *free_chunks;
-    size_t num_free_chunks;
+    // If set, the finished track goes back onto this list with its chunks instead of being destroyed (see SDL_CreateRecyclableAudioTrack).
+    void **recycle_list;
+    SDL_AudioChunk *free_chunks;  // chunks kept for the next time a recyclable track is filled.
 } SDL_ChunkedAudioTrack;
 
-static void DestroyAudioChunk(SDL_AudioChunk *chunk)
+// `queue` may be NULL, if the chunk's track was never added to one.
+static void DestroyAudioChunk(SDL_AudioQueue *queue, SDL_AudioChunk *chunk)
 {
-    SDL_free(chunk);
+    // Keeping free chunks around reduces memory allocations, but we don't want to hold on to too much.
+    const size_t max_free_bytes = 64 * 1024;
+
+    if (queue && (chunk->size == queue->chunk_size) && (queue->chunk_size * queue->num_free_chunks < max_free_bytes)) {
+        chunk->next = queue->free_chunks;
+        queue->free_chunks = chunk;
+        ++queue->num_free_chunks;
+    } else {
+        SDL_free(chunk);
+    }
 }
 
-static void DestroyAudioChunks(SDL_AudioChunk *chunk)
+static void DestroyAudioChunks(SDL_AudioQueue *queue, SDL_AudioChunk *chunk)
 {
     while (chunk) {
         SDL_AudioChunk *next = chunk->next;
-        DestroyAudioChunk(chunk);
+        DestroyAudioChunk(queue, chunk);
         chunk = next;
     }
 }
@@ -88,12 +107,23 @@ static void ResetAudioChunk(SDL_AudioChunk *chunk)
     chunk->tail = 0;
 }
 
-static SDL_AudioChunk *CreateAudioChunk(size_t chunk_size)
+// `queue` may be NULL, if the chunk is for a track that isn't in one yet.
+static SDL_AudioChunk *CreateAudioChunk(SDL_AudioQueue *queue, size_t chunk_size)
 {
-    SDL_AudioChunk *chunk = (SDL_AudioChunk *)SDL_malloc(sizeof(*chunk) + chunk_size);
+    SDL_AudioChunk *chunk = NULL;
 
-    if (!chunk) {
-        return NULL;
+    if (queue && (chunk_size == queue->chunk_size) && (queue->num_free_chunks > 0)) {
+        chunk = queue->free_chunks;
+        queue->free_chunks = chunk->next;
+        --queue->num_free_chunks;
+    } else {
+        chunk = (SDL_AudioChunk *)SDL_malloc(sizeof(*chunk) + chunk_size);
+
+        if (!chunk) {
+            return NULL;
+        }
+
+        chunk->size = chunk_size;
     }
 
     ResetAudioChunk(chunk);
@@ -101,35 +131,32 @@ static SDL_AudioChunk *CreateAudioChunk(size_t chunk_size)
     return chunk;
 }
 
-static void DestroyAudioTrackChunk(SDL_ChunkedAudioTrack *track, SDL_AudioChunk *chunk)
+static SDL_AudioChunk *CreateChunkedAudioTrackChunk(SDL_ChunkedAudioTrack *track)
 {
-    // Keeping a list of free chunks reduces memory allocations,
-    // But also increases the amount of work to perform when freeing the track.
-    const size_t max_free_bytes = 64 * 1024;
+    SDL_AudioChunk *chunk = track->free_chunks;
 
-    if (track->chunk_size * track->num_free_chunks < max_free_bytes) {
-        chunk->next = track->free_chunks;
-        track->free_chunks = chunk;
-        ++track->num_free_chunks;
-    } else {
-        DestroyAudioChunk(chunk);
+    if (chunk) {
+        track->free_chunks = chunk->next;
+        ResetAudioChunk(chunk);
+        return chunk;
     }
+
+    return CreateAudioChunk(track->track.queue, track->chunk_size);
 }
 
-static SDL_AudioChunk *CreateAudioTrackChunk(SDL_ChunkedAudioTrack *track)
+static void DestroyChunkedAudioTrackChunks(SDL_ChunkedAudioTrack *track, SDL_AudioChunk *chunk)
 {
-    if (track->num_free_chunks > 0) {
-        SDL_AudioChunk *chunk = track->free_chunks;
-
-        track->free_chunks = chunk->next;
-        --track->num_free_chunks;
-
-        ResetAudioChunk(chunk);
-
-        return chunk;
+    if (!track->recycle_list) {
+        DestroyAudioChunks(track->track.queue, chunk);
+        return;
     }
 
-    return CreateAudioChunk(track->chunk_size);
+    while (chunk) {
+        SDL_AudioChunk *next = chunk->next;
+        chunk->next = track->free_chunks;
+        track->free_chunks = chunk;
+        chunk = next;
+    }
 }
 
 static size_t AvailChunkedAudioTrack(void *ctx)
@@ -147,7 +174,7 @@ static int WriteToChunkedAudioTrack(void *ctx, const Uint8 *data, size_t len)
 
     // Handle the first chunk
     if (!chunk) {
-        chunk = CreateAudioTrackChunk(track);
+        chunk = CreateChunkedAudioTrackChunk(track);
 
         if (!chunk) {
             return -1;
@@ -174,7 +201,7 @@ static int WriteToChunkedAudioTrack(void *ctx, const Uint8 *data, size_t len)
             break;
         }
 
-        SDL_AudioChunk *next = CreateAudioTrackChunk(track);
+        SDL_AudioChunk *next = CreateChunkedAudioTrackChunk(track);
         chunk->next = next;
         chunk = next;
     }
@@ -187,7 +214,7 @@ static int WriteToChunkedAudioTrack(void *ctx, const Uint8 *data, size_t len)
         chunk->next = NULL;
         chunk->tail = old_tail;
 
-        DestroyAudioChunks(next);
+        DestroyChunkedAudioTrackChunks(track, next);
 
         return -1;
     }
@@ -222,7 +249,8 @@ static size_t ReadFromChunkedAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_
         }
 
         if (advance) {
-            DestroyAudioTrackChunk(track, chunk);
+            chunk->next = NULL;
+            DestroyChunkedAudioTrackChunks(track, chunk);
         }
 
         chunk = next;
@@ -246,8 +274,23 @@ static size_t ReadFromChunkedAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_
 static void DestroyChunkedAudioTrack(void *ctx)
 {
     SDL_ChunkedAudioTrack *track = ctx;
-    DestroyAudioChunks(track->head);
-    DestroyAudioChunks(track->free_chunks);
+
+    if (track->recycle_list) {
+        // Hand it back empty, but keep the chunks, so filling it again doesn't allocate anything.
+        DestroyChunkedAudioTrackChunks(track, track->head);
+        track->head = NULL;
+        track->tail = NULL;
+        track->queued_bytes = 0;
+        track->track.flushed = SDL_FALSE;
+        track->track.next = NULL;
+        track->track.queue = NULL;  // the queue might be on its way out.
+        track->track.write = WriteToChunkedAudioTrack;  // flushing took this away.
+        SDL_PushAudioTrackList(track->recycle_list, &track->track);
+        return;
+    }
+
+    DestroyAudioChunks(track->track.queue, track->head);
+    DestroyAudioChunks(NULL, track->free_chunks);
     SDL_free(track);
 }
 
@@ -270,6 +313,299 @@ static SDL_AudioTrack *CreateChunkedAudioTrack(const SDL_AudioSpec *spec, size_t
     return &track->track;
 }
 
+// A track with one writer and one reader, which never need to hold a lock at the same time.
+// Chunks are always filled completely before moving on to the next one, so the reader
+// only needs to know how many bytes have been written in total to find its way around.
+// The byte counts are 64 bits wide, so they never wrap in the life of a track.
+typedef struct SDL_LockFreeAudioTrack
+{
+    SDL_AudioTrack track;
+
+    size_t chunk_size;
+
+    // Only touched by the writer
+    SDL_AudioChunk *tail;
+    Uint64 written;
+    SDL_AudioChunk *free_chunks;
+
+    // Only touched by the reader
+    SDL_AudioChunk *head;
+    size_t head_offset;
+    Uint64 read;
+
+    // Shared between the two
+    SDL_AtomicU64 published;   // `written`, as far as the reader is concerned.
+    void *recycled_chunks;     // chunks the reader has finished with, waiting to be reused by the writer.
+} SDL_LockFreeAudioTrack;
+
+static SDL_AudioChunk *CreateLockFreeAudioTrackChunk(SDL_LockFreeAudioTrack *track)
+{
+    SDL_AudioChunk *chunk = track->free_chunks;
+
+    if (!chunk) {
+        // Take everything the reader has given back in one go.
+        chunk = (SDL_AudioChunk *)SDL_AtomicSetPtr(&track->recycled_chunks, NULL);
+    }
+
+    if (chunk) {
+        track->free_chunks = chunk->next;
+        ResetAudioChunk(chunk);
+        return chunk;
+    }
+
+    return CreateAudioChunk(NULL, track->chunk_size);  // the writer doesn't hold the lock that guards the queue's chunks.
+}
+
+static void RecycleLockFreeAudioTrackChunk(SDL_LockFreeAudioTrack *track, SDL_AudioChunk *chunk)
+{
+    void *next;
+
+    // Only the reader pushes, and the writer only ever takes the whole list, so this can't suffer from ABA.
+    do {
+        next = SDL_AtomicGetPtr(&track->recycled_chunks);
+        chunk->next = (SDL_AudioChunk *)next;
+    } while (!SDL_AtomicCASPtr(&track->recycled_chunks, next, chunk));
+}
+
+static size_t AvailLockFreeAudioTrack(void *ctx)
+{
+    SDL_LockFreeAudioTrack *track = ctx;
+
+    return (size_t)(SDL_AtomicGetU64(&track->published) - track->read);
+}
+
+static int WriteToLockFreeAudioTrack(void *ctx, const Uint8 *data, size_t len)
+{
+    SDL_LockFreeAudioTrack *track = ctx;
+    const size_t chunk_size = track->chunk_size;
+    SDL_AudioChunk *chunk = track->tail;
+    SDL_AudioChunk *new_chunks = NULL;
+    SDL_AudioChunk *new_tail = NULL;
+
+    if (len > (size_t)SDL_MAX_SINT32) {
+        return SDL_SetError("Too much audio data to queue at once");
+    }
+
+    // Get all the chunks we need up front, so nothing needs to be rolled back if we run out of memory.
+    size_t space = chunk_size - chunk->tail;
+
+    while (space < len) {
+        SDL_AudioChunk *next = CreateLockFreeAudioTrackChunk(track);
+
+        if (!next) {
+            if (new_tail) {
+                new_tail->next = track->free_chunks;
+                track->free_chunks = new_chunks;
+            }
+            return -1;
+        }
+
+        if (new_tail) {
+            new_tail->next = next;
+        } else {
+            new_chunks = next;
+        }
+
+        new_tail = next;
+        space += chunk_size;
+    }
+
+    size_t total = 0;
+
+    while (total < len) {
+        if (chunk->tail == chunk_size) {
+            // The reader won't look at `next` until the bytes in it have been published.
+            SDL_AudioChunk *next = new_chunks;
+            new_chunks = next->next;
+            next->next = NULL;
+            chunk->next = next;
+            chunk = next;
+        }
+
+        size_t to_write = SDL_min(chunk_size - chunk->tail, len - total);
+        SDL_memcpy(&chunk->data[chunk->tail], &data[total], to_write);
+        chunk->tail += to_write;
+        total += to_write;
+    }
+
+    track->tail = chunk;
+    track->written += len;
+
+    // Make sure the data and the chunk links are visible before the new byte count is.
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSetU64(&track->published, track->written);
+
+    return 0;
+}
+
+static size_t ReadFromLockFreeAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_bool advance)
+{
+    SDL_LockFreeAudioTrack *track = ctx;
+    const size_t chunk_size = track->chunk_size;
+    SDL_AudioChunk *chunk = track->head;
+    size_t offset = track->head_offset;
+
+    len = SDL_min(len, AvailLockFreeAudioTrack(track));
+
+    // Don't look at the data until we've seen the byte count that covers it.
+    SDL_MemoryBarrierAcquire();
+
+    size_t total = 0;
+
+    while (total < len) {
+        if (offset == chunk_size) {
+            SDL_AudioChunk *next = chunk->next;
+
+            if (advance) {
+                RecycleLockFreeAudioTrackChunk(track, chunk);
+            }
+
+            chunk = next;
+            offset = 0;
+        }
+
+        size_t to_read = SDL_min(chunk_size - offset, len - total);
+        SDL_memcpy(&data[total], &chunk->data[offset], to_read);
+        offset += to_read;
+        total += to_read;
+    }
+
+    if (advance) {
+        track->head = chunk;
+        track->head_offset = offset;
+        track->read += total;
+    }
+
+    return total;
+}
+
+static void DestroyLockFreeAudioTrack(void *ctx)
+{
+    SDL_LockFreeAudioTrack *track = ctx;
+    DestroyAudioChunks(track->track.queue, track->head);
+    DestroyAudioChunks(track->track.queue, track->free_chunks);
+    DestroyAudioChunks(track->track.queue, (SDL_AudioChunk *)SDL_AtomicGetPtr(&track->recycled_chunks));
+    SDL_free(track);
+}
+
+SDL_AudioTrack *SDL_CreateLockFreeAudioTrack(const SDL_AudioSpec *spec, size_t chunk_size)
+{
+    SDL_LockFreeAudioTrack *track = (SDL_LockFreeAudioTrack *)SDL_calloc(1, sizeof(*track));
+
+    if (!track) {
+        return NULL;
+    }
+
+    // There is always a chunk to write into, so the reader and writer never fight over the first one.
+    track->head = CreateAudioChunk(NULL, chunk_size);
+
+    if (!track->head) {
+        SDL_free(track);
+        return NULL;
+    }
+
+    track->tail = track->head;
+
+    SDL_copyp(&track->track.spec, spec);
+    track->track.avail = AvailLockFreeAudioTrack;
+    track->track.write = WriteToLockFreeAudioTrack;
+    track->track.read = ReadFromLockFreeAudioTrack;
+    track->track.destroy = DestroyLockFreeAudioTrack;
+
+    track->chunk_size = chunk_size;
+
+    return &track->track;
+}
+
+int SDL_WriteToLockFreeAudioTrack(SDL_AudioTrack *track, const Uint8 *data, size_t len)
+{
+    SDL_assert(track->write == WriteToLockFreeAudioTrack);
+
+    if (len == 0) {
+        return 0;
+    }
+
+    return track->write(track, data, len);
+}
+
+// A track that reads straight out of memory owned by someone else, who gets it back through `callback`.
+typedef struct SDL_ReferencedAudioTrack
+{
+    SDL_AudioTrack track;
+
+    const Uint8 *data;
+    size_t len;
+    size_t head;
+
+    SDL_AudioStreamDataCompleteCallback callback;
+    void *userdata;
+} SDL_ReferencedAudioTrack;
+
+static void ReleaseReferencedAudioTrack(SDL_ReferencedAudioTrack *track)
+{
+    if (track->data) {
+        if (track->callback) {
+            track->callback(track->userdata, track->data, (int)track->len);
+        }
+        track->data = NULL;
+    }
+}
+
+static size_t AvailReferencedAudioTrack(void *ctx)
+{
+    SDL_ReferencedAudioTrack *track = ctx;
+
+    return track->len - track->head;
+}
+
+static size_t ReadFromReferencedAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_bool advance)
+{
+    SDL_ReferencedAudioTrack *track = ctx;
+
+    len = SDL_min(len, track->len - track->head);
+    SDL_memcpy(data, &track->data[track->head], len);
+
+    if (advance) {
+        track->head += len;
+
+        // Give the memory back as soon as we're done with it, instead of waiting for the track to be destroyed.
+        if (track->head == track->len) {
+            ReleaseReferencedAudioTrack(track);
+        }
+    }
+
+    return len;
+}
+
+static void DestroyReferencedAudioTrack(void *ctx)
+{
+    SDL_ReferencedAudioTrack *track = ctx;
+    ReleaseReferencedAudioTrack(track);
+    SDL_free(track);
+}
+
+SDL_AudioTrack *SDL_CreateReferencedAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+    SDL_ReferencedAudioTrack *track = (SDL_ReferencedAudioTrack *)SDL_calloc(1, sizeof(*track));
+
+    if (!track) {
+        return NULL;
+    }
+
+    // There's no `write`: anything added after this goes into a new track.
+    SDL_copyp(&track->track.spec, spec);
+    track->track.avail = AvailReferencedAudioTrack;
+    track->track.read = ReadFromReferencedAudioTrack;
+    track->track.destroy = DestroyReferencedAudioTrack;
+
+    track->data = data;
+    track->len = len;
+    track->callback = callback;
+    track->userdata = userdata;
+
+    return &track->track;
+}
+
 SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
 {
     SDL_AudioQueue *queue = (SDL_AudioQueue *)SDL_calloc(1, sizeof(*queue));
@@ -287,6 +623,13 @@ void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
 
+    SDL_AudioChunk *chunk = queue->free_chunks;
+    while (chunk) {
+        SDL_AudioChunk *next = chunk->next;
+        SDL_free(chunk);
+        chunk = next;
+    }
+
     SDL_free(queue);
 }
 
@@ -318,6 +661,13 @@ void SDL_FlushAudioQueue(SDL_AudioQueue *queue)
     }
 }
 
+SDL_bool SDL_IsAudioQueueFlushed(SDL_AudioQueue *queue)
+{
+    SDL_AudioTrack *track = queue->tail;
+
+    return track ? track->flushed : SDL_FALSE;
+}
+
 void SDL_PopAudioQueueHead(SDL_AudioQueue *queue)
 {
     SDL_AudioTrack *track = queue->head;
@@ -362,6 +712,73 @@ SDL_AudioTrack *SDL_CreateChunkedAudioTrack(const SDL_AudioSpec *spec, const Uin
     return track;
 }
 
+static void DestroyRecycledAudioTrackList(SDL_AudioTrack *track)
+{
+    while (track) {
+        SDL_AudioTrack *next = track->next;
+        ((SDL_ChunkedAudioTrack *)track)->recycle_list = NULL;
+        track->destroy(track);
+        track = next;
+    }
+}
+
+// Only the owner takes tracks from the recycle list, and it takes all of them at once, so there's no ABA problem.
+// It keeps a few of them in `spares`, which only it touches, and really destroys the rest.
+#define MAX_SPARE_RECYCLED_TRACKS 8
+
+SDL_AudioTrack *SDL_CreateRecyclableAudioTrack(SDL_AudioTrack **spares, void **recycle_list, const SDL_AudioSpec *spec, const Uint8 *data, size_t len, size_t chunk_size)
+{
+    if (!*spares) {
+        SDL_AudioTrack *track = (SDL_AudioTrack *)SDL_AtomicSetPtr(recycle_list, NULL);
+        int count = 0;
+
+        while (track) {
+            SDL_AudioTrack *next = track->next;
+
+            if (count < MAX_SPARE_RECYCLED_TRACKS) {
+                track->next = *spares;
+                *spares = track;
+                ++count;
+            } else {
+                track->next = NULL;
+                DestroyRecycledAudioTrackList(track);
+            }
+
+            track = next;
+        }
+    }
+
+    SDL_ChunkedAudioTrack *track = (SDL_ChunkedAudioTrack *)*spares;
+
+    if (track && (track->chunk_size == chunk_size)) {
+        *spares = track->track.next;
+        track->track.next = NULL;
+        SDL_copyp(&track->track.spec, spec);
+    } else {
+        track = (SDL_ChunkedAudioTrack *)CreateChunkedAudioTrack(spec, chunk_size);
+
+        if (!track) {
+            return NULL;
+        }
+
+        track->recycle_list = recycle_list;
+    }
+
+    if (track->track.write(track, data, len) != 0) {
+        track->track.destroy(track);  // it goes back on the list for next time.
+        return NULL;
+    }
+
+    return &track->track;
+}
+
+void SDL_DestroyRecyclableAudioTracks(SDL_AudioTrack **spares, void **recycle_list)
+{
+    DestroyRecycledAudioTrackList(*spares);
+    *spares = NULL;
+    DestroyRecycledAudioTrackList((SDL_AudioTrack *)SDL_AtomicSetPtr(recycle_list, NULL));
+}
+
 void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track)
 {
     SDL_AudioTrack *tail = queue->tail;
@@ -378,6 +795,39 @@ void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track)
     }
 
     queue->tail = track;
+    track->queue = queue;
+}
+
+void SDL_PushAudioTrackList(void **list, SDL_AudioTrack *track)
+{
+    void *head;
+
+    do {
+        head = SDL_AtomicGetPtr(list);
+        track->next = (SDL_AudioTrack *)head;
+    } while (!SDL_AtomicCASPtr(list, head, track));
+}
+
+void SDL_AddAudioTrackListToQueue(SDL_AudioQueue *queue, void **list)
+{
+    // Take the whole list at once, so there's no ABA problem to worry about.
+    SDL_AudioTrack *track = (SDL_AudioTrack *)SDL_AtomicSetPtr(list, NULL);
+    SDL_AudioTrack *oldest = NULL;
+
+    // The list is newest first; turn it around.
+    while (track) {
+        SDL_AudioTrack *next = track->next;
+        track->next = oldest;
+        oldest = track;
+        track = next;
+    }
+
+    while (oldest) {
+        SDL_AudioTrack *next = oldest->next;
+        oldest->next = NULL;
+        SDL_AddTrackToAudioQueue(queue, oldest);
+        oldest = next;
+    }
 }
 
 int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const Uint8 *data, size_t len)
@@ -406,6 +856,7 @@ int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, cons
         }
 
         queue->tail = new_track;
+        new_track->queue = queue;
 
         track = new_track;
     }
@@ -413,6 +864,24 @@ int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, cons
     return track->write(track, data, len);
 }
 
+size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue)
+{
+    size_t total = 0;
+    SDL_AudioTrack *track;
+
+    for (track = queue->head; track; track = track->next) {
+        const size_t avail = track->avail(track);
+
+        if (avail >= SDL_SIZE_MAX - total) {
+            return SDL_SIZE_MAX;
+        }
+
+        total += avail;
+    }
+
+    return total;
+}
+
 void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue)
 {
     return queue->head;
@@ -40,6 +40,9 @@ void SDL_ClearAudioQueue(SDL_AudioQueue *queue);
 // Mark the last track as flushed
 void SDL_FlushAudioQueue(SDL_AudioQueue *queue);
 
+// Check whether the last track has been flushed, so no more data will be added to it
+SDL_bool SDL_IsAudioQueueFlushed(SDL_AudioQueue *queue);
+
 // Pop the current head track
 // REQUIRES: The head track must exist, and must have been flushed
 void SDL_PopAudioQueueHead(SDL_AudioQueue *queue);
@@ -55,10 +58,43 @@ int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, cons
 // Create a track without needing to hold any locks
 SDL_AudioTrack *SDL_CreateChunkedAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, size_t chunk_size);
 
+// Create a track holding a copy of `data`, like SDL_CreateChunkedAudioTrack, that is pushed onto `recycle_list` with its
+// chunks once it's finished with, instead of being destroyed. Tracks are reused from `spares`, which is refilled from
+// `recycle_list` when it runs out, so a steady stream of tracks stops allocating memory after the first few.
+// REQUIRES: Only one thread creates tracks from `spares` and `recycle_list` at a time
+SDL_AudioTrack *SDL_CreateRecyclableAudioTrack(SDL_AudioTrack **spares, void **recycle_list, const SDL_AudioSpec *spec, const Uint8 *data, size_t len, size_t chunk_size);
+
+// Really destroy every track waiting in `spares` and `recycle_list`
+// REQUIRES: No recyclable track from these lists is still in a queue, or being created
+void SDL_DestroyRecyclableAudioTracks(SDL_AudioTrack **spares, void **recycle_list);
+
+// Create a track that one thread can write to while another reads from it, without either holding a lock.
+// The reader still needs to hold whatever lock protects the queue itself.
+SDL_AudioTrack *SDL_CreateLockFreeAudioTrack(const SDL_AudioSpec *spec, size_t chunk_size);
+
+// Write data to the end of a track created by SDL_CreateLockFreeAudioTrack
+// REQUIRES: Only one thread writes to the track, and the track has not been flushed
+int SDL_WriteToLockFreeAudioTrack(SDL_AudioTrack *track, const Uint8 *data, size_t len);
+
+// Create a track that reads from `data` without copying it. `callback` is called once the
+// track is finished with `data`: when it has all been read, or the track is destroyed.
+// REQUIRES: `len <= SDL_MAX_SINT32`
+SDL_AudioTrack *SDL_CreateReferencedAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
+
 // Add a track to the end of the queue
 // REQUIRES: `track != NULL`
 void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track);
 
+// Push a track onto a list that other threads might be pushing to at the same time, without holding any locks
+// REQUIRES: `track != NULL`, and it isn't in a queue or another list
+void SDL_PushAudioTrackList(void **list, SDL_AudioTrack *track);
+
+// Take every track pushed onto the list and add them to the end of the queue, oldest first
+void SDL_AddAudioTrackListToQueue(SDL_AudioQueue *queue, void **list);
+
+// Get the total number of bytes in the queue
+size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue);
+
 // Iterate over the tracks in the queue
 void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue);
 
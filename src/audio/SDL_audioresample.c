@@ -28,7 +28,7 @@
 
 #include "SDL_audio_resampler_filter.h"
 
-// For a given srcpos, `srcpos + frame` are sampled, where `-RESAMPLER_ZERO_CROSSINGS < frame <= RESAMPLER_ZERO_CROSSINGS`.
+// For a given srcpos, `srcpos + frame` are sampled, where `-zero_crossings < frame <= zero_crossings`.
 // Note, when upsampling, it is also possible to start sampling from `srcpos = -1`.
 #define RESAMPLER_MAX_PADDING_FRAMES (RESAMPLER_ZERO_CROSSINGS + 1)
 
@@ -39,189 +39,512 @@
 
 #define RESAMPLER_FULL_FILTER_SIZE (RESAMPLER_SAMPLES_PER_FRAME * (RESAMPLER_SAMPLES_PER_ZERO_CROSSING + 1))
 
-static void ResampleFrame_Scalar(const float *src, float *dst, const float *raw_filter, float interp, int chans)
+// The cheaper quality levels use the same number of filter phases, just fewer taps.
+#define RESAMPLER_LINEAR_ZERO_CROSSINGS 1
+#define RESAMPLER_CUBIC_ZERO_CROSSINGS 2
+
+#define RESAMPLER_CUBIC_FILTER_SIZE (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_CUBIC_ZERO_CROSSINGS)
+
+#define RESAMPLER_FULL_FILTER_SIZE_FOR(zero_crossings) ((zero_crossings) * 2 * (RESAMPLER_SAMPLES_PER_ZERO_CROSSING + 1))
+
+static float FullResamplerFilter[RESAMPLER_FULL_FILTER_SIZE];
+static float FullResamplerFilterLow[RESAMPLER_FULL_FILTER_SIZE_FOR(RESAMPLER_LOW_ZERO_CROSSINGS)];
+static float FullResamplerFilterCubic[RESAMPLER_FULL_FILTER_SIZE_FOR(RESAMPLER_CUBIC_ZERO_CROSSINGS)];
+static float FullResamplerFilterLinear[RESAMPLER_FULL_FILTER_SIZE_FOR(RESAMPLER_LINEAR_ZERO_CROSSINGS)];
+
+// The block resamplers below produce `outframes` frames of output, starting at `srcpos` and stepping by `resample_rate`.
+// `src` must already be offset by the left padding, so `src[0]` is the first tap for `srcpos == 0`.
+//
+// If `phase_filters` is non-NULL, the rate's fractional step is a multiple of one half (2x upsampling, integer
+//  downsampling, etc), so every output frame uses one of two filters: `phase_filters` holds both of them,
+//  already interpolated, and `first_fraction` is the fraction that selects the first one.
+typedef void (*ResampleAudioFunc)(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                  const float *phase_filters, Uint32 first_fraction);
+
+typedef struct ResamplerQualityLevel
 {
-    int i, chan;
+    int zero_crossings;
+    float *full_filter;
+    ResampleAudioFunc resample;
+} ResamplerQualityLevel;
 
-    float filter[RESAMPLER_SAMPLES_PER_FRAME];
+SDL_FORCE_INLINE void InterpolateResamplerFilter(float *filter, const float *full_filter, const int taps, Uint32 srcfraction)
+{
+    const float *raw_filter = &full_filter[(srcfraction >> RESAMPLER_FILTER_INTERP_BITS) * taps];
+    const float interp = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+    int i;
 
     // Interpolate between the nearest two filters
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-        filter[i] = (raw_filter[i] * (1.0f - interp)) + (raw_filter[i + RESAMPLER_SAMPLES_PER_FRAME] * interp);
+    for (i = 0; i < taps; i++) {
+        filter[i] = (raw_filter[i] * (1.0f - interp)) + (raw_filter[i + taps] * interp);
     }
+}
 
-    if (chans == 2) {
-        float out[2];
-        out[0] = 0.0f;
-        out[1] = 0.0f;
+// `taps` is always a constant, so each caller gets a copy of this with the inner loops fully unrolled.
+SDL_FORCE_INLINE void ResampleAudio_Generic(const float *full_filter, const int taps, int chans, const float *src, float *dst, int outframes,
+                                            Sint64 srcpos, Sint64 resample_rate, const float *phase_filters, Uint32 first_fraction)
+{
+    float filter_buffer[RESAMPLER_SAMPLES_PER_FRAME];
+    int i, chan, frame;
+
+    for (frame = 0; frame < outframes; frame++) {
+        const float *filter = filter_buffer;
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *in = &src[(srcpos >> 32) * chans];
+        srcpos += resample_rate;
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-            const float scale = filter[i];
-            out[0] += src[i * 2 + 0] * scale;
-            out[1] += src[i * 2 + 1] * scale;
+        if (phase_filters) {
+            filter = &phase_filters[((srcfraction - first_fraction) >> 31) * taps];
+        } else {
+            InterpolateResamplerFilter(filter_buffer, full_filter, taps, srcfraction);
         }
 
-        dst[0] = out[0];
-        dst[1] = out[1];
-        return;
-    }
+        if (chans == 2) {
+            float out0 = 0.0f;
+            float out1 = 0.0f;
 
-    if (chans == 1) {
-        float out = 0.0f;
+            for (i = 0; i < taps; i++) {
+                const float scale = filter[i];
+                out0 += in[i * 2 + 0] * scale;
+                out1 += in[i * 2 + 1] * scale;
+            }
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-            out += src[i] * filter[i];
-        }
+            dst[0] = out0;
+            dst[1] = out1;
+        } else if (chans == 1) {
+            float out = 0.0f;
 
-        dst[0] = out;
-        return;
-    }
+            for (i = 0; i < taps; i++) {
+                out += in[i] * filter[i];
+            }
+
+            dst[0] = out;
+        } else {
+            for (chan = 0; chan < chans; chan++) {
+                float f = 0.0f;
 
-    for (chan = 0; chan < chans; chan++) {
-        float f = 0.0f;
+                for (i = 0; i < taps; i++) {
+                    f += in[i * chans + chan] * filter[i];
+                }
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-            f += src[i * chans + chan] * filter[i];
+                dst[chan] = f;
+            }
         }
 
-        dst[chan] = f;
+        dst += chans;
     }
 }
 
+static void ResampleAudio_Scalar(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                 const float *phase_filters, Uint32 first_fraction)
+{
+    ResampleAudio_Generic(FullResamplerFilter, RESAMPLER_SAMPLES_PER_FRAME, chans, src, dst, outframes, srcpos, resample_rate, phase_filters, first_fraction);
+}
+
+static void ResampleAudio_Low(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                              const float *phase_filters, Uint32 first_fraction)
+{
+    ResampleAudio_Generic(FullResamplerFilterLow, RESAMPLER_LOW_ZERO_CROSSINGS * 2, chans, src, dst, outframes, srcpos, resample_rate, phase_filters, first_fraction);
+}
+
+static void ResampleAudio_Cubic(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                const float *phase_filters, Uint32 first_fraction)
+{
+    ResampleAudio_Generic(FullResamplerFilterCubic, RESAMPLER_CUBIC_ZERO_CROSSINGS * 2, chans, src, dst, outframes, srcpos, resample_rate, phase_filters, first_fraction);
+}
+
+static void ResampleAudio_Linear(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                 const float *phase_filters, Uint32 first_fraction)
+{
+    ResampleAudio_Generic(FullResamplerFilterLinear, RESAMPLER_LINEAR_ZERO_CROSSINGS * 2, chans, src, dst, outframes, srcpos, resample_rate, phase_filters, first_fraction);
+}
+
 #ifdef SDL_SSE_INTRINSICS
-static void SDL_TARGETING("sse") ResampleFrame_SSE(const float *src, float *dst, const float *raw_filter, float interp, int chans)
+static void SDL_TARGETING("sse") ResampleAudio_SSE(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                                   const float *phase_filters, Uint32 first_fraction)
 {
 #if RESAMPLER_SAMPLES_PER_FRAME != 10
 #error Invalid samples per frame
 #endif
 
-    // Load the filter
-    __m128 f0 = _mm_loadu_ps(raw_filter + 0);
-    __m128 f1 = _mm_loadu_ps(raw_filter + 4);
-    __m128 f2 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 8));
-
-    __m128 g0 = _mm_loadu_ps(raw_filter + 10);
-    __m128 g1 = _mm_loadu_ps(raw_filter + 14);
-    __m128 g2 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 18));
-
-    __m128 interp1 = _mm_set1_ps(interp);
-    __m128 interp2 = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_set1_ps(interp));
-
-    // Linear interpolate the filter
-    f0 = _mm_add_ps(_mm_mul_ps(f0, interp2), _mm_mul_ps(g0, interp1));
-    f1 = _mm_add_ps(_mm_mul_ps(f1, interp2), _mm_mul_ps(g1, interp1));
-    f2 = _mm_add_ps(_mm_mul_ps(f2, interp2), _mm_mul_ps(g2, interp1));
-
-    if (chans == 2) {
-        // Duplicate each of the filter elements
-        g0 = _mm_unpackhi_ps(f0, f0);
-        f0 = _mm_unpacklo_ps(f0, f0);
-        g1 = _mm_unpackhi_ps(f1, f1);
-        f1 = _mm_unpacklo_ps(f1, f1);
-        f2 = _mm_unpacklo_ps(f2, f2);
-
-        // Multiply the filter by the input
-        f0 = _mm_mul_ps(f0, _mm_loadu_ps(src + 0));
-        g0 = _mm_mul_ps(g0, _mm_loadu_ps(src + 4));
-        f1 = _mm_mul_ps(f1, _mm_loadu_ps(src + 8));
-        g1 = _mm_mul_ps(g1, _mm_loadu_ps(src + 12));
-        f2 = _mm_mul_ps(f2, _mm_loadu_ps(src + 16));
-
-        // Calculate the sum
-        f0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(f0, g0), _mm_add_ps(f1, g1)), f2);
-        f0 = _mm_add_ps(f0, _mm_movehl_ps(f0, f0));
-
-        // Store the result
-        _mm_storel_pi((__m64 *)dst, f0);
-        return;
-    }
+    float filter_buffer[RESAMPLER_SAMPLES_PER_FRAME];
+    int i, chan, frame;
 
-    if (chans == 1) {
-        // Multiply the filter by the input
-        f0 = _mm_mul_ps(f0, _mm_loadu_ps(src + 0));
-        f1 = _mm_mul_ps(f1, _mm_loadu_ps(src + 4));
-        f2 = _mm_mul_ps(f2, _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(src + 8)));
+    for (frame = 0; frame < outframes; frame++) {
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *in = &src[(srcpos >> 32) * chans];
+        __m128 f0, f1, f2;
+        srcpos += resample_rate;
 
-        // Calculate the sum
-        f0 = _mm_add_ps(f0, f1);
-        f0 = _mm_add_ps(_mm_add_ps(f0, f2), _mm_movehl_ps(f0, f0));
-        f0 = _mm_add_ss(f0, _mm_shuffle_ps(f0, f0, _MM_SHUFFLE(1, 1, 1, 1)));
+        if (phase_filters) {
+            const float *filter = &phase_filters[((srcfraction - first_fraction) >> 31) * RESAMPLER_SAMPLES_PER_FRAME];
+            f0 = _mm_loadu_ps(filter + 0);
+            f1 = _mm_loadu_ps(filter + 4);
+            f2 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(filter + 8));
+        } else {
+            const float *raw_filter = &FullResamplerFilter[(srcfraction >> RESAMPLER_FILTER_INTERP_BITS) * RESAMPLER_SAMPLES_PER_FRAME];
+            const float interp = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+            const __m128 interp1 = _mm_set1_ps(interp);
+            const __m128 interp2 = _mm_sub_ps(_mm_set1_ps(1.0f), interp1);
+
+            // Linear interpolate the filter
+            f0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(raw_filter + 0), interp2), _mm_mul_ps(_mm_loadu_ps(raw_filter + 10), interp1));
+            f1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(raw_filter + 4), interp2), _mm_mul_ps(_mm_loadu_ps(raw_filter + 14), interp1));
+            f2 = _mm_add_ps(_mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 8)), interp2),
+                            _mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 18)), interp1));
+        }
 
-        // Store the result
-        _mm_store_ss(dst, f0);
-        return;
+        if (chans == 2) {
+            // Duplicate each of the filter elements
+            __m128 g0 = _mm_unpackhi_ps(f0, f0);
+            __m128 g1 = _mm_unpackhi_ps(f1, f1);
+            f0 = _mm_unpacklo_ps(f0, f0);
+            f1 = _mm_unpacklo_ps(f1, f1);
+            f2 = _mm_unpacklo_ps(f2, f2);
+
+            // Multiply the filter by the input
+            f0 = _mm_mul_ps(f0, _mm_loadu_ps(in + 0));
+            g0 = _mm_mul_ps(g0, _mm_loadu_ps(in + 4));
+            f1 = _mm_mul_ps(f1, _mm_loadu_ps(in + 8));
+            g1 = _mm_mul_ps(g1, _mm_loadu_ps(in + 12));
+            f2 = _mm_mul_ps(f2, _mm_loadu_ps(in + 16));
+
+            // Calculate the sum
+            f0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(f0, g0), _mm_add_ps(f1, g1)), f2);
+            f0 = _mm_add_ps(f0, _mm_movehl_ps(f0, f0));
+
+            // Store the result
+            _mm_storel_pi((__m64 *)dst, f0);
+        } else if (chans == 1) {
+            // Multiply the filter by the input
+            f0 = _mm_mul_ps(f0, _mm_loadu_ps(in + 0));
+            f1 = _mm_mul_ps(f1, _mm_loadu_ps(in + 4));
+            f2 = _mm_mul_ps(f2, _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(in + 8)));
+
+            // Calculate the sum
+            f0 = _mm_add_ps(f0, f1);
+            f0 = _mm_add_ps(_mm_add_ps(f0, f2), _mm_movehl_ps(f0, f0));
+            f0 = _mm_add_ss(f0, _mm_shuffle_ps(f0, f0, _MM_SHUFFLE(1, 1, 1, 1)));
+
+            // Store the result
+            _mm_store_ss(dst, f0);
+        } else {
+            _mm_storeu_ps(filter_buffer + 0, f0);
+            _mm_storeu_ps(filter_buffer + 4, f1);
+            _mm_storel_pi((__m64 *)(filter_buffer + 8), f2);
+
+            for (chan = 0; chan + 4 <= chans; chan += 4) {
+                f0 = _mm_setzero_ps();
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    f0 = _mm_add_ps(f0, _mm_mul_ps(_mm_loadu_ps(&in[i * chans + chan]), _mm_load1_ps(&filter_buffer[i])));
+                }
+
+                _mm_storeu_ps(&dst[chan], f0);
+            }
+
+            for (; chan < chans; chan++) {
+                f0 = _mm_setzero_ps();
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    f0 = _mm_add_ss(f0, _mm_mul_ss(_mm_load_ss(&in[i * chans + chan]), _mm_load_ss(&filter_buffer[i])));
+                }
+
+                _mm_store_ss(&dst[chan], f0);
+            }
+        }
+
+        dst += chans;
     }
+}
+#endif
 
-    float filter[RESAMPLER_SAMPLES_PER_FRAME];
-    _mm_storeu_ps(filter + 0, f0);
-    _mm_storeu_ps(filter + 4, f1);
-    _mm_storel_pi((__m64 *)(filter + 8), f2);
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") ResampleAudio_AVX2(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                                     const float *phase_filters, Uint32 first_fraction)
+{
+#if RESAMPLER_SAMPLES_PER_FRAME != 10
+#error Invalid samples per frame
+#endif
+
+    const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+    float filter_buffer[RESAMPLER_SAMPLES_PER_FRAME];
+    int i, chan, frame;
 
-    int i, chan = 0;
+    for (frame = 0; frame < outframes; frame++) {
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *in = &src[(srcpos >> 32) * chans];
+        __m256 f0;  // taps 0-7
+        __m128 f1;  // taps 8-9
+        srcpos += resample_rate;
 
-    for (; chan + 4 <= chans; chan += 4) {
-        f0 = _mm_setzero_ps();
+        if (phase_filters) {
+            const float *filter = &phase_filters[((srcfraction - first_fraction) >> 31) * RESAMPLER_SAMPLES_PER_FRAME];
+            f0 = _mm256_loadu_ps(filter);
+            f1 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(filter + 8));
+        } else {
+            const float *raw_filter = &FullResamplerFilter[(srcfraction >> RESAMPLER_FILTER_INTERP_BITS) * RESAMPLER_SAMPLES_PER_FRAME];
+            const float interp = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+            const __m256 interp1 = _mm256_set1_ps(interp);
+            const __m256 interp2 = _mm256_sub_ps(_mm256_set1_ps(1.0f), interp1);
+
+            // Linear interpolate the filter
+            f0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(raw_filter), interp2), _mm256_mul_ps(_mm256_loadu_ps(raw_filter + 10), interp1));
+            f1 = _mm_add_ps(_mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 8)), _mm256_castps256_ps128(interp2)),
+                            _mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(raw_filter + 18)), _mm256_castps256_ps128(interp1)));
+        }
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-            f0 = _mm_add_ps(f0, _mm_mul_ps(_mm_loadu_ps(&src[i * chans + chan]), _mm_load1_ps(&filter[i])));
+        if (chans == 2) {
+            // Duplicate each of the filter elements, multiply by the input, and sum.
+            __m256 a = _mm256_mul_ps(_mm256_permutevar8x32_ps(f0, dup_lo), _mm256_loadu_ps(in + 0));
+            __m256 b = _mm256_mul_ps(_mm256_permutevar8x32_ps(f0, dup_hi), _mm256_loadu_ps(in + 8));
+            __m128 c = _mm_mul_ps(_mm_unpacklo_ps(f1, f1), _mm_loadu_ps(in + 16));
+            a = _mm256_add_ps(a, b);
+            c = _mm_add_ps(c, _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+            c = _mm_add_ps(c, _mm_movehl_ps(c, c));
+            _mm_storel_pi((__m64 *)dst, c);
+        } else if (chans == 1) {
+            const __m256 a = _mm256_mul_ps(f0, _mm256_loadu_ps(in));
+            __m128 c = _mm_mul_ps(f1, _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(in + 8)));
+            c = _mm_add_ps(c, _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+            c = _mm_add_ps(c, _mm_movehl_ps(c, c));
+            c = _mm_add_ss(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dst, c);
+        } else {
+            _mm256_storeu_ps(filter_buffer, f0);
+            _mm_storel_pi((__m64 *)(filter_buffer + 8), f1);
+
+            // Process 8 channels (a whole 7.1 frame) at a time, then 4, then whatever is left.
+            for (chan = 0; chan + 8 <= chans; chan += 8) {
+                __m256 acc = _mm256_setzero_ps();
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(&in[i * chans + chan]), _mm256_broadcast_ss(&filter_buffer[i])));
+                }
+
+                _mm256_storeu_ps(&dst[chan], acc);
+            }
+
+            for (; chan + 4 <= chans; chan += 4) {
+                __m128 acc = _mm_setzero_ps();
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&in[i * chans + chan]), _mm_broadcast_ss(&filter_buffer[i])));
+                }
+
+                _mm_storeu_ps(&dst[chan], acc);
+            }
+
+            for (; chan < chans; chan++) {
+                float f = 0.0f;
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    f += in[i * chans + chan] * filter_buffer[i];
+                }
+
+                dst[chan] = f;
+            }
         }
 
-        _mm_storeu_ps(&dst[chan], f0);
+        dst += chans;
     }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void ResampleAudio_NEON(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                               const float *phase_filters, Uint32 first_fraction)
+{
+#if RESAMPLER_SAMPLES_PER_FRAME != 10
+#error Invalid samples per frame
+#endif
+
+    float filter_buffer[RESAMPLER_SAMPLES_PER_FRAME];
+    int i, chan, frame;
 
-    for (; chan < chans; chan++) {
-        f0 = _mm_setzero_ps();
+    for (frame = 0; frame < outframes; frame++) {
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *in = &src[(srcpos >> 32) * chans];
+        float32x4_t f0, f1;
+        float32x2_t f2;
+        srcpos += resample_rate;
+
+        if (phase_filters) {
+            const float *filter = &phase_filters[((srcfraction - first_fraction) >> 31) * RESAMPLER_SAMPLES_PER_FRAME];
+            f0 = vld1q_f32(filter + 0);
+            f1 = vld1q_f32(filter + 4);
+            f2 = vld1_f32(filter + 8);
+        } else {
+            const float *raw_filter = &FullResamplerFilter[(srcfraction >> RESAMPLER_FILTER_INTERP_BITS) * RESAMPLER_SAMPLES_PER_FRAME];
+            const float interp = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+            const float interp2 = 1.0f - interp;
+
+            // Linear interpolate the filter
+            f0 = vmlaq_n_f32(vmulq_n_f32(vld1q_f32(raw_filter + 0), interp2), vld1q_f32(raw_filter + 10), interp);
+            f1 = vmlaq_n_f32(vmulq_n_f32(vld1q_f32(raw_filter + 4), interp2), vld1q_f32(raw_filter + 14), interp);
+            f2 = vmla_n_f32(vmul_n_f32(vld1_f32(raw_filter + 8), interp2), vld1_f32(raw_filter + 18), interp);
+        }
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
-            f0 = _mm_add_ss(f0, _mm_mul_ss(_mm_load_ss(&src[i * chans + chan]), _mm_load_ss(&filter[i])));
+        if (chans == 2) {
+            // Duplicate each of the filter elements, multiply by the input, and sum.
+            const float32x4x2_t d0 = vzipq_f32(f0, f0);
+            const float32x4x2_t d1 = vzipq_f32(f1, f1);
+            const float32x2x2_t d2 = vzip_f32(f2, f2);
+            float32x4_t acc = vmulq_f32(d0.val[0], vld1q_f32(in + 0));
+            acc = vmlaq_f32(acc, d0.val[1], vld1q_f32(in + 4));
+            acc = vmlaq_f32(acc, d1.val[0], vld1q_f32(in + 8));
+            acc = vmlaq_f32(acc, d1.val[1], vld1q_f32(in + 12));
+            acc = vmlaq_f32(acc, vcombine_f32(d2.val[0], d2.val[1]), vld1q_f32(in + 16));
+            vst1_f32(dst, vadd_f32(vget_low_f32(acc), vget_high_f32(acc)));
+        } else if (chans == 1) {
+            float32x4_t acc = vmulq_f32(f0, vld1q_f32(in + 0));
+            float32x2_t sum;
+            acc = vmlaq_f32(acc, f1, vld1q_f32(in + 4));
+            sum = vmla_f32(vadd_f32(vget_low_f32(acc), vget_high_f32(acc)), f2, vld1_f32(in + 8));
+            sum = vpadd_f32(sum, sum);
+            vst1_lane_f32(dst, sum, 0);
+        } else {
+            vst1q_f32(filter_buffer + 0, f0);
+            vst1q_f32(filter_buffer + 4, f1);
+            vst1_f32(filter_buffer + 8, f2);
+
+            for (chan = 0; chan + 4 <= chans; chan += 4) {
+                float32x4_t acc = vdupq_n_f32(0.0f);
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    acc = vmlaq_n_f32(acc, vld1q_f32(&in[i * chans + chan]), filter_buffer[i]);
+                }
+
+                vst1q_f32(&dst[chan], acc);
+            }
+
+            for (; chan < chans; chan++) {
+                float f = 0.0f;
+
+                for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i++) {
+                    f += in[i * chans + chan] * filter_buffer[i];
+                }
+
+                dst[chan] = f;
+            }
         }
 
-        _mm_store_ss(&dst[chan], f0);
+        dst += chans;
     }
 }
 #endif
 
-static void (*ResampleFrame)(const float *src, float *dst, const float *raw_filter, float interp, int chans);
+static ResamplerQualityLevel ResamplerQualityLevels[] = {
+    { RESAMPLER_LINEAR_ZERO_CROSSINGS, FullResamplerFilterLinear, ResampleAudio_Linear },  // SDL_AUDIO_RESAMPLER_LINEAR
+    { RESAMPLER_CUBIC_ZERO_CROSSINGS, FullResamplerFilterCubic, ResampleAudio_Cubic },     // SDL_AUDIO_RESAMPLER_CUBIC
+    { RESAMPLER_LOW_ZERO_CROSSINGS, FullResamplerFilterLow, ResampleAudio_Low },           // SDL_AUDIO_RESAMPLER_SINC_LOW
+    { RESAMPLER_ZERO_CROSSINGS, FullResamplerFilter, ResampleAudio_Scalar },               // SDL_AUDIO_RESAMPLER_SINC_HIGH
+};
 
-static float FullResamplerFilter[RESAMPLER_FULL_FILTER_SIZE];
+SDL_COMPILE_TIME_ASSERT(ResamplerQualityLevels, SDL_arraysize(ResamplerQualityLevels) == SDL_AUDIO_RESAMPLER_SINC_HIGH + 1);
 
-void SDL_SetupAudioResampler(void)
+SDL_FORCE_INLINE const ResamplerQualityLevel *GetResamplerQualityLevel(SDL_AudioResamplerQuality quality)
 {
-    static SDL_bool setup = SDL_FALSE;
-    if (setup) {
-        return;
+    SDL_assert((int)quality >= 0 && quality <= SDL_AUDIO_RESAMPLER_SINC_HIGH);
+    return &ResamplerQualityLevels[quality];
+}
+
+// Linear interpolation, as a 2 tap filter
+static float LinearKernel(float x)
+{
+    return 1.0f - x;
+}
+
+// Catmull-Rom spline, as a 4 tap filter
+static float CubicKernel(float x)
+{
+    if (x < 1.0f) {
+        return ((1.5f * x - 2.5f) * x * x) + 1.0f;
+    }
+    return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+}
+
+static void GenerateResamplerWing(float *wing, int zero_crossings, float (*kernel)(float))
+{
+    int i, j;
+
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
+        for (j = 0; j < zero_crossings; j++) {
+            const float x = (float)j + ((float)i / RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            wing[(i * zero_crossings) + j] = kernel(x);
+        }
     }
+}
 
-    // Build a table combining the left and right wings, for faster access
+// Build a table combining the left and right wings, for faster access
+static void BuildFullResamplerFilter(float *full_filter, const float *wing, int zero_crossings)
+{
+    const int samples_per_frame = zero_crossings * 2;
+    const int full_filter_size = RESAMPLER_FULL_FILTER_SIZE_FOR(zero_crossings);
     int i, j;
 
     for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
-        for (j = 0; j < RESAMPLER_ZERO_CROSSINGS; j++) {
-            int lwing = (i * RESAMPLER_SAMPLES_PER_FRAME) + (RESAMPLER_ZERO_CROSSINGS - 1) - j;
-            int rwing = (RESAMPLER_FULL_FILTER_SIZE - 1) - lwing;
+        for (j = 0; j < zero_crossings; j++) {
+            int lwing = (i * samples_per_frame) + (zero_crossings - 1) - j;
+            int rwing = (full_filter_size - 1) - lwing;
 
-            float value = ResamplerFilter[(i * RESAMPLER_ZERO_CROSSINGS) + j];
-            FullResamplerFilter[lwing] = value;
-            FullResamplerFilter[rwing] = value;
+            float value = wing[(i * zero_crossings) + j];
+            full_filter[lwing] = value;
+            full_filter[rwing] = value;
         }
     }
 
-    for (i = 0; i < RESAMPLER_ZERO_CROSSINGS; ++i) {
-        int rwing = i + RESAMPLER_ZERO_CROSSINGS;
-        int lwing = (RESAMPLER_FULL_FILTER_SIZE - 1) - rwing;
+    for (i = 0; i < zero_crossings; ++i) {
+        int rwing = i + zero_crossings;
+        int lwing = (full_filter_size - 1) - rwing;
 
-        FullResamplerFilter[lwing] = 0.0f;
-        FullResamplerFilter[rwing] = 0.0f;
+        full_filter[lwing] = 0.0f;
+        full_filter[rwing] = 0.0f;
     }
+}
 
-    ResampleFrame = ResampleFrame_Scalar;
+void SDL_SetupAudioResampler(void)
+{
+    static SDL_bool setup = SDL_FALSE;
+    if (setup) {
+        return;
+    }
+
+    // Big enough for the widest generated wing, and static so setup can't fail.
+    static float wing[RESAMPLER_CUBIC_FILTER_SIZE];
+
+    BuildFullResamplerFilter(FullResamplerFilter, ResamplerFilter, RESAMPLER_ZERO_CROSSINGS);
+    BuildFullResamplerFilter(FullResamplerFilterLow, ResamplerFilterLow, RESAMPLER_LOW_ZERO_CROSSINGS);
+
+    GenerateResamplerWing(wing, RESAMPLER_CUBIC_ZERO_CROSSINGS, CubicKernel);
+    BuildFullResamplerFilter(FullResamplerFilterCubic, wing, RESAMPLER_CUBIC_ZERO_CROSSINGS);
+
+    GenerateResamplerWing(wing, RESAMPLER_LINEAR_ZERO_CROSSINGS, LinearKernel);
+    BuildFullResamplerFilter(FullResamplerFilterLinear, wing, RESAMPLER_LINEAR_ZERO_CROSSINGS);
+
+    ResampleAudioFunc ResampleAudio = ResampleAudio_Scalar;
+
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        ResampleAudio = ResampleAudio_NEON;
+    }
+#endif
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
-        ResampleFrame = ResampleFrame_SSE;
+        ResampleAudio = ResampleAudio_SSE;
     }
 #endif
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        ResampleAudio = ResampleAudio_AVX2;
+    }
+#endif
+
+    ResamplerQualityLevels[SDL_AUDIO_RESAMPLER_SINC_HIGH].resample = ResampleAudio;
+
     setup = SDL_TRUE;
 }
 
@@ -236,18 +559,23 @@ Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
     return sample_rate;
 }
 
-int SDL_GetResamplerHistoryFrames(void)
+int SDL_GetResamplerHistoryFrames(SDL_AudioResamplerQuality quality)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
 
+    return GetResamplerQualityLevel(quality)->zero_crossings + 1;
+}
+
+int SDL_GetResamplerMaxHistoryFrames(void)
+{
     return RESAMPLER_MAX_PADDING_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResamplerQuality quality)
 {
-    // This must always be <= SDL_GetResamplerHistoryFrames()
+    // This must always be <= SDL_GetResamplerHistoryFrames(quality)
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    return resample_rate ? (GetResamplerQualityLevel(quality)->zero_crossings + 1) : 0;
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -308,28 +636,28 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
 }
 
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResamplerQuality quality)
 {
-    int i;
-    Sint64 srcpos = *inout_resample_offset;
+    const ResamplerQualityLevel *level = GetResamplerQualityLevel(quality);
+    const int taps = level->zero_crossings * 2;
+    const Sint64 srcpos = *inout_resample_offset;
 
     SDL_assert(resample_rate > 0);
-
-    for (i = 0; i < outframes; i++) {
-        int srcindex = (int)(Sint32)(srcpos >> 32);
-        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
-        srcpos += resample_rate;
-
-        SDL_assert(srcindex >= -1 && srcindex < inframes);
-
-        const float *filter = &FullResamplerFilter[(srcfraction >> RESAMPLER_FILTER_INTERP_BITS) * RESAMPLER_SAMPLES_PER_FRAME];
-        const float interp = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
-
-        const float *frame = &src[(srcindex - (RESAMPLER_ZERO_CROSSINGS - 1)) * chans];
-        ResampleFrame(frame, dst, filter, interp, chans);
-
-        dst += chans;
+    SDL_assert(outframes <= 0 || ((srcpos >> 32) >= -1 && (((srcpos + ((Sint64)(outframes - 1) * resample_rate)) >> 32) < inframes)));
+
+    // The block resamplers index from the first tap of the first frame, not from srcindex.
+    src -= (level->zero_crossings - 1) * chans;
+
+    if ((resample_rate & 0x7FFFFFFF) == 0) {
+        // The fractional position only ever takes two values, so interpolate those two filters once, up front.
+        float phase_filters[RESAMPLER_SAMPLES_PER_FRAME * 2];
+        const Uint32 first_fraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        InterpolateResamplerFilter(&phase_filters[0], level->full_filter, taps, first_fraction);
+        InterpolateResamplerFilter(&phase_filters[taps], level->full_filter, taps, first_fraction + 0x80000000u);
+        level->resample(chans, src, dst, outframes, srcpos, resample_rate, phase_filters, first_fraction);
+    } else {
+        level->resample(chans, src, dst, outframes, srcpos, resample_rate, NULL, 0);
     }
 
-    *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
+    *inout_resample_offset = (srcpos + ((Sint64)outframes * resample_rate)) - ((Sint64)inframes << 32);
 }
@@ -82,7 +82,135 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / SDL_MIX_MAXVOLUME) + 128))
 
 
-// !!! FIXME: this needs some SIMD magic.
+/* Float32 mixing kernels: dst[i] += src[i] * gain.
+   These don't clamp; the final conversion to the device format takes care of that. */
+static void SDL_MixFloat32Audio_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") SDL_MixFloat32Audio_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 vgain = _mm_set1_ps(gain);
+    int i = 0;
+
+    /* Just use unaligned load/stores, if the memory at runtime is
+       aligned it'll be just as fast on modern processors */
+    for (; i + 16 <= num_samples; i += 16) {
+        const __m128 s0 = _mm_mul_ps(_mm_loadu_ps(&src[i]), vgain);
+        const __m128 s1 = _mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vgain);
+        const __m128 s2 = _mm_mul_ps(_mm_loadu_ps(&src[i + 8]), vgain);
+        const __m128 s3 = _mm_mul_ps(_mm_loadu_ps(&src[i + 12]), vgain);
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), s0));
+        _mm_storeu_ps(&dst[i + 4], _mm_add_ps(_mm_loadu_ps(&dst[i + 4]), s1));
+        _mm_storeu_ps(&dst[i + 8], _mm_add_ps(_mm_loadu_ps(&dst[i + 8]), s2));
+        _mm_storeu_ps(&dst[i + 12], _mm_add_ps(_mm_loadu_ps(&dst[i + 12]), s3));
+    }
+
+    for (; i + 4 <= num_samples; i += 4) {
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_mul_ps(_mm_loadu_ps(&src[i]), vgain)));
+    }
+
+    // Finish off any leftovers with scalar operations.
+    for (; i < num_samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+#endif
+
+#ifdef SDL_AVX_INTRINSICS
+static void SDL_TARGETING("avx") SDL_MixFloat32Audio_AVX(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 vgain = _mm256_set1_ps(gain);
+    int i = 0;
+
+    for (; i + 32 <= num_samples; i += 32) {
+        const __m256 s0 = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain);
+        const __m256 s1 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgain);
+        const __m256 s2 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), vgain);
+        const __m256 s3 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), vgain);
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_loadu_ps(&dst[i]), s0));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_loadu_ps(&dst[i + 8]), s1));
+        _mm256_storeu_ps(&dst[i + 16], _mm256_add_ps(_mm256_loadu_ps(&dst[i + 16]), s2));
+        _mm256_storeu_ps(&dst[i + 24], _mm256_add_ps(_mm256_loadu_ps(&dst[i + 24]), s3));
+    }
+
+    for (; i + 8 <= num_samples; i += 8) {
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_loadu_ps(&dst[i]), _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain)));
+    }
+
+    // Finish off any leftovers with scalar operations.
+    for (; i < num_samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_MixFloat32Audio_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    const float32x4_t vgain = vdupq_n_f32(gain);
+    int i = 0;
+
+    for (; i + 16 <= num_samples; i += 16) {
+        const float32x4_t s0 = vmulq_f32(vld1q_f32(&src[i]), vgain);
+        const float32x4_t s1 = vmulq_f32(vld1q_f32(&src[i + 4]), vgain);
+        const float32x4_t s2 = vmulq_f32(vld1q_f32(&src[i + 8]), vgain);
+        const float32x4_t s3 = vmulq_f32(vld1q_f32(&src[i + 12]), vgain);
+        vst1q_f32(&dst[i], vaddq_f32(vld1q_f32(&dst[i]), s0));
+        vst1q_f32(&dst[i + 4], vaddq_f32(vld1q_f32(&dst[i + 4]), s1));
+        vst1q_f32(&dst[i + 8], vaddq_f32(vld1q_f32(&dst[i + 8]), s2));
+        vst1q_f32(&dst[i + 12], vaddq_f32(vld1q_f32(&dst[i + 12]), s3));
+    }
+
+    for (; i + 4 <= num_samples; i += 4) {
+        vst1q_f32(&dst[i], vaddq_f32(vld1q_f32(&dst[i]), vmulq_f32(vld1q_f32(&src[i]), vgain)));
+    }
+
+    // Finish off any leftovers with scalar operations.
+    for (; i < num_samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+#endif
+
+// Function pointer set to a CPU-specific implementation.
+void (*SDL_MixFloat32Audio)(float *dst, const float *src, int num_samples, float gain) = NULL;
+
+void SDL_ChooseAudioMixers(void)
+{
+    static SDL_bool mixers_chosen = SDL_FALSE;
+    if (mixers_chosen) {
+        return;
+    }
+
+    SDL_MixFloat32Audio = SDL_MixFloat32Audio_Scalar;
+
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_MixFloat32Audio = SDL_MixFloat32Audio_NEON;
+    }
+#endif
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_MixFloat32Audio = SDL_MixFloat32Audio_SSE;
+    }
+#endif
+
+#ifdef SDL_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        SDL_MixFloat32Audio = SDL_MixFloat32Audio_AVX;
+    }
+#endif
+
+    mixers_chosen = SDL_TRUE;
+}
 
 int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
                         Uint32 len, int volume)
@@ -230,6 +358,11 @@ int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
     } break;
 
     case SDL_AUDIO_F32LE:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        SDL_ChooseAudioMixers();
+        SDL_MixFloat32Audio((float *)dst, (const float *)src, len / 4, (float)volume / SDL_MIX_MAXVOLUME);
+        break;
+#else
     {
         const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
         const float fvolume = (float)volume;
@@ -256,8 +389,14 @@ int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
             *(dst32++) = SDL_SwapFloatLE((float)dst_sample);
         }
     } break;
+#endif
 
     case SDL_AUDIO_F32BE:
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        SDL_ChooseAudioMixers();
+        SDL_MixFloat32Audio((float *)dst, (const float *)src, len / 4, (float)volume / SDL_MIX_MAXVOLUME);
+        break;
+#else
     {
         const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
         const float fvolume = (float)volume;
@@ -284,6 +423,7 @@ int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
             *(dst32++) = SDL_SwapFloatBE((float)dst_sample);
         }
     } break;
+#endif
 
     default: // If this happens... FIXME!
         return SDL_SetError("SDL_MixAudioFormat(): unknown audio format");
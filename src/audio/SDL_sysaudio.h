@@ -45,6 +45,9 @@ extern void (*SDL_Convert_F32_to_U8)(Uint8 *dst, const float *src, int num_sampl
 extern void (*SDL_Convert_F32_to_S16)(Sint16 *dst, const float *src, int num_samples);
 extern void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_samples);
 
+// This pointer gets set during SDL_ChooseAudioMixers() to various SIMD implementations. Computes dst[i] += src[i] * gain.
+extern void (*SDL_MixFloat32Audio)(float *dst, const float *src, int num_samples, float gain);
+
 // !!! FIXME: These are wordy and unlocalized...
 #define DEFAULT_OUTPUT_DEVNAME "System audio output device"
 #define DEFAULT_INPUT_DEVNAME  "System audio capture device"
@@ -74,6 +77,7 @@ const SDL_AudioFormat *SDL_ClosestAudioFormats(SDL_AudioFormat format);
 
 // Must be called at least once before using converters.
 extern void SDL_ChooseAudioConverters(void);
+extern void SDL_ChooseAudioMixers(void);
 extern void SDL_SetupAudioResampler(void);
 
 /* Backends should call this as devices are added to the system (such as
@@ -110,6 +114,9 @@ extern char *SDL_GetAudioThreadName(SDL_AudioDevice *device, char *buf, size_t b
 extern void RefPhysicalAudioDevice(SDL_AudioDevice *device);
 extern void UnrefPhysicalAudioDevice(SDL_AudioDevice *device);
 
+// Creates a mutex that is shared with an audio thread, so the thread isn't held up by a low priority thread holding it.
+extern SDL_Mutex *SDL_CreateAudioMutex(void);
+
 // These functions are the heart of the audio threads. Backends can call them directly if they aren't using the SDL-provided thread.
 extern void SDL_OutputAudioThreadSetup(SDL_AudioDevice *device);
 extern SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device);
@@ -119,9 +126,65 @@ extern SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device);
 extern void SDL_CaptureAudioThreadShutdown(SDL_AudioDevice *device);
 extern void SDL_AudioThreadFinalize(SDL_AudioDevice *device);
 
+// A format conversion, worked out ahead of time so it can be run over and over without redoing the decisions.
+typedef struct SDL_AudioConvertStep SDL_AudioConvertStep;
+typedef void (*SDL_AudioConvertKernel)(const SDL_AudioConvertStep *step, void *dst, const void *src, int num_frames, float gain);
+
+struct SDL_AudioConvertStep
+{
+    SDL_AudioConvertKernel kernel;
+    SDL_AudioFormat format;  // the format this step works on.
+    int channels;  // the number of channels this step reads.
+    void (*channel_converter)(float *dst, const float *src, int num_frames);
+};
+
+typedef struct SDL_AudioConvertPlan
+{
+    SDL_AudioFormat src_format;
+    int src_channels;
+    SDL_AudioFormat dst_format;
+    int dst_channels;
+    SDL_bool gain;  // SDL_TRUE if this plan applies a gain; if not, it must be run with a gain of 1.0f.
+    int max_frame_size;  // bytes of scratch space needed per sample frame.
+    int copy_frame_size;  // if there are no steps, just copy this many bytes per sample frame.
+    int num_steps;
+    SDL_AudioConvertStep steps[6];
+} SDL_AudioConvertPlan;
+
+extern void SDL_BuildAudioConvertPlan(SDL_AudioConvertPlan *plan, SDL_AudioFormat src_format, int src_channels,
+                                      SDL_AudioFormat dst_format, int dst_channels, SDL_bool gain);
+
+// this gets used from the audio device threads. It has the same rules as ConvertAudio.
+extern void SDL_RunAudioConvertPlan(const SDL_AudioConvertPlan *plan, int num_frames, const void *src, void *dst, void *scratch, float gain);
+
 // this gets used from the audio device threads. It has rules, don't use this if you don't know how to use it!
 extern void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch);
+                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, float gain);
+
+// this gets used from the audio device threads. Same as SDL_GetAudioStreamData, but the stream's gain is not applied; it's
+//  reported through `gain` instead, so the caller can apply it while mixing. `buf` must be in SDL_AUDIO_F32 format.
+extern int GetAudioStreamDataForMixing(SDL_AudioStream *stream, float *buf, int len, float *gain);
+
+// What a bound stream can do for an output device right now; see GetAudioStreamReadiness.
+typedef enum SDL_AudioStreamReadiness
+{
+    SDL_AUDIOSTREAM_WAITING,  // it needs more data from the app first.
+    SDL_AUDIOSTREAM_READY,  // it can fill a device buffer, or its flushed data can, or it has a get callback to ask the app for more.
+    SDL_AUDIOSTREAM_DRAINED  // everything put into it was flushed and has been read out already.
+} SDL_AudioStreamReadiness;
+
+// this gets used from the audio device threads. Reports whether `stream` can supply `frames` sample frames right now.
+//  A stream that was never given data is WAITING, not DRAINED; the app has to put or flush something first.
+extern SDL_AudioStreamReadiness GetAudioStreamReadiness(SDL_AudioStream *stream, int frames);
+
+// Wake anything waiting on `device->streams_changed`. Call this after data is added to or flushed from a bound stream, or the
+//  device's bindings or pause state change. The stream lock (or device lock) must be held, so the device can't go away meanwhile.
+extern void SDL_AudioDeviceStreamsChanged(SDL_AudioDevice *device);
+
+struct SDL_AudioTrack; // forward decl.
+
+// This is used by capture device threads to hand a stream a track of data without waiting on the stream's lock.
+extern void PublishAudioStreamTrack(SDL_AudioStream *stream, struct SDL_AudioTrack *track);
 
 // Special case to let something in SDL_audiocvt.c access something in SDL_audio.c. Don't use this.
 extern void OnAudioStreamCreated(SDL_AudioStream *stream);
@@ -190,17 +253,32 @@ struct SDL_AudioStream
     void *get_callback_userdata;
     SDL_AudioStreamCallback put_callback;
     void *put_callback_userdata;
+    SDL_AtomicInt has_put_callback;  // nonzero if put_callback is set, so lock-free puts can check without the lock.
 
     SDL_AudioSpec src_spec;
     SDL_AudioSpec dst_spec;
     float freq_ratio;
+    float gain;
+    float gain_ramp_target;  // gain we're moving towards, if gain_ramp_frames > 0.
+    int gain_ramp_frames;  // output sample frames left until `gain` reaches `gain_ramp_target`.
+    SDL_AudioResamplerQuality resampler_quality;
 
     struct SDL_AudioQueue* queue;
-    Uint64 total_bytes_queued;
+
+    SDL_bool lock_free;  // SDL_TRUE if created with SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN; src_spec can't change.
+    struct SDL_AudioTrack *lock_free_track;  // the track SDL_PutAudioStreamData writes to without the lock. Only touched by the producer.
+    void *published_tracks;  // SDL_AudioTrack list a capture device pushed without the lock, newest first. Moved into `queue` by whoever holds the lock next.
+    void *recycled_capture_tracks;  // published tracks that have been read, handed back for the capture device to fill again.
+    struct SDL_AudioTrack *spare_capture_tracks;  // recycled tracks the capture device took back. Only touched by the capture thread, under the device lock.
+    SDL_bool drained;  // SDL_TRUE if the last flushed data was read out and nothing has been put since (the queue is empty).
 
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     Sint64 resample_offset;
 
+    SDL_AudioConvertPlan convert_plan;  // input_spec to dst_spec, when not resampling.
+    SDL_AudioConvertPlan resample_input_plan;  // input_spec to float, before resampling.
+    SDL_AudioConvertPlan resample_output_plan;  // float to dst_spec, after resampling.
+
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
@@ -252,6 +330,17 @@ struct SDL_LogicalAudioDevice
     SDL_LogicalAudioDevice *prev;
 };
 
+// One bound stream's share of an iteration of parallel mixing (see SDL_HINT_AUDIO_MIX_THREADS).
+typedef struct SDL_AudioMixJob
+{
+    SDL_LogicalAudioDevice *logdev;
+    SDL_AudioStream *stream;  // NULL marks the start of `logdev`, which might have no streams.
+    float *buffer;
+    float gain;
+    int bytes;
+    SDL_bool deferred;  // the stream has a get callback, so a worker left it for the device thread.
+} SDL_AudioMixJob;
+
 struct SDL_AudioDevice
 {
     // A mutex for locking access to this struct
@@ -260,6 +349,9 @@ struct SDL_AudioDevice
     // A condition variable to protect device close, where we can't hold the device lock forever.
     SDL_Condition *close_cond;
 
+    // Posted by SDL_AudioDeviceStreamsChanged, for backends that wait on the app instead of a clock (like diskaudio in "fast" mode).
+    SDL_Semaphore *streams_changed;
+
     // Reference count of the device; logical devices, device threads, etc, add to this.
     SDL_AtomicInt refcount;
 
@@ -316,6 +408,28 @@ struct SDL_AudioDevice
     // A thread to feed the audio device
     SDL_Thread *thread;
 
+    // Worker threads to get data from bound streams in parallel, if SDL_HINT_AUDIO_MIX_THREADS was set when opening.
+    struct SDL_AudioMixPool *mix_pool;
+    int mix_pool_min_streams;
+    SDL_AudioMixJob *mix_jobs;
+    int mix_jobs_allocation;
+    Uint8 *mix_job_buffers;  // one work_buffer_size buffer per job, so streams don't share scratch space.
+    int mix_job_buffers_count;
+    int mix_job_request_size;
+
+    // Capture devices convert captured data here, once per distinct format the bound streams want.
+    Uint8 *capture_convert_buffer;
+    int capture_convert_buffer_allocation;
+
+    // Counters reported by SDL_GetAudioDeviceProperties. Only the device thread changes these, while holding the device lock.
+    Uint64 stats_iterations;
+    Uint64 stats_underruns;
+    Uint64 stats_iterate_ns;
+    Uint64 stats_iterate_max_ns;
+
+    // Properties reported by SDL_GetAudioDeviceProperties, created on first request.
+    SDL_PropertiesID props;
+
     // SDL_TRUE if this physical device is currently opened by the backend.
     SDL_bool currently_opened;
 
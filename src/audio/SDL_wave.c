@@ -490,15 +490,16 @@ static int MS_ADPCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sample1, Sint32 sample2, Uint8 nybble)
+static const Uint16 MS_ADPCM_adaptive[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230
+};
+
+SDL_FORCE_INLINE Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sample1, Sint32 sample2, Uint8 nybble)
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
     const Uint16 max_deltaval = 65535;
-    const Uint16 adaptive[] = {
-        230, 230, 230, 230, 307, 409, 512, 614,
-        768, 614, 512, 409, 307, 230, 230, 230
-    };
     Sint32 new_sample;
     Sint32 errordelta;
     Uint32 delta = cstate->delta;
@@ -512,7 +513,7 @@ static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sampl
     } else if (new_sample > max_audioval) {
         new_sample = max_audioval;
     }
-    delta = (delta * adaptive[nybble]) / 256;
+    delta = (delta * MS_ADPCM_adaptive[nybble]) / 256;
     if (delta < 16) {
         delta = 16;
     } else if (delta > max_deltaval) {
@@ -589,7 +590,7 @@ static int MS_ADPCM_DecodeBlockHeader(ADPCM_DecoderState *state)
 static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
 {
     Uint16 nybble = 0;
-    Sint16 sample1, sample2;
+    Sint16 sample1[2], sample2[2];
     const Uint32 channels = state->channels;
     Uint32 c;
     MS_ADPCM_ChannelState *cstate = (MS_ADPCM_ChannelState *)state->cstate;
@@ -604,8 +605,18 @@ static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
         blockframesleft = state->framesleft;
     }
 
+    /* Load previous samples which come from the block header. They're kept in
+     * locals from here on instead of being read back from the output.
+     */
+    for (c = 0; c < channels; c++) {
+        sample1[c] = state->output.data[outpos - channels + c];
+        sample2[c] = state->output.data[outpos - channels * 2 + c];
+    }
+
     while (blockframesleft > 0) {
         for (c = 0; c < channels; c++) {
+            Sint16 sample;
+
             if (nybble & 0x4000) {
                 nybble <<= 4;
             } else if (blockpos < blocksize) {
@@ -616,12 +627,10 @@ static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
                 return -1;
             }
 
-            /* Load previous samples which may come from the block header. */
-            sample1 = state->output.data[outpos - channels];
-            sample2 = state->output.data[outpos - channels * 2];
-
-            sample1 = MS_ADPCM_ProcessNibble(cstate + c, sample1, sample2, (nybble >> 4) & 0x0f);
-            state->output.data[outpos++] = sample1;
+            sample = MS_ADPCM_ProcessNibble(cstate + c, sample1[c], sample2[c], (nybble >> 4) & 0x0f);
+            sample2[c] = sample1[c];
+            sample1[c] = sample;
+            state->output.data[outpos++] = sample;
         }
 
         state->framesleft--;
@@ -850,31 +859,35 @@ static int IMA_ADPCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 nybble)
+static const Sint8 IMA_ADPCM_index_table_4b[16] = {
+    -1, -1, -1, -1,
+    2, 4, 6, 8,
+    -1, -1, -1, -1,
+    2, 4, 6, 8
+};
+
+static const Uint16 IMA_ADPCM_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+    143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+    1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767
+};
+
+SDL_FORCE_INLINE Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 nybble)
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
-    const Sint8 index_table_4b[16] = {
-        -1, -1, -1, -1,
-        2, 4, 6, 8,
-        -1, -1, -1, -1,
-        2, 4, 6, 8
-    };
-    const Uint16 step_table[89] = {
-        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
-        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
-        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
-        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
-        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
-        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
-        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
-        22385, 24623, 27086, 29794, 32767
-    };
     Uint32 step;
     Sint32 sample, delta;
     Sint8 index = *cindex;
 
-    /* Clamp index into valid range. */
+    /* Clamp index into valid range. The index is almost always in range, so
+     * these branches predict well and stay off the critical path.
+     */
     if (index > 88) {
         index = 88;
     } else if (index < 0) {
@@ -882,10 +895,10 @@ static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 ny
     }
 
     /* explicit cast to avoid gcc warning about using 'char' as array index */
-    step = step_table[(size_t)index];
+    step = IMA_ADPCM_step_table[(size_t)index];
 
     /* Update index value */
-    *cindex = index + index_table_4b[nybble];
+    *cindex = index + IMA_ADPCM_index_table_4b[nybble];
 
     /* This calculation uses shifts and additions because multiplications were
      * much slower back then. Sadly, this can't just be replaced with an actual
@@ -981,11 +994,14 @@ static int IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     bytesrequired = (blockframesleft + 7) / 8 * subblockframesize;
     if (blockleft < bytesrequired) {
         /* Data truncated. Calculate how many samples we can get out if it. */
-        const size_t guaranteedframes = blockleft / subblockframesize;
+        const size_t guaranteedframes = blockleft / subblockframesize * 8;
         const size_t remainingbytes = blockleft % subblockframesize;
-        blockframesleft = guaranteedframes;
+        Sint64 availableframes = guaranteedframes;
         if (remainingbytes > subblockframesize - 4) {
-            blockframesleft += (Sint64)(remainingbytes % 4) * 2;
+            availableframes += (Sint64)(remainingbytes % 4) * 2;
+        }
+        if (availableframes < blockframesleft) {
+            blockframesleft = availableframes;
         }
         /* Signal the truncation. */
         retval = -1;
@@ -994,28 +1010,40 @@ static int IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     /* Each channel has their nibbles packed into 32-bit blocks. These blocks
      * are interleaved and make up the data part of the ADPCM block. This loop
      * decodes the samples as they come from the input data and puts them at
-     * the appropriate places in the output data.
+     * the appropriate places in the output data. Stereo, by far the most
+     * common layout, decodes both channels side by side: they don't depend on
+     * each other, so the CPU gets two independent chains of work at once.
      */
     while (blockframesleft > 0) {
         const size_t subblocksamples = blockframesleft < 8 ? (size_t)blockframesleft : 8;
+        const Uint8 *subblock = state->block.data + blockpos;
+        Sint16 *out = state->output.data + outpos;
 
-        for (c = 0; c < channels; c++) {
-            Uint8 nybble = 0;
-            /* Load previous sample which may come from the block header. */
-            Sint16 sample = state->output.data[outpos + c - channels];
-
+        if (channels == 2) {
+            Sint8 *cindex = (Sint8 *)state->cstate;
+            /* Load previous samples which may come from the block header. */
+            Sint16 left = out[-2], right = out[-1];
             for (i = 0; i < subblocksamples; i++) {
-                if (i & 1) {
-                    nybble >>= 4;
-                } else {
-                    nybble = state->block.data[blockpos++];
+                const unsigned int shift = (unsigned int)(i & 1) * 4;
+                left = IMA_ADPCM_ProcessNibble(cindex, left, (subblock[i >> 1] >> shift) & 0x0f);
+                right = IMA_ADPCM_ProcessNibble(cindex + 1, right, (subblock[4 + (i >> 1)] >> shift) & 0x0f);
+                out[i * 2] = left;
+                out[i * 2 + 1] = right;
+            }
+        } else {
+            for (c = 0; c < channels; c++) {
+                /* Load previous sample which may come from the block header. */
+                Sint16 sample = out[(Sint64)c - channels];
+
+                for (i = 0; i < subblocksamples; i++) {
+                    const Uint8 nybble = (subblock[c * 4 + (i >> 1)] >> ((i & 1) * 4)) & 0x0f;
+                    sample = IMA_ADPCM_ProcessNibble((Sint8 *)state->cstate + c, sample, nybble);
+                    out[c + i * channels] = sample;
                 }
-
-                sample = IMA_ADPCM_ProcessNibble((Sint8 *)state->cstate + c, sample, nybble & 0x0f);
-                state->output.data[outpos + c + i * channels] = sample;
             }
         }
 
+        blockpos += SDL_min(subblockframesize, blocksize - blockpos);
         outpos += channels * subblocksamples;
         state->framesleft -= subblocksamples;
         blockframesleft -= subblocksamples;
@@ -1158,52 +1186,165 @@ static int LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+static const Sint16 alaw_lut[256] = {
+    -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
+    -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
+    -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
+    -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
+    -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
+    -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
+    -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
+    -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
+    5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
+    2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
+    20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
+    10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
+    328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
+    72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
+    1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
+    656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
+};
+static const Sint16 mulaw_lut[256] = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
+    -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
+    -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
+    -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
+    -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
+    -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
+    -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
+    -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
+    31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
+    15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
+    7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
+    3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
+    1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
+    844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
+    356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
+    112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
+};
+
+#ifdef SDL_SSE4_1_INTRINSICS
+/* Expands 16 companded bytes at a time. Works backwards from the end of buf,
+ * like the scalar code, and returns the number of samples left to expand at
+ * the start. Every block is loaded before its expanded samples are stored,
+ * and the stores never reach bytes that haven't been loaded yet, so this is
+ * safe to do in-place.
+ *
+ * Both encodings boil down to (base << exponent), with a sign applied. The
+ * base and the power of two for the exponent fit in bytes, so they're worked
+ * out 16 at a time with byte operations and a table lookup (pshufb), then
+ * widened and multiplied.
+ */
+static size_t SDL_TARGETING("sse4.1") LAW_Expand_SSE41(Uint16 encoding, Uint8 *buf, size_t sample_count)
 {
-#ifdef SDL_WAVE_LAW_LUT
-    const Sint16 alaw_lut[256] = {
-        -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
-        -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
-        -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
-        -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
-        -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
-        -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
-        -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
-        -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
-        5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
-        2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
-        20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
-        10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
-        328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
-        72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
-        1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
-        656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
-    };
-    const Sint16 mulaw_lut[256] = {
-        -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
-        -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
-        -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
-        -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
-        -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
-        -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
-        -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
-        -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
-        31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
-        15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
-        7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
-        3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
-        1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
-        844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
-        356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
-        112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
-    };
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+    const __m128i exponent_mask = _mm_set1_epi8(0x07);
+    const __m128i mulaw_pow = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i alaw_pow = _mm_setr_epi8(1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i alaw_high = _mm_setr_epi8(0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mulaw_bias = _mm_set1_epi16(0x84);
+    Sint16 *dst = (Sint16 *)buf;
+    size_t i = sample_count;
+
+    while (i >= 16) {
+        __m128i bytes, exponent, pow, base_lo, base_hi, negative;
+        __m128i base0, base1, pow0, pow1, negative0, negative1, mag0, mag1;
+
+        i -= 16;
+        bytes = _mm_loadu_si128((const __m128i *)(buf + i));
+
+        if (encoding == MULAW_CODE) {
+            /* ((mantissa << 3) + 0x84) << exponent) - 0x84, on the inverted byte. */
+            const __m128i x = _mm_xor_si128(bytes, _mm_set1_epi8((char)0xff));
+            exponent = _mm_and_si128(_mm_srli_epi16(x, 4), exponent_mask);
+            pow = _mm_shuffle_epi8(mulaw_pow, exponent);
+            base_lo = _mm_add_epi8(_mm_and_si128(_mm_slli_epi16(x, 3), _mm_set1_epi8(0x78)), _mm_set1_epi8((char)0x84));
+            base_hi = zero;
+            negative = _mm_cmplt_epi8(x, zero);
+        } else {
+            /* (((mantissa << 4) | 0x8) + (exponent ? 0x100 : 0)) << (exponent ? exponent - 1 : 0) */
+            const __m128i x = _mm_xor_si128(bytes, _mm_set1_epi8(0x55));
+            exponent = _mm_and_si128(_mm_srli_epi16(x, 4), exponent_mask);
+            pow = _mm_shuffle_epi8(alaw_pow, exponent);
+            base_lo = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(x, low_nibble), 4), _mm_set1_epi8(0x08));
+            base_hi = _mm_shuffle_epi8(alaw_high, exponent);
+            negative = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-1));
+        }
+
+        base0 = _mm_unpacklo_epi8(base_lo, base_hi);
+        base1 = _mm_unpackhi_epi8(base_lo, base_hi);
+        pow0 = _mm_unpacklo_epi8(pow, zero);
+        pow1 = _mm_unpackhi_epi8(pow, zero);
+        negative0 = _mm_unpacklo_epi8(negative, negative);
+        negative1 = _mm_unpackhi_epi8(negative, negative);
+
+        mag0 = _mm_mullo_epi16(base0, pow0);
+        mag1 = _mm_mullo_epi16(base1, pow1);
+        if (encoding == MULAW_CODE) {
+            mag0 = _mm_sub_epi16(mag0, mulaw_bias);
+            mag1 = _mm_sub_epi16(mag1, mulaw_bias);
+        }
+
+        /* Conditional negation: (x ^ mask) - mask */
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_sub_epi16(_mm_xor_si128(mag0, negative0), negative0));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_sub_epi16(_mm_xor_si128(mag1, negative1), negative1));
+    }
+
+    return i;
+}
+#endif
+
+/* Expands sample_count companded bytes at the start of buf to 16-bit samples, in-place. */
+static int LAW_Expand(Uint16 encoding, Uint8 *buf, size_t sample_count)
+{
+    const Uint8 *src = buf;
+    Sint16 *dst = (Sint16 *)buf;
+    const Sint16 *lut;
+    size_t i;
+
+    switch (encoding) {
+    case ALAW_CODE:
+        lut = alaw_lut;
+        break;
+    case MULAW_CODE:
+        lut = mulaw_lut;
+        break;
+    default:
+        return SDL_SetError("Unknown companded encoding");
+    }
+
+    /* Work backwards, since we're expanding in-place. `format` will
+     * inform the caller about the byte order.
+     */
+    i = sample_count;
+
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        i = LAW_Expand_SSE41(encoding, buf, i);
+    }
 #endif
 
+    while (i >= 4) {
+        i -= 4;
+        dst[i + 3] = lut[src[i + 3]];
+        dst[i + 2] = lut[src[i + 2]];
+        dst[i + 1] = lut[src[i + 1]];
+        dst[i] = lut[src[i]];
+    }
+    while (i--) {
+        dst[i] = lut[src[i]];
+    }
+
+    return 0;
+}
+
+static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
+    size_t sample_count, expanded_len;
     Uint8 *src;
-    Sint16 *dst;
 
     if (chunk->length != chunk->size) {
         file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
@@ -1239,59 +1380,9 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     chunk->data = NULL;
     chunk->size = 0;
 
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
-#ifdef SDL_WAVE_LAW_LUT
-    case ALAW_CODE:
-        while (i--) {
-            dst[i] = alaw_lut[src[i]];
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            dst[i] = mulaw_lut[src[i]];
-        }
-        break;
-#else
-    case ALAW_CODE:
-        while (i--) {
-            Uint8 nibble = src[i];
-            Uint8 exponent = (nibble & 0x7f) ^ 0x55;
-            Sint16 mantissa = exponent & 0xf;
-
-            exponent >>= 4;
-            if (exponent > 0) {
-                mantissa |= 0x10;
-            }
-            mantissa = (mantissa << 4) | 0x8;
-            if (exponent > 1) {
-                mantissa <<= exponent - 1;
-            }
-
-            dst[i] = nibble & 0x80 ? mantissa : -mantissa;
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            Uint8 nibble = ~src[i];
-            Sint16 mantissa = nibble & 0xf;
-            Uint8 exponent = (nibble >> 4) & 0x7;
-            Sint16 step = 4 << (exponent + 1);
-
-            mantissa = (0x80 << exponent) + step * mantissa + step / 2 - 132;
-
-            dst[i] = nibble & 0x80 ? -mantissa : mantissa;
-        }
-        break;
-#endif
-    default:
+    if (LAW_Expand(format->encoding, src, sample_count) < 0) {
         SDL_free(src);
-        return SDL_SetError("Unknown companded encoding");
+        return -1;
     }
 
     *audio_buf = src;
@@ -1343,11 +1434,33 @@ static int PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts sample_count 24-bit samples at the start of ptr to 32 bits, in-place. */
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1375,21 +1488,7 @@ static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return 0;
 }
@@ -1769,7 +1868,10 @@ static int WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads the headers and leaves file->chunk describing the data chunk, without
+ * reading its data. The position after the WAVE data is reported in endpos.
+ */
+static int WaveLoadHeader(SDL_RWops *src, WaveFile *file, Sint64 *endpos)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1777,7 +1879,6 @@ static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 *
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1980,9 +2081,76 @@ static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 *
 
     WaveFreeChunkData(chunk);
 
-    /* Process data chunk. */
     *chunk = datachunk;
 
+    /* Report the end position back to the caller. */
+    if (RIFFlengthknown) {
+        *endpos = RIFFend;
+    } else {
+        *endpos = lastchunkpos;
+    }
+
+    return 0;
+}
+
+/* Setting up the specs. All unsupported formats were filtered out
+ * by the checks in WaveLoadHeader.
+ */
+static int WaveGetSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = 0;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    return 0;
+}
+
+static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endpos;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (WaveLoadHeader(src, file, &endpos) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
@@ -2026,51 +2194,12 @@ static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 *
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = 0;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
+    if (WaveGetSpec(file, spec) < 0) {
+        return -1;
     }
 
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endpos;
 
     return 0;
 }
@@ -2127,3 +2256,318 @@ int SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32
     return SDL_LoadWAV_RW(SDL_RWFromFile(path, "rb"), 1, spec, audio_buf, audio_len);
 }
 
+
+/* Streaming decoder. The headers are parsed the same way as SDL_LoadWAV_RW, but
+ * the data chunk is read and decoded piece by piece, as an audio stream asks for
+ * more data through its get callback.
+ */
+
+#define WAVE_STREAM_PROPERTY   "SDL.audiostream.wave"
+#define WAVE_STREAM_MAX_FRAMES 4096 /* Sample frames of PCM or companded data decoded at a time. */
+
+typedef struct WaveStream
+{
+    WaveFile file; /* file.chunk describes the data chunk. Its data is never loaded. */
+    SDL_RWops *src;
+    SDL_bool freesrc;
+    size_t framesize; /* Size of a decoded sample frame in bytes. */
+    Sint64 frame;     /* Next sample frame to put into the audio stream. */
+    SDL_bool ended;   /* No more data, and the audio stream has been flushed. */
+
+    /* For PCM, this holds the data before and after it's converted in-place.
+     * For ADPCM, this holds one block of input, and output holds the decoded block.
+     */
+    Uint8 *buffer;
+    size_t buffersize;
+    Sint16 *output;
+    void *cstate;
+} WaveStream;
+
+static void DestroyWaveStream(WaveStream *ws)
+{
+    if (ws->freesrc && ws->src) {
+        SDL_RWclose(ws->src);
+    }
+    WaveFreeChunkData(&ws->file.chunk);
+    SDL_free(ws->file.decoderdata);
+    SDL_free(ws->buffer);
+    SDL_free(ws->output);
+    SDL_free(ws->cstate);
+    SDL_free(ws);
+}
+
+static void SDLCALL CleanupWaveStream(void *userdata, void *value)
+{
+    DestroyWaveStream((WaveStream *)value);
+}
+
+/* Reads up to len bytes of the data chunk, starting at offset. Returns the number of bytes read. */
+static size_t WaveStreamRead(WaveStream *ws, Uint64 offset, Uint8 *buf, size_t len)
+{
+    const WaveChunk *chunk = &ws->file.chunk;
+    const Sint64 position = chunk->position + (Sint64)offset;
+
+    if (offset >= chunk->length) {
+        return 0;
+    } else if (len > chunk->length - offset) {
+        len = (size_t)(chunk->length - offset);
+    }
+
+    if (SDL_RWseek(ws->src, position, SDL_RW_SEEK_SET) != position) {
+        return 0;
+    }
+
+    return SDL_RWread(ws->src, buf, len);
+}
+
+/* Decodes the next few sample frames of PCM or companded data into buffer.
+ * Returns the number of sample frames decoded, or -1 on error.
+ */
+static Sint64 WaveStreamDecodePCM(WaveStream *ws, Sint64 frames)
+{
+    const WaveFormat *format = &ws->file.format;
+    const size_t sample_count_per_frame = format->channels;
+    const size_t bytesread = WaveStreamRead(ws, (Uint64)ws->frame * format->blockalign, ws->buffer, (size_t)frames * format->blockalign);
+
+    frames = (Sint64)(bytesread / format->blockalign);
+    if (frames < 1) {
+        return 0;
+    }
+
+    if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+        if (LAW_Expand(format->encoding, ws->buffer, (size_t)frames * sample_count_per_frame) < 0) {
+            return -1;
+        }
+    } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+        PCM_ExpandSint24ToSint32(ws->buffer, (size_t)frames * sample_count_per_frame);
+    }
+
+    return frames;
+}
+
+/* Decodes the ADPCM block that holds the next sample frame into output.
+ * Returns the number of sample frames in the block, starting at its first one, or -1 on error.
+ */
+static Sint64 WaveStreamDecodeADPCM(WaveStream *ws, Sint64 blockindex)
+{
+    const WaveFormat *format = &ws->file.format;
+    ADPCM_DecoderState state;
+    int result;
+
+    SDL_zero(state);
+    state.channels = format->channels;
+    state.blocksize = format->blockalign;
+    state.samplesperblock = format->samplesperblock;
+    state.framesize = state.channels * sizeof(Sint16);
+    state.ddata = ws->file.decoderdata;
+    state.cstate = ws->cstate;
+    state.framestotal = ws->file.sampleframes;
+    state.framesleft = state.framestotal - blockindex * (Sint64)state.samplesperblock;
+
+    if (format->encoding == MS_ADPCM_CODE) {
+        state.blockheadersize = (size_t)state.channels * 7;
+    } else {
+        state.blockheadersize = (size_t)state.channels * 4;
+    }
+
+    state.block.data = ws->buffer;
+    state.block.size = WaveStreamRead(ws, (Uint64)blockindex * state.blocksize, ws->buffer, state.blocksize);
+    state.block.pos = 0;
+
+    if (state.block.size < state.blockheadersize) {
+        /* End of the data, or a block too short to get anything from. */
+        if (state.block.size > 0 && (ws->file.trunchint == TruncVeryStrict || ws->file.trunchint == TruncStrict)) {
+            return SDL_SetError("Truncated data chunk");
+        }
+        return 0;
+    }
+
+    state.output.data = ws->output;
+    state.output.size = state.samplesperblock * state.channels;
+    state.output.pos = 0;
+
+    if (format->encoding == MS_ADPCM_CODE) {
+        result = MS_ADPCM_DecodeBlockHeader(&state);
+        if (result == 0) {
+            result = MS_ADPCM_DecodeBlockData(&state);
+        }
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(&state);
+        if (result == 0) {
+            result = IMA_ADPCM_DecodeBlockData(&state);
+        }
+    }
+
+    if (result == -1) {
+        /* Unexpected end. Return partial data if the hints allow it. */
+        if (ws->file.trunchint == TruncVeryStrict || ws->file.trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (ws->file.trunchint != TruncDropFrame) {
+            state.output.pos -= state.output.pos % (state.samplesperblock * state.channels);
+        }
+    }
+
+    return (Sint64)(state.output.pos / state.channels);
+}
+
+/* Decodes some data and puts it into the stream. Returns the number of bytes put, 0 at the end, or -1 on error. */
+static int WaveStreamPut(WaveStream *ws, SDL_AudioStream *stream, int wanted)
+{
+    const WaveFormat *format = &ws->file.format;
+    const Uint8 *data;
+    Sint64 frames;
+
+    if (ws->frame >= ws->file.sampleframes) {
+        return 0;
+    }
+
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        /* Always decode a whole block, then skip to where we are in it. */
+        const Sint64 blockindex = ws->frame / format->samplesperblock;
+        const Sint64 skip = ws->frame - blockindex * format->samplesperblock;
+        frames = WaveStreamDecodeADPCM(ws, blockindex);
+        if (frames <= skip) {
+            return (frames < 0) ? -1 : 0;
+        }
+        data = (const Uint8 *)ws->output + (size_t)skip * ws->framesize;
+        frames -= skip;
+    } else {
+        frames = (Sint64)(wanted / ws->framesize) + 1;
+        frames = SDL_min(frames, WAVE_STREAM_MAX_FRAMES);
+        frames = SDL_min(frames, ws->file.sampleframes - ws->frame);
+        frames = WaveStreamDecodePCM(ws, frames);
+        if (frames <= 0) {
+            return (int)frames;
+        }
+        data = ws->buffer;
+    }
+
+    frames = SDL_min(frames, ws->file.sampleframes - ws->frame);
+    if (SDL_PutAudioStreamData(stream, data, (int)((size_t)frames * ws->framesize)) < 0) {
+        return -1;
+    }
+    ws->frame += frames;
+
+    return (int)((size_t)frames * ws->framesize);
+}
+
+static void SDLCALL WaveStreamGetCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *ws = (WaveStream *)userdata;
+
+    while (additional_amount > 0 && !ws->ended) {
+        const int put = WaveStreamPut(ws, stream, additional_amount);
+        if (put <= 0) {
+            /* At the end of the data, or the rest of it can't be decoded. Either way, let the stream drain. */
+            SDL_FlushAudioStream(stream);
+            ws->ended = SDL_TRUE;
+            break;
+        }
+        additional_amount -= put;
+    }
+}
+
+SDL_AudioStream *SDL_LoadWAVStream_RW(SDL_RWops *src, SDL_bool freesrc, SDL_AudioSpec *spec, Sint64 *sample_frames)
+{
+    SDL_AudioStream *stream = NULL;
+    WaveStream *ws = NULL;
+    WaveFormat *format;
+    Sint64 endpos;
+
+    /* Make sure we are passed a valid data source */
+    if (!src) {
+        goto done; /* Error may come from RWops. */
+    } else if (!spec) {
+        SDL_InvalidParamError("spec");
+        goto done;
+    }
+
+    ws = (WaveStream *)SDL_calloc(1, sizeof(*ws));
+    if (!ws) {
+        goto done;
+    }
+    ws->src = src;
+    ws->freesrc = freesrc;
+    ws->file.riffhint = WaveGetRiffSizeHint();
+    ws->file.trunchint = WaveGetTruncationHint();
+    ws->file.facthint = WaveGetFactChunkHint();
+    format = &ws->file.format;
+
+    if (WaveLoadHeader(src, &ws->file, &endpos) < 0 || WaveGetSpec(&ws->file, spec) < 0) {
+        goto done;
+    }
+
+    ws->framesize = SDL_AUDIO_FRAMESIZE(*spec);
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        ws->buffersize = format->blockalign;
+        ws->output = (Sint16 *)SDL_malloc(format->samplesperblock * ws->framesize);
+        ws->cstate = (format->encoding == MS_ADPCM_CODE) ? SDL_calloc(format->channels, sizeof(MS_ADPCM_ChannelState)) : SDL_calloc(format->channels, sizeof(Sint8));
+        if (!ws->output || !ws->cstate) {
+            goto done;
+        }
+        break;
+    default:
+        /* Big enough for the data before and after it's expanded. */
+        ws->buffersize = (size_t)WAVE_STREAM_MAX_FRAMES * SDL_max(format->blockalign, ws->framesize);
+        break;
+    }
+
+    ws->buffer = (Uint8 *)SDL_malloc(ws->buffersize);
+    if (!ws->buffer) {
+        goto done;
+    }
+
+    stream = SDL_CreateAudioStream(spec, spec);
+    if (!stream) {
+        goto done;
+    }
+
+    if (SDL_SetPropertyWithCleanup(SDL_GetAudioStreamProperties(stream), WAVE_STREAM_PROPERTY, ws, CleanupWaveStream, NULL) < 0) {
+        SDL_DestroyAudioStream(stream);
+        stream = NULL;
+        goto done;
+    }
+
+    /* The stream owns the decoder (and src) now. */
+    SDL_SetAudioStreamGetCallback(stream, WaveStreamGetCallback, ws);
+    if (sample_frames) {
+        *sample_frames = ws->file.sampleframes;
+    }
+    return stream;
+
+done:
+    if (ws) {
+        DestroyWaveStream(ws);
+    } else if (freesrc && src) {
+        SDL_RWclose(src);
+    }
+    return NULL;
+}
+
+int SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame)
+{
+    WaveStream *ws;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (frame < 0) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    ws = (WaveStream *)SDL_GetProperty(SDL_GetAudioStreamProperties(stream), WAVE_STREAM_PROPERTY, NULL);
+    if (!ws) {
+        return SDL_SetError("Audio stream was not created by SDL_LoadWAVStream_RW");
+    }
+
+    /* The get callback runs with the stream locked, so this keeps it away from the decoder. */
+    SDL_LockAudioStream(stream);
+    SDL_ClearAudioStream(stream);
+    ws->frame = SDL_min(frame, ws->file.sampleframes);
+    ws->ended = SDL_FALSE;
+    SDL_UnlockAudioStream(stream);
+
+    return 0;
+}
@@ -34,28 +34,104 @@
 #define DISKENVR_INFILE     "SDL_DISKAUDIOFILEIN"
 #define DISKDEFAULT_INFILE  "sdlaudio-in.raw"
 #define DISKENVR_IODELAY    "SDL_DISKAUDIODELAY"
+// Set this to "fast" to write output as fast as the app supplies it, instead of in real time.
+#define DISKENVR_TIMING     "SDL_DISKAUDIOTIMING"
+
+// Output is gathered into blocks of about this size before going to the file.
+#define DISKDEFAULT_WRITEBUF (1024 * 1024)
+
+// Lock-free streams only say they have new data at the start of a track, so "fast" mode looks again this
+//  often even if nothing says the streams changed.
+#define DISKAUDIO_FAST_RECHECK_MS 10
+
+// In "fast" mode, the device doesn't follow a clock at all: it plays a buffer once every stream bound to an
+// unpaused logical device can fill it (or has been flushed and played out), and otherwise waits for the app.
+// Since it never mixes one stream ahead of another, the file holds exactly what the app produced, no matter
+// how long producing it took, so an offline render gets the same output every time, as quickly as it can.
+static SDL_bool DISKAUDIO_StreamsAreReady(SDL_AudioDevice *device)
+{
+    SDL_bool any_ready = SDL_FALSE;
+    SDL_bool all_ready = SDL_TRUE;
+
+    SDL_LockMutex(device->lock);
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev && all_ready; logdev = logdev->next) {
+        if (SDL_AtomicGet(&logdev->paused)) {
+            continue;
+        }
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            const SDL_AudioStreamReadiness readiness = GetAudioStreamReadiness(stream, device->sample_frames);
+            if (readiness == SDL_AUDIOSTREAM_READY) {
+                any_ready = SDL_TRUE;
+            } else if (readiness == SDL_AUDIOSTREAM_WAITING) {
+                all_ready = SDL_FALSE;
+                break;
+            }
+        }
+    }
+    SDL_UnlockMutex(device->lock);
+
+    return any_ready && all_ready;
+}
 
 static int DISKAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
-    SDL_Delay(device->hidden->io_delay);
+    struct SDL_PrivateAudioData *h = device->hidden;
+
+    if (h->fast && !device->iscapture) {
+        while (!SDL_AtomicGet(&device->shutdown) && !DISKAUDIO_StreamsAreReady(device)) {
+            SDL_WaitSemaphoreTimeout(device->streams_changed, DISKAUDIO_FAST_RECHECK_MS);
+        }
+        return 0;
+    }
+
+    // Keep time against a running clock, so the time spent mixing and writing doesn't add up to drift.
+    const Uint64 now = SDL_GetTicksNS();
+    if ((h->next_wake_ns == 0) || (now > (h->next_wake_ns + (h->period_ns * 2)))) {
+        h->next_wake_ns = now;  // first buffer, or we fell way behind: start the clock over instead of rushing to catch up.
+    }
+    h->next_wake_ns += h->period_ns;
+    if (h->next_wake_ns > now) {
+        SDL_DelayNS(h->next_wake_ns - now);
+    }
     return 0;
 }
 
-static int DISKAUDIO_PlayDevice(SDL_AudioDevice *device, const Uint8 *buffer, int buffer_size)
+static int DISKAUDIO_FlushWriteBuffer(SDL_AudioDevice *device)
 {
-    const int written = (int)SDL_RWwrite(device->hidden->io, buffer, (size_t)buffer_size);
-    if (written != buffer_size) { // If we couldn't write, assume fatal error for now
-        return -1;
-    }
+    struct SDL_PrivateAudioData *h = device->hidden;
+
+    if (h->writebuf_used > 0) {
+        const int written = (int)SDL_RWwrite(h->io, h->writebuf, (size_t)h->writebuf_used);
+        if (written != h->writebuf_used) { // If we couldn't write, assume fatal error for now
+            return -1;
+        }
 #ifdef DEBUG_AUDIO
-    SDL_Log("DISKAUDIO: Wrote %d bytes of audio data", (int) written);
+        SDL_Log("DISKAUDIO: Wrote %d bytes of audio data", (int) written);
 #endif
+        h->bytes_written += written;
+        h->writebuf_used = 0;
+    }
+    return 0;
+}
+
+static int DISKAUDIO_PlayDevice(SDL_AudioDevice *device, const Uint8 *buffer, int buffer_size)
+{
+    struct SDL_PrivateAudioData *h = device->hidden;
+
+    SDL_assert(buffer == (h->writebuf + h->writebuf_used));  // we always hand out the next piece of the write buffer.
+    h->writebuf_used += buffer_size;
+
+    // only go to the file when there isn't room for another device buffer.
+    if ((h->writebuf_size - h->writebuf_used) < device->buffer_size) {
+        return DISKAUDIO_FlushWriteBuffer(device);
+    }
     return 0;
 }
 
 static Uint8 *DISKAUDIO_GetDeviceBuf(SDL_AudioDevice *device, int *buffer_size)
 {
-    return device->hidden->mixbuf;
+    struct SDL_PrivateAudioData *h = device->hidden;
+    return h->writebuf + h->writebuf_used;
 }
 
 static int DISKAUDIO_CaptureFromDevice(SDL_AudioDevice *device, void *buffer, int buflen)
@@ -84,13 +160,55 @@ static void DISKAUDIO_FlushCapture(SDL_AudioDevice *device)
     // no op...we don't advance the file pointer or anything.
 }
 
+// This writes a plain 44-byte WAVE header. It's written once with no data when the file is opened, and again with
+// the final sizes when it's closed, so a file from a crashed program still starts with something readable.
+static int DISKAUDIO_WriteWaveHeader(SDL_AudioDevice *device)
+{
+    struct SDL_PrivateAudioData *h = device->hidden;
+    const SDL_AudioSpec *spec = &device->spec;
+    const Uint32 framesize = (Uint32)SDL_AUDIO_FRAMESIZE(*spec);
+    const Uint32 datalen = (Uint32)SDL_min(h->bytes_written, (Uint64)(SDL_MAX_UINT32 - 37));  // WAVE files can't describe more than 4 gigabytes.
+    const Uint32 padding = (datalen & 1);  // RIFF chunks have an even length, but the data chunk's size doesn't count the pad byte.
+    SDL_RWops *io = h->io;
+
+    if (SDL_RWseek(io, 0, SDL_RW_SEEK_SET) != 0) {
+        return -1;
+    }
+
+    if (!SDL_WriteU32LE(io, 0x46464952) || // RIFF
+        !SDL_WriteU32LE(io, 36 + datalen + padding) ||
+        !SDL_WriteU32LE(io, 0x45564157) || // WAVE
+        !SDL_WriteU32LE(io, 0x20746D66) || // fmt
+        !SDL_WriteU32LE(io, 16) ||
+        !SDL_WriteU16LE(io, SDL_AUDIO_ISFLOAT(spec->format) ? 0x0003 : 0x0001) || // IEEE float or PCM
+        !SDL_WriteU16LE(io, (Uint16)spec->channels) ||
+        !SDL_WriteU32LE(io, (Uint32)spec->freq) ||
+        !SDL_WriteU32LE(io, (Uint32)spec->freq * framesize) ||
+        !SDL_WriteU16LE(io, (Uint16)framesize) ||
+        !SDL_WriteU16LE(io, (Uint16)SDL_AUDIO_BITSIZE(spec->format)) ||
+        !SDL_WriteU32LE(io, 0x61746164) || // data
+        !SDL_WriteU32LE(io, datalen)) {
+        return -1;
+    }
+    return 0;
+}
+
 static void DISKAUDIO_CloseDevice(SDL_AudioDevice *device)
 {
     if (device->hidden) {
         if (device->hidden->io) {
+            if (!device->iscapture) {
+                DISKAUDIO_FlushWriteBuffer(device);
+                if (device->hidden->wav) {
+                    if (device->hidden->bytes_written & 1) {
+                        SDL_WriteU8(device->hidden->io, 0);  // pad the data chunk to an even length.
+                    }
+                    DISKAUDIO_WriteWaveHeader(device);
+                }
+            }
             SDL_RWclose(device->hidden->io);
         }
-        SDL_free(device->hidden->mixbuf);
+        SDL_free(device->hidden->writebuf);
         SDL_free(device->hidden);
         device->hidden = NULL;
     }
@@ -105,21 +223,54 @@ static const char *get_filename(const SDL_bool iscapture)
     return devname;
 }
 
+static SDL_bool is_wave_filename(const char *fname)
+{
+    const size_t len = SDL_strlen(fname);
+    return (len >= 4) && (SDL_strcasecmp(fname + len - 4, ".wav") == 0);
+}
+
 static int DISKAUDIO_OpenDevice(SDL_AudioDevice *device)
 {
     SDL_bool iscapture = device->iscapture;
     const char *fname = get_filename(iscapture);
     const char *envr = SDL_getenv(DISKENVR_IODELAY);
+    const char *timing = SDL_getenv(DISKENVR_TIMING);
 
     device->hidden = (struct SDL_PrivateAudioData *) SDL_calloc(1, sizeof(*device->hidden));
     if (!device->hidden) {
         return -1;
     }
 
+    device->hidden->fast = (timing && (SDL_strcasecmp(timing, "fast") == 0));
+    device->hidden->wav = (!iscapture && is_wave_filename(fname));
+
+    if (device->hidden->wav) {
+        // WAVE files are little endian, and their 8-bit samples are unsigned.
+        switch (device->spec.format) {
+        case SDL_AUDIO_S8:
+            device->spec.format = SDL_AUDIO_U8;
+            break;
+        case SDL_AUDIO_S16BE:
+            device->spec.format = SDL_AUDIO_S16LE;
+            break;
+        case SDL_AUDIO_S32BE:
+            device->spec.format = SDL_AUDIO_S32LE;
+            break;
+        case SDL_AUDIO_F32BE:
+            device->spec.format = SDL_AUDIO_F32LE;
+            break;
+        default:
+            break;
+        }
+        SDL_UpdatedAudioDeviceFormat(device);
+    }
+
     if (envr) {
         device->hidden->io_delay = SDL_atoi(envr);
+        device->hidden->period_ns = SDL_MS_TO_NS(device->hidden->io_delay);
     } else {
         device->hidden->io_delay = ((device->sample_frames * 1000) / device->spec.freq);
+        device->hidden->period_ns = ((Uint64)device->sample_frames * SDL_NS_PER_SECOND) / device->spec.freq;
     }
 
     // Open the "audio device"
@@ -128,13 +279,17 @@ static int DISKAUDIO_OpenDevice(SDL_AudioDevice *device)
         return -1;
     }
 
-    // Allocate mixing buffer
+    // Allocate the write buffer, which holds a whole number of device buffers.
     if (!iscapture) {
-        device->hidden->mixbuf = (Uint8 *)SDL_malloc(device->buffer_size);
-        if (!device->hidden->mixbuf) {
+        device->hidden->writebuf_size = SDL_max(DISKDEFAULT_WRITEBUF / device->buffer_size, 1) * device->buffer_size;
+        device->hidden->writebuf = (Uint8 *)SDL_malloc(device->hidden->writebuf_size);
+        if (!device->hidden->writebuf) {
+            return -1;
+        }
+
+        if (device->hidden->wav && (DISKAUDIO_WriteWaveHeader(device) < 0)) {
             return -1;
         }
-        SDL_memset(device->hidden->mixbuf, device->silence_value, device->buffer_size);
     }
 
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO, "You are using the SDL disk i/o audio driver!");
@@ -30,7 +30,15 @@ struct SDL_PrivateAudioData
     // The file descriptor for the audio device
     SDL_RWops *io;
     Uint32 io_delay;
-    Uint8 *mixbuf;
+    SDL_bool fast;  // play as fast as the app supplies data, instead of in real time.
+    SDL_bool wav;   // write a WAVE header ahead of the data.
+    Uint64 period_ns;  // how long each buffer lasts in real time.
+    Uint64 next_wake_ns;  // when the next buffer is due, in real time.
+    // Output is mixed straight into this, and written out when it fills up.
+    Uint8 *writebuf;
+    int writebuf_size;
+    int writebuf_used;
+    Uint64 bytes_written;
 };
 
 #endif // SDL_diskaudio_h_
@@ -23,6 +23,7 @@
 #if defined(__WIN32__) || defined(__WINRT__) || defined(__GDK__)
 #include "../core/windows/SDL_windows.h"
 #endif
+#include "SDL_cpuinfo_c.h"
 
 /* CPU feature detection for SDL */
 
@@ -74,6 +75,11 @@
 #include <sys/auxv.h>
 #endif
 
+#ifdef __LINUX__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #ifdef __RISCOS__
 #include <kernel.h>
 #include <swis.h>
@@ -646,6 +652,271 @@ int SDL_GetCPUCount(void)
     return SDL_CPUCount;
 }
 
+int *SDL_ParseCPUList(const char *list, int *count)
+{
+    int *cpus = NULL;
+    int num_cpus = 0;
+    int max_cpus = 0;
+
+    *count = 0;
+    for (;;) {
+        char *end;
+        long first, last, i;
+
+        first = SDL_strtol(list, &end, 10);
+        if (end == list || first < 0) {
+            break;
+        }
+        list = end;
+        last = first;
+        if (*list == '-') {
+            ++list;
+            last = SDL_strtol(list, &end, 10);
+            if (end == list || last < first) {
+                break;
+            }
+            list = end;
+        }
+        /* Nobody has this many CPUs, the list is bogus */
+        if (last >= 65536) {
+            break;
+        }
+
+        for (i = first; i <= last; ++i) {
+            if (num_cpus == max_cpus) {
+                int *new_cpus;
+                max_cpus = max_cpus ? (max_cpus * 2) : 16;
+                new_cpus = (int *)SDL_realloc(cpus, max_cpus * sizeof(*cpus));
+                if (!new_cpus) {
+                    SDL_free(cpus);
+                    SDL_OutOfMemory();
+                    return NULL;
+                }
+                cpus = new_cpus;
+            }
+            cpus[num_cpus++] = (int)i;
+        }
+
+        if (*list != ',') {
+            /* Sysfs files end with a newline */
+            while (*list == ' ' || *list == '\n') {
+                ++list;
+            }
+            if (*list == '\0') {
+                *count = num_cpus;
+                return cpus;
+            }
+            break;
+        }
+        ++list;
+    }
+
+    SDL_free(cpus);
+    SDL_SetError("Invalid CPU list");
+    return NULL;
+}
+
+#ifdef __LINUX__
+static SDL_bool SDL_ReadSysfsFile(const char *path, char *buf, size_t buflen)
+{
+    ssize_t len;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return SDL_FALSE;
+    }
+    len = read(fd, buf, buflen - 1);
+    close(fd);
+    if (len <= 0) {
+        return SDL_FALSE;
+    }
+    buf[len] = '\0';
+    return SDL_TRUE;
+}
+
+/* Returns the lowest CPU in a sysfs CPU list, or -1 if there isn't one */
+static int SDL_ReadSysfsCPUGroup(const char *path)
+{
+    char buf[1024];
+    int *cpus, count, i, lowest = -1;
+
+    if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+        return -1;
+    }
+    cpus = SDL_ParseCPUList(buf, &count);
+    if (!cpus) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        if (lowest < 0 || cpus[i] < lowest) {
+            lowest = cpus[i];
+        }
+    }
+    SDL_free(cpus);
+    return lowest;
+}
+
+static SDL_bool SDL_CPUListContains(const char *path, int cpu)
+{
+    char buf[1024];
+    int *cpus, count, i;
+    SDL_bool found = SDL_FALSE;
+
+    if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+        return SDL_FALSE;
+    }
+    cpus = SDL_ParseCPUList(buf, &count);
+    if (!cpus) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < count; ++i) {
+        if (cpus[i] == cpu) {
+            found = SDL_TRUE;
+            break;
+        }
+    }
+    SDL_free(cpus);
+    return found;
+}
+
+static SDL_CPUInfo *SDL_GetLinuxCPUTopology(int *count)
+{
+    char path[128];
+    char buf[1024];
+    SDL_CPUInfo *info;
+    int *cpus, *capacities;
+    int num_cpus, max_capacity = 0, i, j;
+    SDL_bool mixed_capacity = SDL_FALSE;
+    SDL_bool hybrid;
+
+    if (!SDL_ReadSysfsFile("/sys/devices/system/cpu/online", buf, sizeof(buf))) {
+        return NULL;
+    }
+    cpus = SDL_ParseCPUList(buf, &num_cpus);
+    if (!cpus || num_cpus == 0) {
+        SDL_free(cpus);
+        return NULL;
+    }
+
+    info = (SDL_CPUInfo *)SDL_calloc(num_cpus, sizeof(*info));
+    capacities = (int *)SDL_calloc(num_cpus, sizeof(*capacities));
+    if (!info || !capacities) {
+        SDL_free(cpus);
+        SDL_free(info);
+        SDL_free(capacities);
+        return NULL;
+    }
+
+    /* Intel hybrid CPUs list their P-cores and E-cores as separate PMU devices */
+    hybrid = (access("/sys/devices/cpu_core/cpus", F_OK) == 0 && access("/sys/devices/cpu_atom/cpus", F_OK) == 0);
+
+    for (i = 0; i < num_cpus; ++i) {
+        const int cpu = cpus[i];
+
+        info[i].cpu = cpu;
+        info[i].package = -1;
+        info[i].l2_group = -1;
+        info[i].l3_group = -1;
+        info[i].type = SDL_CPU_CORE_UNKNOWN;
+
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        if (SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+            info[i].package = SDL_atoi(buf);
+        }
+
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+        info[i].core = SDL_ReadSysfsCPUGroup(path);
+        if (info[i].core < 0) {
+            info[i].core = cpu;
+        }
+
+        for (j = 0;; ++j) {
+            int level;
+
+            (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpu, j);
+            if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+                break;
+            }
+            level = SDL_atoi(buf);
+            (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_list", cpu, j);
+            if (level == 2) {
+                info[i].l2_group = SDL_ReadSysfsCPUGroup(path);
+            } else if (level == 3) {
+                info[i].l3_group = SDL_ReadSysfsCPUGroup(path);
+            }
+        }
+
+        if (hybrid) {
+            if (SDL_CPUListContains("/sys/devices/cpu_core/cpus", cpu)) {
+                info[i].type = SDL_CPU_CORE_PERFORMANCE;
+            } else if (SDL_CPUListContains("/sys/devices/cpu_atom/cpus", cpu)) {
+                info[i].type = SDL_CPU_CORE_EFFICIENCY;
+            }
+        } else {
+            /* ARM big.LITTLE systems report each core's relative speed */
+            (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpu);
+            if (SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+                capacities[i] = SDL_atoi(buf);
+                if (max_capacity && capacities[i] != max_capacity) {
+                    mixed_capacity = SDL_TRUE;
+                }
+                max_capacity = SDL_max(max_capacity, capacities[i]);
+            }
+        }
+    }
+
+    if (mixed_capacity) {
+        for (i = 0; i < num_cpus; ++i) {
+            if (capacities[i] > 0) {
+                info[i].type = (capacities[i] == max_capacity) ? SDL_CPU_CORE_PERFORMANCE : SDL_CPU_CORE_EFFICIENCY;
+            }
+        }
+    }
+
+    SDL_free(cpus);
+    SDL_free(capacities);
+    *count = num_cpus;
+    return info;
+}
+#endif /* __LINUX__ */
+
+SDL_CPUInfo *SDL_GetCPUTopology(int *count)
+{
+    SDL_CPUInfo *info = NULL;
+    int num_cpus = 0;
+    int i;
+
+#ifdef __LINUX__
+    info = SDL_GetLinuxCPUTopology(&num_cpus);
+#endif
+    if (!info) {
+        /* We don't know any better, every CPU is on its own */
+        num_cpus = SDL_GetCPUCount();
+        info = (SDL_CPUInfo *)SDL_calloc(num_cpus, sizeof(*info));
+        if (!info) {
+            SDL_OutOfMemory();
+            if (count) {
+                *count = 0;
+            }
+            return NULL;
+        }
+        for (i = 0; i < num_cpus; ++i) {
+            info[i].cpu = i;
+            info[i].core = i;
+            info[i].package = -1;
+            info[i].l2_group = -1;
+            info[i].l3_group = -1;
+            info[i].type = SDL_CPU_CORE_UNKNOWN;
+        }
+    }
+
+    if (count) {
+        *count = num_cpus;
+    }
+    return info;
+}
+
 #ifdef __e2k__
 inline const char *
 SDL_GetCPUType(void)
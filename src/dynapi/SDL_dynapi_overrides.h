@@ -987,3 +987,44 @@
 #define SDL_GetTouchDeviceName SDL_GetTouchDeviceName_REAL
 #define SDL_strnstr SDL_strnstr_REAL
 #define SDL_wcsnstr SDL_wcsnstr_REAL
+#define SDL_GetAudioStreamGain SDL_GetAudioStreamGain_REAL
+#define SDL_SetAudioStreamGain SDL_SetAudioStreamGain_REAL
+#define SDL_SetAudioStreamGainRamp SDL_SetAudioStreamGainRamp_REAL
+#define SDL_GetAudioStreamResamplerQuality SDL_GetAudioStreamResamplerQuality_REAL
+#define SDL_SetAudioStreamResamplerQuality SDL_SetAudioStreamResamplerQuality_REAL
+#define SDL_CreateAudioStreamWithProperties SDL_CreateAudioStreamWithProperties_REAL
+#define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_LoadWAVStream_RW SDL_LoadWAVStream_RW_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_GetAudioDeviceProperties SDL_GetAudioDeviceProperties_REAL
+#define SDL_PollEventBatch SDL_PollEventBatch_REAL
+#define SDL_GetEventQueueProperties SDL_GetEventQueueProperties_REAL
+#define SDL_CreateJobPool SDL_CreateJobPool_REAL
+#define SDL_GetJobPoolThreadCount SDL_GetJobPoolThreadCount_REAL
+#define SDL_DestroyJobPool SDL_DestroyJobPool_REAL
+#define SDL_CreateJobGroup SDL_CreateJobGroup_REAL
+#define SDL_DestroyJobGroup SDL_DestroyJobGroup_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJobGroup SDL_WaitJobGroup_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_AtomicOr SDL_AtomicOr_REAL
+#define SDL_AtomicAnd SDL_AtomicAnd_REAL
+#define SDL_AtomicCASU64 SDL_AtomicCASU64_REAL
+#define SDL_AtomicSetU64 SDL_AtomicSetU64_REAL
+#define SDL_AtomicGetU64 SDL_AtomicGetU64_REAL
+#define SDL_AtomicAddU64 SDL_AtomicAddU64_REAL
+#define SDL_CreateAtomicStack SDL_CreateAtomicStack_REAL
+#define SDL_PushAtomicStack SDL_PushAtomicStack_REAL
+#define SDL_PopAtomicStack SDL_PopAtomicStack_REAL
+#define SDL_DestroyAtomicStack SDL_DestroyAtomicStack_REAL
+#define SDL_CreateAtomicQueue SDL_CreateAtomicQueue_REAL
+#define SDL_PushAtomicQueue SDL_PushAtomicQueue_REAL
+#define SDL_PopAtomicQueue SDL_PopAtomicQueue_REAL
+#define SDL_DestroyAtomicQueue SDL_DestroyAtomicQueue_REAL
+#define SDL_CreateMutexWithProperties SDL_CreateMutexWithProperties_REAL
+#define SDL_GetMutexProperties SDL_GetMutexProperties_REAL
+#define SDL_GetSemaphoreProperties SDL_GetSemaphoreProperties_REAL
+#define SDL_GetCPUTopology SDL_GetCPUTopology_REAL
+#define SDL_SetThreadAffinity SDL_SetThreadAffinity_REAL
+#define SDL_SaveTrace_RW SDL_SaveTrace_RW_REAL
+#define SDL_SaveTrace SDL_SaveTrace_REAL
@@ -1012,3 +1012,44 @@ SDL_DYNAPI_PROC(SDL_TouchID*,SDL_GetTouchDevices,(int *a),(a),return)
 SDL_DYNAPI_PROC(const char*,SDL_GetTouchDeviceName,(SDL_TouchID a),(a),return)
 SDL_DYNAPI_PROC(char*,SDL_strnstr,(const char *a, const char *b, size_t c),(a,b,c),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsnstr,(const wchar_t *a, const wchar_t *b, size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetAudioStreamGain,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamGain,(SDL_AudioStream *a, float b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamGainRamp,(SDL_AudioStream *a, float b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioResamplerQuality,SDL_GetAudioStreamResamplerQuality,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamResamplerQuality,(SDL_AudioStream *a, SDL_AudioResamplerQuality b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a, const void *b, int c, SDL_AudioStreamDataCompleteCallback d, void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_LoadWAVStream_RW,(SDL_RWops *a, SDL_bool b, SDL_AudioSpec *c, Sint64 *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_SeekWAVStream,(SDL_AudioStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetAudioDeviceProperties,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_PollEventBatch,(SDL_Event *a, int b, Uint32 c, SDL_bool d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetEventQueueProperties,(void),(),return)
+SDL_DYNAPI_PROC(SDL_JobPool*,SDL_CreateJobPool,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetJobPoolThreadCount,(SDL_JobPool *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobPool,(SDL_JobPool *a),(a),)
+SDL_DYNAPI_PROC(SDL_JobGroup*,SDL_CreateJobGroup,(SDL_JobPool *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_SubmitJob,(SDL_JobPool *a, SDL_JobGroup *b, SDL_JobFunction c, void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_ParallelFor,(SDL_JobPool *a, int b, int c, int d, SDL_ParallelForFunction e, void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_AtomicOr,(SDL_AtomicInt *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AtomicAnd,(SDL_AtomicInt *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_AtomicCASU64,(SDL_AtomicU64 *a, Uint64 b, Uint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(Uint64,SDL_AtomicSetU64,(SDL_AtomicU64 *a, Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Uint64,SDL_AtomicGetU64,(SDL_AtomicU64 *a),(a),return)
+SDL_DYNAPI_PROC(Uint64,SDL_AtomicAddU64,(SDL_AtomicU64 *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AtomicStack*,SDL_CreateAtomicStack,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_PushAtomicStack,(SDL_AtomicStack *a, void *b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_PopAtomicStack,(SDL_AtomicStack *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAtomicStack,(SDL_AtomicStack *a),(a),)
+SDL_DYNAPI_PROC(SDL_AtomicQueue*,SDL_CreateAtomicQueue,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_PushAtomicQueue,(SDL_AtomicQueue *a, void *b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_PopAtomicQueue,(SDL_AtomicQueue *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAtomicQueue,(SDL_AtomicQueue *a),(a),)
+SDL_DYNAPI_PROC(SDL_Mutex*,SDL_CreateMutexWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetMutexProperties,(SDL_Mutex *a),(a),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetSemaphoreProperties,(SDL_Semaphore *a),(a),return)
+SDL_DYNAPI_PROC(SDL_CPUInfo*,SDL_GetCPUTopology,(int *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetThreadAffinity,(const int *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SaveTrace_RW,(SDL_RWops *a, SDL_bool b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SaveTrace,(const char *a),(a),return)
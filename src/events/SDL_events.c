@@ -24,6 +24,7 @@
 
 #include "SDL_events_c.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "../audio/SDL_audio_c.h"
 #include "../timer/SDL_timer_c.h"
 #ifndef SDL_JOYSTICK_DISABLED
@@ -72,12 +73,14 @@ static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static Uint32 SDL_userevents = SDL_EVENT_USER;
 
 /* Private data -- event queue */
-typedef struct SDL_EventEntry
-{
-    SDL_Event event;
-    struct SDL_EventEntry *prev;
-    struct SDL_EventEntry *next;
-} SDL_EventEntry;
+
+/* The queue is a ring buffer that doubles in size as needed, so events stay contiguous in memory.
+   It also counts the queued events in each group of 256 event types (the same grouping that
+   SDL_disabled_events uses), so a query for types that aren't queued doesn't have to look at any events. */
+#define SDL_EVENT_QUEUE_MIN_CAPACITY 128
+
+/* Types past SDL_EVENT_LAST aren't valid, but they still get counted, all in one extra group */
+#define SDL_EVENT_TYPE_GROUP(type) (((type) > SDL_EVENT_LAST) ? 256 : ((type) >> 8))
 
 static struct
 {
@@ -85,46 +88,157 @@ static struct
     SDL_bool active;
     SDL_AtomicInt count;
     int max_events_seen;
-    SDL_EventEntry *head;
-    SDL_EventEntry *tail;
-    SDL_EventEntry *free;
-} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL };
+    SDL_Event *events;
+    int capacity; /* always zero or a power of two */
+    int head;     /* index of the oldest event */
+    int type_counts[257];
+    Uint64 *batch;  /* scratch space for SDL_PollEventBatch() */
+    int batch_size;
+    SDL_bool filtering; /* SDL_FilterEvents() is moving events around, so new events can't be merged into them */
+} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, 0, 0, { 0 }, NULL, 0, SDL_FALSE };
+
+#define SDL_EVENTQ_AT(i) (&SDL_EventQ.events[(SDL_EventQ.head + (i)) & (SDL_EventQ.capacity - 1)])
+
+/* Events pushed while another thread holds the queue lock wait here until the next thread to lock the queue moves
+   them over. This is a bounded multi-producer queue: each slot has a sequence number that says whether it is free
+   for the producer claiming that position, or holds an event for the consumer. Producers claim positions with a
+   compare-and-swap, so they never wait on each other or on the thread reading the queue. */
+#define SDL_PENDING_EVENTS_SIZE 1024
+
+typedef struct
+{
+    SDL_AtomicInt sequence;
+    SDL_Event event;
+} SDL_PendingEvent;
 
-typedef struct SDL_EventMemory
+static struct
+{
+    SDL_PendingEvent *slots;
+    SDL_AtomicInt enqueue_pos;
+    Uint32 dequeue_pos; /* only used with the queue locked */
+    SDL_AtomicInt count;
+    SDL_AtomicInt accepting; /* nonzero while threads may push without the queue lock */
+    SDL_AtomicInt pushers;   /* threads that got in while accepting was set, SDL_StopEventLoop() waits for them */
+} SDL_PendingEvents;
+
+static void SDL_PendingEvents_Drain(void);
+
+/* Statistics reported by SDL_GetEventQueueProperties() -- protected by the queue lock, except for watcher_ns,
+   which is protected by SDL_event_watchers_lock */
+#define SDL_EVENT_LATENCY_BUCKETS 6
+
+static const Uint64 SDL_event_latency_limits[SDL_EVENT_LATENCY_BUCKETS - 1] = {
+    SDL_US_TO_NS(250), SDL_MS_TO_NS(1), SDL_MS_TO_NS(4), SDL_MS_TO_NS(16), SDL_MS_TO_NS(64)
+};
+
+static const char *SDL_event_latency_props[SDL_EVENT_LATENCY_BUCKETS] = {
+    "SDL.events.latency_under_250us",
+    "SDL.events.latency_under_1ms",
+    "SDL.events.latency_under_4ms",
+    "SDL.events.latency_under_16ms",
+    "SDL.events.latency_under_64ms",
+    "SDL.events.latency_over_64ms"
+};
+
+static struct
+{
+    Uint64 pushed;
+    Uint64 coalesced;
+    Uint64 dropped;
+    Uint64 *pushed_by_type[256]; /* allocated as needed, one table for each group of 256 event types */
+    Uint64 latency[SDL_EVENT_LATENCY_BUCKETS];
+    Uint64 latency_max_ns;
+    Uint64 pumps;
+    Uint64 pump_ns;
+    Uint64 pump_max_ns;
+    Uint64 pump_video_ns;
+    Uint64 pump_audio_ns;
+    Uint64 pump_sensor_ns;
+    Uint64 pump_joystick_ns;
+    Uint64 watcher_ns;
+    SDL_PropertiesID props;
+} SDL_EventStats;
+
+/* Event memory is handed out from blocks of memory in the order it's allocated, and a block is freed once all the
+   events that might use memory in it are gone. Each block remembers the newest event ID when memory was last taken
+   from it, which is the same bookkeeping that used to be done for each allocation. */
+#define SDL_EVENT_MEMORY_BLOCK_SIZE 4096
+#define SDL_EVENT_MEMORY_ALIGNMENT  16
+
+typedef struct SDL_EventMemoryBlock
 {
     Uint32 eventID;
-    void *memory;
-    struct SDL_EventMemory *next;
-} SDL_EventMemory;
+    size_t size;
+    size_t used;
+    struct SDL_EventMemoryBlock *next;
+} SDL_EventMemoryBlock;
+
+#define SDL_EVENT_MEMORY_ALIGN(size) (((size) + (SDL_EVENT_MEMORY_ALIGNMENT - 1)) & ~(size_t)(SDL_EVENT_MEMORY_ALIGNMENT - 1))
+#define SDL_EVENT_MEMORY_HEADER_SIZE SDL_EVENT_MEMORY_ALIGN(sizeof(SDL_EventMemoryBlock))
+#define SDL_EVENT_MEMORY_DATA(block) ((Uint8 *)(block) + SDL_EVENT_MEMORY_HEADER_SIZE)
 
 static SDL_Mutex *SDL_event_memory_lock;
-static SDL_EventMemory *SDL_event_memory_head;
-static SDL_EventMemory *SDL_event_memory_tail;
+static SDL_EventMemoryBlock *SDL_event_memory_head;
+static SDL_EventMemoryBlock *SDL_event_memory_tail;
+static SDL_EventMemoryBlock *SDL_event_memory_spare; /* kept around so a steady trickle of events doesn't allocate */
+static size_t SDL_event_memory_used;     /* bytes handed out to events that are still around */
+static size_t SDL_event_memory_reserved; /* bytes in the blocks those came from */
+static size_t SDL_event_memory_max_used;
+static size_t SDL_event_memory_max_reserved;
 
 void *SDL_AllocateEventMemory(size_t size)
 {
-    void *memory = SDL_malloc(size);
-    if (!memory) {
+    void *memory = NULL;
+
+    /* Zero sized allocations still need their own address */
+    size = size ? SDL_EVENT_MEMORY_ALIGN(size) : SDL_EVENT_MEMORY_ALIGNMENT;
+    if (size < SDL_EVENT_MEMORY_ALIGNMENT) {
+        SDL_OutOfMemory(); /* it overflowed */
         return NULL;
     }
 
     SDL_LockMutex(SDL_event_memory_lock);
     {
-        SDL_EventMemory *entry = (SDL_EventMemory *)SDL_malloc(sizeof(*entry));
-        if (entry) {
-            entry->eventID = SDL_last_event_id;
-            entry->memory = memory;
-            entry->next = NULL;
-
-            if (SDL_event_memory_tail) {
-                SDL_event_memory_tail->next = entry;
+        SDL_EventMemoryBlock *block = SDL_event_memory_tail;
+
+        if (block == NULL || (block->size - block->used) < size) {
+            if (SDL_event_memory_spare && size <= SDL_event_memory_spare->size) {
+                block = SDL_event_memory_spare;
+                SDL_event_memory_spare = NULL;
             } else {
-                SDL_event_memory_head = entry;
+                const size_t block_size = SDL_max(size, SDL_EVENT_MEMORY_BLOCK_SIZE);
+                block = (SDL_EventMemoryBlock *)SDL_malloc(SDL_EVENT_MEMORY_HEADER_SIZE + block_size);
+                if (block) {
+                    block->size = block_size;
+                }
+            }
+
+            if (block) {
+                block->used = 0;
+                block->next = NULL;
+                if (SDL_event_memory_tail) {
+                    SDL_event_memory_tail->next = block;
+                } else {
+                    SDL_event_memory_head = block;
+                }
+                SDL_event_memory_tail = block;
+
+                SDL_event_memory_reserved += block->size;
+                if (SDL_event_memory_reserved > SDL_event_memory_max_reserved) {
+                    SDL_event_memory_max_reserved = SDL_event_memory_reserved;
+                }
+            }
+        }
+
+        if (block) {
+            memory = SDL_EVENT_MEMORY_DATA(block) + block->used;
+            block->used += size;
+            block->eventID = SDL_last_event_id;
+
+            SDL_event_memory_used += size;
+            if (SDL_event_memory_used > SDL_event_memory_max_used) {
+                SDL_event_memory_max_used = SDL_event_memory_used;
             }
-            SDL_event_memory_tail = entry;
-        } else {
-            SDL_free(memory);
-            memory = NULL;
         }
     }
     SDL_UnlockMutex(SDL_event_memory_lock);
@@ -136,25 +250,28 @@ static void SDL_FlushEventMemory(Uint32 eventID)
 {
     SDL_LockMutex(SDL_event_memory_lock);
     {
-        if (SDL_event_memory_head) {
-            while (SDL_event_memory_head) {
-                SDL_EventMemory *entry = SDL_event_memory_head;
+        while (SDL_event_memory_head) {
+            SDL_EventMemoryBlock *block = SDL_event_memory_head;
 
-                if (eventID && (Sint32)(eventID - entry->eventID) < 0) {
-                    break;
-                }
-
-                /* If you crash here, your application has memory corruption
-                 * or freed memory in an event, which is no longer necessary.
-                 */
-                SDL_event_memory_head = entry->next;
-                SDL_free(entry->memory);
-                SDL_free(entry);
+            if (eventID && (Sint32)(eventID - block->eventID) < 0) {
+                break;
             }
-            if (!SDL_event_memory_head) {
-                SDL_event_memory_tail = NULL;
+
+            /* If you crash here, your application has memory corruption
+             * or freed memory in an event, which is no longer necessary.
+             */
+            SDL_event_memory_head = block->next;
+            SDL_event_memory_used -= block->used;
+            SDL_event_memory_reserved -= block->size;
+            if (SDL_event_memory_spare == NULL && block->size == SDL_EVENT_MEMORY_BLOCK_SIZE) {
+                SDL_event_memory_spare = block;
+            } else {
+                SDL_free(block);
             }
         }
+        if (!SDL_event_memory_head) {
+            SDL_event_memory_tail = NULL;
+        }
     }
     SDL_UnlockMutex(SDL_event_memory_lock);
 }
@@ -181,6 +298,13 @@ static void SDLCALL SDL_AutoUpdateSensorsChanged(void *userdata, const char *nam
 
 #endif /* !SDL_SENSOR_DISABLED */
 
+static SDL_bool SDL_coalesce_motion = SDL_FALSE;
+
+static void SDLCALL SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_coalesce_motion = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
 static void SDLCALL SDL_PollSentinelChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
 {
     SDL_SetEventEnabled(SDL_EVENT_POLL_SENTINEL, SDL_GetStringBoolean(hint, SDL_TRUE));
@@ -576,41 +700,81 @@ static void SDL_LogEvent(const SDL_Event *event)
 #undef uint
 }
 
+static void SDL_PendingEvents_Reset(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_PENDING_EVENTS_SIZE; ++i) {
+        SDL_AtomicSet(&SDL_PendingEvents.slots[i].sequence, i);
+    }
+    SDL_AtomicSet(&SDL_PendingEvents.enqueue_pos, 0);
+    SDL_PendingEvents.dequeue_pos = 0;
+    SDL_AtomicSet(&SDL_PendingEvents.count, 0);
+}
+
+/* Stop threads from pushing without the queue lock, and wait for the ones already doing so */
+static void SDL_PendingEvents_Close(void)
+{
+    /* A compare-and-swap is a full barrier, so any pusher that got in before this is counted below */
+    if (SDL_AtomicCAS(&SDL_PendingEvents.accepting, 1, 0)) {
+        while (SDL_AtomicGet(&SDL_PendingEvents.pushers) > 0) {
+            SDL_CPUPauseInstruction();
+        }
+    }
+}
+
 void SDL_StopEventLoop(void)
 {
     const char *report = SDL_GetHint("SDL_EVENT_QUEUE_STATISTICS");
     int i;
-    SDL_EventEntry *entry;
+
+    SDL_PendingEvents_Close();
 
     SDL_LockMutex(SDL_EventQ.lock);
 
+    /* Everything that was pushed gets queued, so it's counted and logged and its event memory is released below */
+    if (SDL_PendingEvents.slots) {
+        SDL_PendingEvents_Drain();
+    }
+
     SDL_EventQ.active = SDL_FALSE;
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
                 SDL_EventQ.max_events_seen);
+        SDL_Log("SDL EVENT QUEUE: Maximum event memory in use: %u bytes, in %u bytes of blocks\n",
+                (unsigned int)SDL_event_memory_max_used, (unsigned int)SDL_event_memory_max_reserved);
     }
 
     /* Clean out EventQ */
-    for (entry = SDL_EventQ.head; entry;) {
-        SDL_EventEntry *next = entry->next;
-        SDL_free(entry);
-        entry = next;
-    }
-    for (entry = SDL_EventQ.free; entry;) {
-        SDL_EventEntry *next = entry->next;
-        SDL_free(entry);
-        entry = next;
-    }
+    SDL_free(SDL_EventQ.events);
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
-    SDL_EventQ.head = NULL;
-    SDL_EventQ.tail = NULL;
-    SDL_EventQ.free = NULL;
+    SDL_EventQ.events = NULL;
+    SDL_EventQ.capacity = 0;
+    SDL_EventQ.head = 0;
+    SDL_zeroa(SDL_EventQ.type_counts);
+    SDL_free(SDL_EventQ.batch);
+    SDL_EventQ.batch = NULL;
+    SDL_EventQ.batch_size = 0;
+
+    for (i = 0; i < SDL_arraysize(SDL_EventStats.pushed_by_type); ++i) {
+        SDL_free(SDL_EventStats.pushed_by_type[i]);
+    }
+    SDL_DestroyProperties(SDL_EventStats.props);
+    SDL_zero(SDL_EventStats);
     SDL_AtomicSet(&SDL_sentinel_pending, 0);
 
+    SDL_assert(SDL_AtomicGet(&SDL_PendingEvents.count) == 0);
+    SDL_free(SDL_PendingEvents.slots);
+    SDL_zero(SDL_PendingEvents);
+
     SDL_FlushEventMemory(0);
+    SDL_free(SDL_event_memory_spare);
+    SDL_event_memory_spare = NULL;
+    SDL_event_memory_max_used = 0;
+    SDL_event_memory_max_reserved = 0;
 
     /* Clear disabled event state */
     for (i = 0; i < SDL_arraysize(SDL_disabled_events); ++i) {
@@ -677,6 +841,15 @@ int SDL_StartEventLoop(void)
     }
 #endif /* !SDL_THREADS_DISABLED */
 
+    if (SDL_PendingEvents.slots == NULL) {
+        SDL_PendingEvents.slots = (SDL_PendingEvent *)SDL_malloc(SDL_PENDING_EVENTS_SIZE * sizeof(*SDL_PendingEvents.slots));
+        if (SDL_PendingEvents.slots == NULL) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            return -1;
+        }
+        SDL_PendingEvents_Reset();
+    }
+
     /* Process most event types */
     SDL_SetEventEnabled(SDL_EVENT_TEXT_INPUT, SDL_FALSE);
     SDL_SetEventEnabled(SDL_EVENT_TEXT_EDITING, SDL_FALSE);
@@ -686,53 +859,214 @@ int SDL_StartEventLoop(void)
 #endif
 
     SDL_EventQ.active = SDL_TRUE;
+    SDL_AtomicSet(&SDL_PendingEvents.accepting, 1);
     SDL_UnlockMutex(SDL_EventQ.lock);
     return 0;
 }
 
+/* Make room for at least one more event -- called with the queue locked */
+static int SDL_GrowEventQueue(void)
+{
+    const int count = SDL_AtomicGet(&SDL_EventQ.count);
+    const int old_capacity = SDL_EventQ.capacity;
+    const int new_capacity = old_capacity ? (old_capacity * 2) : SDL_EVENT_QUEUE_MIN_CAPACITY;
+    SDL_Event *events;
+
+    events = (SDL_Event *)SDL_realloc(SDL_EventQ.events, new_capacity * sizeof(*events));
+    if (events == NULL) {
+        return -1;
+    }
+
+    /* If the queue wrapped around the end of the old buffer, move the wrapped part after it */
+    if (SDL_EventQ.head + count > old_capacity) {
+        SDL_memcpy(&events[old_capacity], events, (SDL_EventQ.head + count - old_capacity) * sizeof(*events));
+    }
+
+    SDL_EventQ.events = events;
+    SDL_EventQ.capacity = new_capacity;
+    return 0;
+}
+
+/* Returns SDL_FALSE if no queued event has a type in this range -- called with the queue locked */
+static SDL_bool SDL_MightHaveEvents(Uint32 minType, Uint32 maxType)
+{
+    Uint32 hi;
+
+    if (SDL_AtomicGet(&SDL_EventQ.count) == 0 || minType > maxType) {
+        return SDL_FALSE;
+    }
+    if (maxType > SDL_EVENT_LAST && SDL_EventQ.type_counts[256] > 0) {
+        return SDL_TRUE;
+    }
+    for (hi = SDL_EVENT_TYPE_GROUP(minType); hi <= SDL_EVENT_TYPE_GROUP(SDL_min(maxType, SDL_EVENT_LAST)); ++hi) {
+        if (SDL_EventQ.type_counts[hi] > 0) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* Returns SDL_TRUE if every queued event has a type in this range -- called with the queue locked */
+static SDL_bool SDL_AllEventsInRange(Uint32 minType, Uint32 maxType)
+{
+    Uint32 hi;
+    int found = 0;
+
+    if (minType > SDL_EVENT_LAST || (minType & 0xff) != 0 || (maxType < SDL_EVENT_LAST && (maxType & 0xff) != 0xff)) {
+        return SDL_FALSE; /* only whole groups of types can be counted */
+    }
+    if (SDL_EventQ.type_counts[256] > 0) {
+        return SDL_FALSE; /* not worth the trouble */
+    }
+    for (hi = SDL_EVENT_TYPE_GROUP(minType); hi <= SDL_EVENT_TYPE_GROUP(SDL_min(maxType, SDL_EVENT_LAST)); ++hi) {
+        found += SDL_EventQ.type_counts[hi];
+    }
+    return found == SDL_AtomicGet(&SDL_EventQ.count);
+}
+
+/* Count an event going into the queue -- called with the queue locked */
+static void SDL_CountPushedEvent(Uint32 type)
+{
+    Uint64 *pushed_by_type;
+
+    ++SDL_EventStats.pushed;
+
+    if (type > SDL_EVENT_LAST) {
+        return;
+    }
+    pushed_by_type = SDL_EventStats.pushed_by_type[type >> 8];
+    if (pushed_by_type == NULL) {
+        pushed_by_type = (Uint64 *)SDL_calloc(256, sizeof(*pushed_by_type));
+        if (pushed_by_type == NULL) {
+            return;
+        }
+        SDL_EventStats.pushed_by_type[type >> 8] = pushed_by_type;
+    }
+    ++pushed_by_type[type & 0xff];
+}
+
+/* Count how long events waited in the queue before being returned -- called with the queue locked */
+static void SDL_CountEventLatency(const SDL_Event *events, int numevents)
+{
+    const Uint64 now = SDL_GetTicksNS();
+    int i, bucket;
+
+    for (i = 0; i < numevents; ++i) {
+        const Uint64 timestamp = events[i].common.timestamp;
+        Uint64 latency;
+
+        if (timestamp == 0 || timestamp > now || events[i].type == SDL_EVENT_POLL_SENTINEL) {
+            continue;
+        }
+        latency = now - timestamp;
+        for (bucket = 0; bucket < SDL_EVENT_LATENCY_BUCKETS - 1; ++bucket) {
+            if (latency < SDL_event_latency_limits[bucket]) {
+                break;
+            }
+        }
+        ++SDL_EventStats.latency[bucket];
+        if (latency > SDL_EventStats.latency_max_ns) {
+            SDL_EventStats.latency_max_ns = latency;
+        }
+    }
+}
+
+/* Merge a motion event into the newest queued event, if that's motion from the same device and window -- called with the queue locked */
+static SDL_bool SDL_CoalesceMotionEvent(const SDL_Event *event)
+{
+    const int count = SDL_AtomicGet(&SDL_EventQ.count);
+    SDL_Event *last;
+
+    if (count == 0 || SDL_EventQ.filtering) {
+        return SDL_FALSE;
+    }
+
+    last = SDL_EVENTQ_AT(count - 1);
+    if (last->type != event->type) {
+        return SDL_FALSE;
+    }
+
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        if (last->motion.windowID != event->motion.windowID ||
+            last->motion.which != event->motion.which ||
+            last->motion.state != event->motion.state) {
+            return SDL_FALSE;
+        }
+        last->motion.timestamp = event->motion.timestamp;
+        last->motion.x = event->motion.x;
+        last->motion.y = event->motion.y;
+        last->motion.xrel += event->motion.xrel;
+        last->motion.yrel += event->motion.yrel;
+        return SDL_TRUE;
+
+    case SDL_EVENT_FINGER_MOTION:
+        if (last->tfinger.windowID != event->tfinger.windowID ||
+            last->tfinger.touchId != event->tfinger.touchId ||
+            last->tfinger.fingerId != event->tfinger.fingerId) {
+            return SDL_FALSE;
+        }
+        last->tfinger.timestamp = event->tfinger.timestamp;
+        last->tfinger.x = event->tfinger.x;
+        last->tfinger.y = event->tfinger.y;
+        last->tfinger.dx += event->tfinger.dx;
+        last->tfinger.dy += event->tfinger.dy;
+        last->tfinger.pressure = event->tfinger.pressure;
+        return SDL_TRUE;
+
+    case SDL_EVENT_PEN_MOTION:
+        if (last->pmotion.windowID != event->pmotion.windowID ||
+            last->pmotion.which != event->pmotion.which ||
+            last->pmotion.pen_state != event->pmotion.pen_state) {
+            return SDL_FALSE;
+        }
+        /* Pen motion has no relative values, so the newest event replaces the older one */
+        SDL_copyp(last, event);
+        return SDL_TRUE;
+
+    default:
+        return SDL_FALSE;
+    }
+}
+
 /* Add an event to the event queue -- called with the queue locked */
 static int SDL_AddEvent(SDL_Event *event)
 {
-    SDL_EventEntry *entry;
     const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
     int final_count;
 
+    if (SDL_coalesce_motion && SDL_CoalesceMotionEvent(event)) {
+        /* Merged into the newest queued event, so this doesn't need any room */
+        if (SDL_EventLoggingVerbosity > 0) {
+            SDL_LogEvent(event);
+        }
+        SDL_CountPushedEvent(event->type);
+        ++SDL_EventStats.coalesced;
+        return 1;
+    }
+
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
+        ++SDL_EventStats.dropped;
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+    if (initial_count == SDL_EventQ.capacity && SDL_GrowEventQueue() < 0) {
+        ++SDL_EventStats.dropped;
+        return 0;
     }
 
+    SDL_CountPushedEvent(event->type);
+
     if (SDL_EventLoggingVerbosity > 0) {
         SDL_LogEvent(event);
     }
 
-    SDL_copyp(&entry->event, event);
+    SDL_copyp(SDL_EVENTQ_AT(initial_count), event);
     if (event->type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AtomicAdd(&SDL_sentinel_pending, 1);
     }
-
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
-    }
+    ++SDL_EventQ.type_counts[SDL_EVENT_TYPE_GROUP(event->type)];
 
     final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
     if (final_count > SDL_EventQ.max_events_seen) {
@@ -744,33 +1078,125 @@ static int SDL_AddEvent(SDL_Event *event)
     return 1;
 }
 
-/* Remove an event from the queue -- called with the queue locked */
-static void SDL_CutEvent(SDL_EventEntry *entry)
+/* Account for an event leaving the queue -- called with the queue locked */
+static void SDL_ForgetEvent(const SDL_Event *event)
 {
-    if (entry->prev) {
-        entry->prev->next = entry->next;
+    if (event->type == SDL_EVENT_POLL_SENTINEL) {
+        SDL_AtomicAdd(&SDL_sentinel_pending, -1);
     }
-    if (entry->next) {
-        entry->next->prev = entry->prev;
+    SDL_assert(SDL_EventQ.type_counts[SDL_EVENT_TYPE_GROUP(event->type)] > 0);
+    --SDL_EventQ.type_counts[SDL_EVENT_TYPE_GROUP(event->type)];
+}
+
+/* Remove the oldest `numevents` events from the queue -- called with the queue locked */
+static void SDL_CutOldestEvents(int numevents)
+{
+    int i;
+
+    for (i = 0; i < numevents; ++i) {
+        SDL_ForgetEvent(SDL_EVENTQ_AT(i));
     }
+    SDL_EventQ.head = (SDL_EventQ.head + numevents) & (SDL_EventQ.capacity - 1);
+    SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) >= numevents);
+    SDL_AtomicAdd(&SDL_EventQ.count, -numevents);
+}
+
+/* Remove every event with a type in the range from the oldest `numevents` events -- called with the queue locked.
+   The events that stay are shifted towards the newer end, so removing from the front of the queue doesn't move anything. */
+static void SDL_CutEvents(int numevents, Uint32 minType, Uint32 maxType)
+{
+    int i, first_kept = numevents;
+
+    for (i = numevents - 1; i >= 0; --i) {
+        SDL_Event *event = SDL_EVENTQ_AT(i);
+        if (minType <= event->type && event->type <= maxType) {
+            SDL_ForgetEvent(event);
+        } else if (--first_kept != i) {
+            SDL_copyp(SDL_EVENTQ_AT(first_kept), event);
+        }
+    }
+
+    /* Everything before first_kept was removed */
+    SDL_EventQ.head = (SDL_EventQ.head + first_kept) & (SDL_EventQ.capacity - 1);
+    SDL_AtomicAdd(&SDL_EventQ.count, -first_kept);
+}
+
+/* Add an event to the pending events without taking any locks, returns SDL_FALSE if there's no room */
+static SDL_bool SDL_PendingEvents_Push(const SDL_Event *event)
+{
+    SDL_PendingEvent *slot;
+    Uint32 pos = (Uint32)SDL_AtomicGet(&SDL_PendingEvents.enqueue_pos);
 
-    if (entry == SDL_EventQ.head) {
-        SDL_assert(entry->prev == NULL);
-        SDL_EventQ.head = entry->next;
+    for (;;) {
+        Sint32 diff;
+
+        slot = &SDL_PendingEvents.slots[pos & (SDL_PENDING_EVENTS_SIZE - 1)];
+        diff = (Sint32)((Uint32)SDL_AtomicGet(&slot->sequence) - pos);
+        SDL_MemoryBarrierAcquire();
+        if (diff == 0) {
+            /* The slot is free, try to claim it */
+            if (SDL_AtomicCAS(&SDL_PendingEvents.enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+            pos = (Uint32)SDL_AtomicGet(&SDL_PendingEvents.enqueue_pos);
+        } else if (diff < 0) {
+            /* The slot still holds an event from the last time around */
+            return SDL_FALSE;
+        } else {
+            /* Another thread claimed the slot first */
+            pos = (Uint32)SDL_AtomicGet(&SDL_PendingEvents.enqueue_pos);
+        }
     }
-    if (entry == SDL_EventQ.tail) {
-        SDL_assert(entry->next == NULL);
-        SDL_EventQ.tail = entry->prev;
+
+    SDL_copyp(&slot->event, event);
+    /* SDL_AtomicSet() doesn't order the event before it, so make sure the event is written first */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&slot->sequence, (int)(pos + 1));
+    SDL_AtomicIncRef(&SDL_PendingEvents.count);
+    return SDL_TRUE;
+}
+
+/* Move pending events into the event queue, in the order they were pushed -- called with the queue locked */
+static void SDL_PendingEvents_Drain(void)
+{
+    while (SDL_AtomicGet(&SDL_PendingEvents.count) > 0) {
+        const Uint32 pos = SDL_PendingEvents.dequeue_pos;
+        SDL_PendingEvent *slot = &SDL_PendingEvents.slots[pos & (SDL_PENDING_EVENTS_SIZE - 1)];
+
+        if ((Uint32)SDL_AtomicGet(&slot->sequence) != pos + 1) {
+            break; /* the producer hasn't finished writing this one yet */
+        }
+        SDL_MemoryBarrierAcquire();
+
+        /* If the queue is full this drops the event, just as SDL_PushEvent() would have */
+        SDL_AddEvent(&slot->event);
+
+        /* Finish reading the event before handing the slot back to the producers */
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&slot->sequence, (int)(pos + SDL_PENDING_EVENTS_SIZE));
+        SDL_PendingEvents.dequeue_pos = pos + 1;
+        SDL_AtomicDecRef(&SDL_PendingEvents.count);
     }
+}
 
-    if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
-        SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+/* Remove the events at the given offsets, which must be in increasing order -- called with the queue locked */
+static void SDL_CutEventsAt(const Uint64 *offsets, int numoffsets)
+{
+    const int numevents = (int)offsets[numoffsets - 1] + 1;
+    int i, k = numoffsets - 1, first_kept = numevents;
+
+    for (i = numevents - 1; i >= 0; --i) {
+        SDL_Event *event = SDL_EVENTQ_AT(i);
+        if (k >= 0 && (int)offsets[k] == i) {
+            SDL_ForgetEvent(event);
+            --k;
+        } else if (--first_kept != i) {
+            SDL_copyp(SDL_EVENTQ_AT(first_kept), event);
+        }
     }
 
-    entry->next = SDL_EventQ.free;
-    SDL_EventQ.free = entry;
-    SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
-    SDL_AtomicAdd(&SDL_EventQ.count, -1);
+    SDL_EventQ.head = (SDL_EventQ.head + first_kept) & (SDL_EventQ.capacity - 1);
+    SDL_AtomicAdd(&SDL_EventQ.count, -first_kept);
 }
 
 static int SDL_SendWakeupEvent(void)
@@ -814,23 +1240,49 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
+
+        /* Anything pushed while the queue was busy goes first */
+        SDL_PendingEvents_Drain();
+
         if (action == SDL_ADDEVENT) {
             for (i = 0; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
+        } else if (!SDL_MightHaveEvents(minType, maxType)) {
+            /* Nothing to find */
+        } else if (events && numevents > 0 && SDL_AtomicGet(&SDL_sentinel_pending) == 0 && SDL_AllEventsInRange(minType, maxType)) {
+            /* Every event matches, so copy them out in bulk */
+            const int count = SDL_AtomicGet(&SDL_EventQ.count);
+            const int first = SDL_min(numevents, SDL_EventQ.capacity - SDL_EventQ.head);
+
+            used = SDL_min(numevents, count);
+            if (used <= first) {
+                SDL_memcpy(events, SDL_EVENTQ_AT(0), used * sizeof(*events));
+            } else {
+                SDL_memcpy(events, SDL_EVENTQ_AT(0), first * sizeof(*events));
+                SDL_memcpy(&events[first], SDL_EventQ.events, (used - first) * sizeof(*events));
+            }
+            if (action == SDL_GETEVENT) {
+                SDL_CutOldestEvents(used);
+            }
         } else {
-            SDL_EventEntry *entry, *next;
+            const int count = SDL_AtomicGet(&SDL_EventQ.count);
+            int cut = 0, sentinels_cut = 0;
             Uint32 type;
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
+            for (i = 0; i < count && (events == NULL || used < numevents); ++i) {
+                const SDL_Event *event = SDL_EVENTQ_AT(i);
+                type = event->type;
                 if (minType <= type && type <= maxType) {
                     if (events) {
-                        SDL_copyp(&events[used], &entry->event);
+                        SDL_copyp(&events[used], event);
 
                         if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
+                            /* Every matching event up to here gets removed */
+                            cut = i + 1;
+                            if (type == SDL_EVENT_POLL_SENTINEL) {
+                                ++sentinels_cut;
+                            }
                         }
                     }
                     if (type == SDL_EVENT_POLL_SENTINEL) {
@@ -842,7 +1294,7 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
                         if (events == NULL || action != SDL_GETEVENT) {
                             ++sentinels_expected;
                         }
-                        if (SDL_AtomicGet(&SDL_sentinel_pending) > sentinels_expected) {
+                        if (SDL_AtomicGet(&SDL_sentinel_pending) - sentinels_cut > sentinels_expected) {
                             /* Skip it, there's another one pending */
                             continue;
                         }
@@ -850,6 +1302,14 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
                     ++used;
                 }
             }
+
+            if (cut > 0) {
+                SDL_CutEvents(cut, minType, maxType);
+            }
+        }
+
+        if (action == SDL_GETEVENT && events && used > 0) {
+            SDL_CountEventLatency(events, used);
         }
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -883,9 +1343,6 @@ void SDL_FlushEvent(Uint32 type)
 
 void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 {
-    SDL_EventEntry *entry, *next;
-    Uint32 type;
-
     /* Make sure the events are current */
 #if 0
     /* Actually, we can't do this since we might be flushing while processing
@@ -902,12 +1359,9 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
-            type = entry->event.type;
-            if (minType <= type && type <= maxType) {
-                SDL_CutEvent(entry);
-            }
+        SDL_PendingEvents_Drain();
+        if (SDL_MightHaveEvents(minType, maxType)) {
+            SDL_CutEvents(SDL_AtomicGet(&SDL_EventQ.count), minType, maxType);
         }
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -917,10 +1371,16 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    Uint64 start, video_ns = 0, audio_ns = 0, sensor_ns = 0, joystick_ns = 0, pump_ns;
+    Uint64 last;
+
+    start = last = SDL_GetTicksNS();
+
+    SDL_BeginTraceZone("SDL_PumpEvents");
 
     /* Free old event memory */
     /*SDL_FlushEventMemory(SDL_last_event_id - SDL_MAX_QUEUED_EVENTS);*/
-    if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+    if (SDL_AtomicGet(&SDL_EventQ.count) == 0 && SDL_AtomicGet(&SDL_PendingEvents.count) == 0) {
         SDL_FlushEventMemory(SDL_last_event_id);
     }
 
@@ -930,16 +1390,22 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
     /* Get events from the video subsystem */
     if (_this) {
         _this->PumpEvents(_this);
+        video_ns = SDL_GetTicksNS() - last;
+        last += video_ns;
     }
 
 #ifndef SDL_AUDIO_DISABLED
     SDL_UpdateAudio();
+    audio_ns = SDL_GetTicksNS() - last;
+    last += audio_ns;
 #endif
 
 #ifndef SDL_SENSOR_DISABLED
     /* Check for sensor state change */
     if (SDL_update_sensors) {
         SDL_UpdateSensors();
+        sensor_ns = SDL_GetTicksNS() - last;
+        last += sensor_ns;
     }
 #endif
 
@@ -947,11 +1413,28 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
     /* Check for joystick state change */
     if (SDL_update_joysticks) {
         SDL_UpdateJoysticks();
+        joystick_ns = SDL_GetTicksNS() - last;
+        last += joystick_ns;
     }
 #endif
 
     SDL_SendPendingSignalEvents(); /* in case we had a signal handler fire, etc. */
 
+    SDL_EndTraceZone();
+
+    pump_ns = SDL_GetTicksNS() - start;
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        ++SDL_EventStats.pumps;
+        SDL_EventStats.pump_ns += pump_ns;
+        SDL_EventStats.pump_max_ns = SDL_max(SDL_EventStats.pump_max_ns, pump_ns);
+        SDL_EventStats.pump_video_ns += video_ns;
+        SDL_EventStats.pump_audio_ns += audio_ns;
+        SDL_EventStats.pump_sensor_ns += sensor_ns;
+        SDL_EventStats.pump_joystick_ns += joystick_ns;
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
     if (push_sentinel && SDL_EventEnabled(SDL_EVENT_POLL_SENTINEL)) {
         SDL_Event sentinel;
 
@@ -978,6 +1461,120 @@ SDL_bool SDL_PollEvent(SDL_Event *event)
     return SDL_WaitEventTimeoutNS(event, 0);
 }
 
+static Uint32 SDL_GetEventCategory(Uint32 type)
+{
+    switch (type) {
+    case SDL_EVENT_JOYSTICK_ADDED:
+    case SDL_EVENT_JOYSTICK_REMOVED:
+    case SDL_EVENT_JOYSTICK_BATTERY_UPDATED:
+    case SDL_EVENT_GAMEPAD_ADDED:
+    case SDL_EVENT_GAMEPAD_REMOVED:
+    case SDL_EVENT_GAMEPAD_REMAPPED:
+        return SDL_EVENTCATEGORY_DEVICE;
+    default:
+        break;
+    }
+
+    if (type >= SDL_EVENT_USER) {
+        return SDL_EVENTCATEGORY_USER;
+    } else if (type >= SDL_EVENT_POLL_SENTINEL) {
+        return 0;
+    } else if ((type >= SDL_EVENT_PEN_DOWN && type < SDL_EVENT_RENDER_TARGETS_RESET) || (type >= SDL_EVENT_KEY_DOWN && type < SDL_EVENT_CLIPBOARD_UPDATE) || type == SDL_EVENT_SENSOR_UPDATE) {
+        return SDL_EVENTCATEGORY_INPUT;
+    } else if (type >= SDL_EVENT_AUDIO_DEVICE_ADDED && type < SDL_EVENT_SENSOR_UPDATE) {
+        return SDL_EVENTCATEGORY_DEVICE;
+    } else if (type >= SDL_EVENT_DISPLAY_FIRST && type <= SDL_EVENT_WINDOW_LAST) {
+        return SDL_EVENTCATEGORY_WINDOW;
+    }
+    return SDL_EVENTCATEGORY_APPLICATION;
+}
+
+static int SDLCALL SDL_CompareBatchEntries(const void *a, const void *b)
+{
+    const Uint64 A = *(const Uint64 *)a;
+    const Uint64 B = *(const Uint64 *)b;
+    return (A < B) ? -1 : (A > B) ? 1 : 0;
+}
+
+int SDL_PollEventBatch(SDL_Event *events, int numevents, Uint32 categories, SDL_bool group_by_type)
+{
+    int i, count, taken = 0, used = 0, sentinels = 0;
+
+    if (events == NULL) {
+        return SDL_InvalidParamError("events");
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    /* If there isn't a poll sentinel event pending, pump events and add one */
+    if (SDL_AtomicGet(&SDL_sentinel_pending) == 0) {
+        SDL_PumpEventsInternal(SDL_TRUE);
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (!SDL_EventQ.active) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            return SDL_SetError("The event system has been shut down");
+        }
+
+        SDL_PendingEvents_Drain();
+
+        /* The batch holds the type and queue offset of each event taken, plus room for the poll sentinels */
+        count = SDL_AtomicGet(&SDL_EventQ.count);
+        if (SDL_EventQ.batch_size < SDL_min(numevents, count) + SDL_AtomicGet(&SDL_sentinel_pending)) {
+            const int batch_size = SDL_min(numevents, count) + SDL_AtomicGet(&SDL_sentinel_pending);
+            Uint64 *batch = (Uint64 *)SDL_realloc(SDL_EventQ.batch, batch_size * sizeof(*batch));
+            if (batch == NULL) {
+                SDL_UnlockMutex(SDL_EventQ.lock);
+                return -1;
+            }
+            SDL_EventQ.batch = batch;
+            SDL_EventQ.batch_size = batch_size;
+        }
+
+        for (i = 0; i < count && used < numevents; ++i) {
+            const Uint32 type = SDL_EVENTQ_AT(i)->type;
+            if (type == SDL_EVENT_POLL_SENTINEL) {
+                /* Sentinels are always removed, and the last one ends the poll cycle */
+                SDL_EventQ.batch[taken++] = ((Uint64)type << 32) | (Uint32)i;
+                if (++sentinels == SDL_AtomicGet(&SDL_sentinel_pending)) {
+                    break;
+                }
+            } else if (SDL_GetEventCategory(type) & categories) {
+                SDL_EventQ.batch[taken++] = ((Uint64)type << 32) | (Uint32)i;
+                ++used;
+            }
+        }
+
+        if (taken > 0) {
+            if (group_by_type) {
+                /* The offset in the low bits keeps events of the same type in queue order */
+                SDL_qsort(SDL_EventQ.batch, taken, sizeof(*SDL_EventQ.batch), SDL_CompareBatchEntries);
+            }
+
+            used = 0;
+            for (i = 0; i < taken; ++i) {
+                const SDL_Event *event = SDL_EVENTQ_AT((int)(Uint32)SDL_EventQ.batch[i]);
+                if (event->type != SDL_EVENT_POLL_SENTINEL) {
+                    SDL_copyp(&events[used++], event);
+                }
+                SDL_EventQ.batch[i] &= 0xFFFFFFFF;
+            }
+
+            if (group_by_type) {
+                SDL_qsort(SDL_EventQ.batch, taken, sizeof(*SDL_EventQ.batch), SDL_CompareBatchEntries);
+            }
+            SDL_CutEventsAt(SDL_EventQ.batch, taken);
+            SDL_CountEventLatency(events, used);
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return used;
+}
+
 static SDL_bool SDL_events_need_periodic_poll(void)
 {
     SDL_bool need_periodic_poll = SDL_FALSE;
@@ -1203,7 +1800,10 @@ int SDL_PushEvent(SDL_Event *event)
     if (SDL_EventOK.callback || SDL_event_watchers_count > 0) {
         SDL_LockMutex(SDL_event_watchers_lock);
         {
+            const Uint64 start = SDL_GetTicksNS();
+
             if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
+                SDL_EventStats.watcher_ns += SDL_GetTicksNS() - start;
                 SDL_UnlockMutex(SDL_event_watchers_lock);
                 return 0;
             }
@@ -1232,10 +1832,39 @@ int SDL_PushEvent(SDL_Event *event)
                     SDL_event_watchers_removed = SDL_FALSE;
                 }
             }
+
+            SDL_EventStats.watcher_ns += SDL_GetTicksNS() - start;
         }
         SDL_UnlockMutex(SDL_event_watchers_lock);
     }
 
+    /* If another thread is using the queue, leave the event for that thread to add rather than waiting for it.
+       When the queue is close to full, take the lock so it gets checked properly. Registering as a pusher first
+       keeps SDL_StopEventLoop() from freeing the pending events while we're using them. */
+    if (SDL_AtomicGet(&SDL_PendingEvents.accepting) &&
+        SDL_AtomicGet(&SDL_EventQ.count) < (SDL_MAX_QUEUED_EVENTS - SDL_PENDING_EVENTS_SIZE)) {
+        int added = 0;
+
+        SDL_AtomicIncRef(&SDL_PendingEvents.pushers);
+        if (SDL_AtomicGet(&SDL_PendingEvents.accepting)) {
+            if (SDL_TryLockMutex(SDL_EventQ.lock) == 0) {
+                added = (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) > 0) ? 1 : -1;
+                SDL_UnlockMutex(SDL_EventQ.lock);
+            } else if (SDL_PendingEvents_Push(event)) {
+                added = 2;
+            }
+        }
+        SDL_AtomicDecRef(&SDL_PendingEvents.pushers);
+
+        if (added == 2) {
+            SDL_SendWakeupEvent();
+            return 1;
+        } else if (added != 0) {
+            return added;
+        }
+        /* There's no room for it, or the event loop is stopping, so wait for the queue after all */
+    }
+
     if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
         return -1;
     }
@@ -1328,14 +1957,34 @@ void SDL_DelEventWatch(SDL_EventFilter filter, void *userdata)
 void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     SDL_LockMutex(SDL_EventQ.lock);
-    {
-        SDL_EventEntry *entry, *next;
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
-            if (!filter(userdata, &entry->event)) {
-                SDL_CutEvent(entry);
+    if (!SDL_EventQ.filtering) { /* the filter calling this again would move events out from under us */
+        /* Filter in queue order, moving the events that stay towards the front.
+           The filter may push events, which go after the ones being filtered and may grow the queue,
+           so each event is filtered from a copy and the queue is only ever indexed, never pointed into. */
+        int count, added, i, kept = 0;
+
+        SDL_PendingEvents_Drain();
+        count = SDL_AtomicGet(&SDL_EventQ.count);
+        SDL_EventQ.filtering = SDL_TRUE;
+        for (i = 0; i < count; ++i) {
+            SDL_Event event;
+
+            SDL_copyp(&event, SDL_EVENTQ_AT(i));
+            if (!filter(userdata, &event)) {
+                SDL_ForgetEvent(&event);
+            } else {
+                SDL_copyp(SDL_EVENTQ_AT(kept), &event);
+                ++kept;
             }
         }
+        SDL_EventQ.filtering = SDL_FALSE;
+
+        /* Keep anything pushed while filtering, after the events that stayed */
+        added = SDL_AtomicGet(&SDL_EventQ.count) - count;
+        for (i = 0; i < added; ++i) {
+            SDL_copyp(SDL_EVENTQ_AT(kept + i), SDL_EVENTQ_AT(count + i));
+        }
+        SDL_AtomicSet(&SDL_EventQ.count, kept + added);
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
 }
@@ -1461,6 +2110,73 @@ int SDL_SendSystemThemeChangedEvent(void)
     return SDL_SendAppEvent(SDL_EVENT_SYSTEM_THEME_CHANGED);
 }
 
+SDL_PropertiesID SDL_GetEventQueueProperties(void)
+{
+    SDL_PropertiesID props;
+    Uint64 watcher_ns;
+    char name[64];
+    int i, j;
+
+    SDL_LockMutex(SDL_event_watchers_lock);
+    {
+        watcher_ns = SDL_EventStats.watcher_ns;
+    }
+    SDL_UnlockMutex(SDL_event_watchers_lock);
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (!SDL_EventQ.active) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            SDL_SetError("The event system has been shut down");
+            return 0;
+        }
+
+        if (SDL_EventStats.props == 0) {
+            SDL_EventStats.props = SDL_CreateProperties();
+        }
+        props = SDL_EventStats.props;
+
+        /* Refresh the counters; they aren't kept in the properties directly, as setting them allocates */
+        if (props) {
+            SDL_PendingEvents_Drain();
+
+            SDL_SetNumberProperty(props, "SDL.events.queued", SDL_AtomicGet(&SDL_EventQ.count));
+            SDL_SetNumberProperty(props, "SDL.events.max_queued", SDL_EventQ.max_events_seen);
+            SDL_SetNumberProperty(props, "SDL.events.pushed", (Sint64)SDL_EventStats.pushed);
+            SDL_SetNumberProperty(props, "SDL.events.coalesced", (Sint64)SDL_EventStats.coalesced);
+            SDL_SetNumberProperty(props, "SDL.events.dropped", (Sint64)SDL_EventStats.dropped);
+            for (i = 0; i < SDL_EVENT_LATENCY_BUCKETS; ++i) {
+                SDL_SetNumberProperty(props, SDL_event_latency_props[i], (Sint64)SDL_EventStats.latency[i]);
+            }
+            SDL_SetNumberProperty(props, "SDL.events.latency_max_ns", (Sint64)SDL_EventStats.latency_max_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pumps", (Sint64)SDL_EventStats.pumps);
+            SDL_SetNumberProperty(props, "SDL.events.pump_ns", (Sint64)SDL_EventStats.pump_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pump_max_ns", (Sint64)SDL_EventStats.pump_max_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pump_video_ns", (Sint64)SDL_EventStats.pump_video_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pump_audio_ns", (Sint64)SDL_EventStats.pump_audio_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pump_sensor_ns", (Sint64)SDL_EventStats.pump_sensor_ns);
+            SDL_SetNumberProperty(props, "SDL.events.pump_joystick_ns", (Sint64)SDL_EventStats.pump_joystick_ns);
+            SDL_SetNumberProperty(props, "SDL.events.watcher_ns", (Sint64)watcher_ns);
+
+            for (i = 0; i < SDL_arraysize(SDL_EventStats.pushed_by_type); ++i) {
+                const Uint64 *pushed_by_type = SDL_EventStats.pushed_by_type[i];
+                if (pushed_by_type == NULL) {
+                    continue;
+                }
+                for (j = 0; j < 256; ++j) {
+                    if (pushed_by_type[j]) {
+                        (void)SDL_snprintf(name, sizeof(name), "SDL.events.pushed.%d", (i << 8) | j);
+                        SDL_SetNumberProperty(props, name, (Sint64)pushed_by_type[j]);
+                    }
+                }
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return props;
+}
+
 int SDL_InitEvents(void)
 {
 #ifndef SDL_JOYSTICK_DISABLED
@@ -1471,6 +2187,7 @@ int SDL_InitEvents(void)
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return -1;
@@ -1485,6 +2202,7 @@ void SDL_QuitEvents(void)
 {
     SDL_QuitQuit();
     SDL_StopEventLoop();
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #ifndef SDL_JOYSTICK_DISABLED
@@ -26,6 +26,7 @@
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_video_c.h"
+#include "../SDL_trace_c.h"
 
 #ifdef __ANDROID__
 #include "../core/android/SDL_android.h"
@@ -238,7 +239,9 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_BeginTraceZone("RunCommandQueue");
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_EndTraceZone();
 
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail) {
@@ -4004,6 +4007,8 @@ int SDL_RenderPresent(SDL_Renderer *renderer)
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    SDL_BeginTraceZone("SDL_RenderPresent");
+
     if (renderer->logical_target) {
         SDL_SetRenderTargetInternal(renderer, NULL);
         SDL_RenderLogicalPresentation(renderer);
@@ -4029,6 +4034,8 @@ int SDL_RenderPresent(SDL_Renderer *renderer)
         (!presented && renderer->wanted_vsync)) {
         SDL_SimulateRenderVSync(renderer);
     }
+
+    SDL_EndTraceZone();
     return 0;
 }
 
@@ -0,0 +1,625 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* A pool of worker threads running jobs from work-stealing deques */
+
+#include "SDL_systhread.h"
+
+/* The number of jobs each worker can queue for itself, must be a power of two.
+   Jobs that don't fit go to the pool's shared queue instead. */
+#define SDL_JOB_DEQUE_SIZE 1024
+#define SDL_JOB_DEQUE_MASK (SDL_JOB_DEQUE_SIZE - 1)
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction function;
+    void *userdata;
+    SDL_JobGroup *group;
+    struct SDL_Job *next;
+} SDL_Job;
+
+/* A Chase-Lev deque: the owning worker pushes and pops jobs at the bottom,
+   other threads steal them from the top. The indices only ever increase and
+   are compared with wrapping arithmetic. */
+typedef struct SDL_JobDeque
+{
+    SDL_AtomicInt top;
+    char pad1[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+    SDL_AtomicInt bottom;
+    char pad2[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+    void *slots[SDL_JOB_DEQUE_SIZE];
+} SDL_JobDeque;
+
+typedef struct SDL_JobWorker
+{
+    SDL_JobDeque deque;
+    SDL_JobPool *pool;
+    SDL_Thread *thread;
+    Uint32 seed;
+} SDL_JobWorker;
+
+struct SDL_JobGroup
+{
+    SDL_JobPool *pool;
+    SDL_AtomicInt pending;
+};
+
+struct SDL_JobPool
+{
+    SDL_JobWorker *workers;
+    int num_workers;
+
+    /* Jobs submitted from outside the pool, or that didn't fit in a deque */
+    SDL_Mutex *shared_lock;
+    SDL_Job *shared_head;
+    SDL_Job *shared_tail;
+    SDL_AtomicInt shared_count;
+
+    SDL_SpinLock free_lock;
+    SDL_Job *free_jobs;
+
+    SDL_Semaphore *wakeup;
+    SDL_AtomicInt sleepers;
+    SDL_AtomicInt quit;
+
+    /* Signaled whenever a group runs out of pending jobs */
+    SDL_Mutex *done_lock;
+    SDL_Condition *done_cond;
+
+    /* Every job submitted to the pool, so it can be drained before destroying it */
+    SDL_JobGroup all;
+};
+
+static SDL_SpinLock SDL_job_worker_tls_lock;
+static SDL_TLSID SDL_job_worker_tls;
+
+static SDL_JobWorker *SDL_GetCurrentJobWorker(SDL_JobPool *pool)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)SDL_GetTLS(SDL_job_worker_tls);
+    if (worker && worker->pool == pool) {
+        return worker;
+    }
+    return NULL;
+}
+
+static SDL_bool SDL_PushJob(SDL_JobDeque *deque, SDL_Job *job)
+{
+    Uint32 bottom = (Uint32)SDL_AtomicGet(&deque->bottom);
+    Uint32 top = (Uint32)SDL_AtomicGet(&deque->top);
+
+    if ((bottom - top) >= SDL_JOB_DEQUE_SIZE) {
+        return SDL_FALSE;
+    }
+    SDL_AtomicSetPtr(&deque->slots[bottom & SDL_JOB_DEQUE_MASK], job);
+    /* SDL_AtomicSet() doesn't order the slot before it, and thieves must see the job before the new bottom */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&deque->bottom, (int)(bottom + 1));
+    return SDL_TRUE;
+}
+
+static SDL_Job *SDL_PopJob(SDL_JobDeque *deque)
+{
+    Uint32 bottom;
+    Uint32 top;
+    SDL_Job *job;
+
+    /* Claim the bottom slot before looking at the top, so a thief can't
+       take the same job without one of us noticing. This needs a full
+       barrier between the store and the load, which SDL_AtomicSet() isn't,
+       so use an atomic add. */
+    bottom = (Uint32)SDL_AtomicAdd(&deque->bottom, -1) - 1;
+    top = (Uint32)SDL_AtomicGet(&deque->top);
+    if ((int)(bottom - top) < 0) {
+        SDL_AtomicSet(&deque->bottom, (int)top);
+        return NULL;
+    }
+
+    job = (SDL_Job *)SDL_AtomicGetPtr(&deque->slots[bottom & SDL_JOB_DEQUE_MASK]);
+    if (bottom != top) {
+        return job;
+    }
+
+    /* This is the last job, race any thieves for it */
+    if (!SDL_AtomicCAS(&deque->top, (int)top, (int)(top + 1))) {
+        job = NULL;
+    }
+    SDL_AtomicSet(&deque->bottom, (int)(top + 1));
+    return job;
+}
+
+static SDL_Job *SDL_StealJob(SDL_JobDeque *deque)
+{
+    for (;;) {
+        Uint32 top = (Uint32)SDL_AtomicGet(&deque->top);
+        Uint32 bottom = (Uint32)SDL_AtomicGet(&deque->bottom);
+        SDL_Job *job;
+
+        if ((int)(bottom - top) <= 0) {
+            return NULL;
+        }
+        SDL_MemoryBarrierAcquire();
+        job = (SDL_Job *)SDL_AtomicGetPtr(&deque->slots[top & SDL_JOB_DEQUE_MASK]);
+        if (SDL_AtomicCAS(&deque->top, (int)top, (int)(top + 1))) {
+            return job;
+        }
+    }
+}
+
+static SDL_Job *SDL_AllocJob(SDL_JobPool *pool)
+{
+    SDL_Job *job;
+
+    SDL_AtomicLock(&pool->free_lock);
+    job = pool->free_jobs;
+    if (job) {
+        pool->free_jobs = job->next;
+    }
+    SDL_AtomicUnlock(&pool->free_lock);
+
+    if (!job) {
+        job = (SDL_Job *)SDL_malloc(sizeof(*job));
+        if (!job) {
+            SDL_OutOfMemory();
+        }
+    }
+    return job;
+}
+
+static void SDL_FreeJob(SDL_JobPool *pool, SDL_Job *job)
+{
+    SDL_AtomicLock(&pool->free_lock);
+    job->next = pool->free_jobs;
+    pool->free_jobs = job;
+    SDL_AtomicUnlock(&pool->free_lock);
+}
+
+static void SDL_WakeJobWorker(SDL_JobPool *pool)
+{
+    if (SDL_AtomicGet(&pool->sleepers) > 0) {
+        SDL_PostSemaphore(pool->wakeup);
+    }
+}
+
+static SDL_Job *SDL_FindJob(SDL_JobPool *pool, SDL_JobWorker *worker)
+{
+    SDL_Job *job;
+    int i, start = 0;
+
+    if (worker) {
+        job = SDL_PopJob(&worker->deque);
+        if (job) {
+            return job;
+        }
+    }
+
+    if (SDL_AtomicGet(&pool->shared_count) > 0) {
+        SDL_LockMutex(pool->shared_lock);
+        job = pool->shared_head;
+        if (job) {
+            pool->shared_head = job->next;
+            if (!pool->shared_head) {
+                pool->shared_tail = NULL;
+            }
+            SDL_AtomicAdd(&pool->shared_count, -1);
+        }
+        SDL_UnlockMutex(pool->shared_lock);
+        if (job) {
+            return job;
+        }
+    }
+
+    /* Start from a different victim each time so thieves spread out */
+    if (worker) {
+        worker->seed ^= worker->seed << 13;
+        worker->seed ^= worker->seed >> 17;
+        worker->seed ^= worker->seed << 5;
+        start = (int)(worker->seed % (Uint32)pool->num_workers);
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_JobWorker *victim = &pool->workers[(start + i) % pool->num_workers];
+        if (victim != worker) {
+            job = SDL_StealJob(&victim->deque);
+            if (job) {
+                return job;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void SDL_FinishJobInGroup(SDL_JobPool *pool, SDL_JobGroup *group)
+{
+    for (;;) {
+        int pending = SDL_AtomicGet(&group->pending);
+        if (pending == 1) {
+            /* A waiter may free the group as soon as it sees it empty, so
+               the last job finishes while holding the lock the waiter takes
+               on the way out. */
+            SDL_LockMutex(pool->done_lock);
+            if (SDL_AtomicDecRef(&group->pending)) {
+                SDL_BroadcastCondition(pool->done_cond);
+            }
+            SDL_UnlockMutex(pool->done_lock);
+            return;
+        }
+        if (SDL_AtomicCAS(&group->pending, pending, pending - 1)) {
+            return;
+        }
+    }
+}
+
+static void SDL_RunJob(SDL_JobPool *pool, SDL_Job *job)
+{
+    SDL_JobFunction function = job->function;
+    void *userdata = job->userdata;
+    SDL_JobGroup *group = job->group;
+
+    /* Recycle the job first, the function is likely to submit more */
+    SDL_FreeJob(pool, job);
+
+    function(userdata);
+
+    if (group) {
+        SDL_FinishJobInGroup(pool, group);
+    }
+    SDL_FinishJobInGroup(pool, &pool->all);
+}
+
+static void SDL_WaitForJobs(SDL_JobPool *pool, SDL_JobGroup *group)
+{
+    SDL_JobWorker *worker = SDL_GetCurrentJobWorker(pool);
+
+    while (SDL_AtomicGet(&group->pending) > 0) {
+        SDL_Job *job = SDL_FindJob(pool, worker);
+        if (job) {
+            SDL_RunJob(pool, job);
+            continue;
+        }
+
+        /* Nothing to help with, wait for the group to finish, checking for
+           new jobs every now and then */
+        SDL_LockMutex(pool->done_lock);
+        if (SDL_AtomicGet(&group->pending) > 0) {
+            SDL_WaitConditionTimeout(pool->done_cond, pool->done_lock, 1);
+        }
+        SDL_UnlockMutex(pool->done_lock);
+    }
+
+    /* Make sure the last job is done with the group */
+    SDL_LockMutex(pool->done_lock);
+    SDL_UnlockMutex(pool->done_lock);
+}
+
+static int SDLCALL SDL_RunJobWorker(void *data)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)data;
+    SDL_JobPool *pool = worker->pool;
+
+    SDL_SetTLS(SDL_job_worker_tls, worker, NULL);
+
+    for (;;) {
+        SDL_Job *job = SDL_FindJob(pool, worker);
+        if (job) {
+            SDL_RunJob(pool, job);
+            continue;
+        }
+
+        /* Announce that we're going to sleep, then look again, so a job
+           submitted in between either gets found or wakes us up */
+        SDL_AtomicIncRef(&pool->sleepers);
+        job = SDL_FindJob(pool, worker);
+        if (job) {
+            SDL_AtomicDecRef(&pool->sleepers);
+            SDL_RunJob(pool, job);
+            continue;
+        }
+        if (SDL_AtomicGet(&pool->quit)) {
+            SDL_AtomicDecRef(&pool->sleepers);
+            break;
+        }
+        SDL_WaitSemaphore(pool->wakeup);
+        SDL_AtomicDecRef(&pool->sleepers);
+    }
+
+    SDL_SetTLS(SDL_job_worker_tls, NULL, NULL);
+    return 0;
+}
+
+static void SDL_CleanupJobPool(SDL_JobPool *pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_PostSemaphore(pool->wakeup);
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+    }
+
+    while (pool->free_jobs) {
+        SDL_Job *job = pool->free_jobs;
+        pool->free_jobs = job->next;
+        SDL_free(job);
+    }
+
+    SDL_aligned_free(pool->workers);
+    if (pool->shared_lock) {
+        SDL_DestroyMutex(pool->shared_lock);
+    }
+    if (pool->wakeup) {
+        SDL_DestroySemaphore(pool->wakeup);
+    }
+    if (pool->done_lock) {
+        SDL_DestroyMutex(pool->done_lock);
+    }
+    if (pool->done_cond) {
+        SDL_DestroyCondition(pool->done_cond);
+    }
+    SDL_free(pool);
+}
+
+SDL_JobPool *SDL_CreateJobPool(int num_threads)
+{
+    SDL_JobPool *pool;
+    int i;
+
+    if (num_threads <= 0) {
+        num_threads = SDL_max(SDL_GetCPUCount() - 1, 1);
+    }
+
+    SDL_AtomicLock(&SDL_job_worker_tls_lock);
+    if (!SDL_job_worker_tls) {
+        SDL_job_worker_tls = SDL_CreateTLS();
+    }
+    SDL_AtomicUnlock(&SDL_job_worker_tls_lock);
+
+    pool = (SDL_JobPool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->all.pool = pool;
+
+    pool->workers = (SDL_JobWorker *)SDL_aligned_alloc(SDL_CACHELINE_SIZE, num_threads * sizeof(*pool->workers));
+    if (!pool->workers) {
+        SDL_free(pool);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_memset(pool->workers, 0, num_threads * sizeof(*pool->workers));
+
+    pool->shared_lock = SDL_CreateMutex();
+    pool->wakeup = SDL_CreateSemaphore(0);
+    pool->done_lock = SDL_CreateMutex();
+    pool->done_cond = SDL_CreateCondition();
+    if (!pool->shared_lock || !pool->wakeup || !pool->done_lock || !pool->done_cond) {
+        SDL_CleanupJobPool(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        SDL_JobWorker *worker = &pool->workers[i];
+        char name[64];
+
+        worker->pool = pool;
+        worker->seed = 2463534242u + (Uint32)i * 0x9E3779B9u;
+        ++pool->num_workers;
+
+        (void)SDL_snprintf(name, sizeof(name), "SDLJobWorker%d", i);
+        worker->thread = SDL_CreateThreadInternal(SDL_RunJobWorker, name, 0, worker);
+        if (!worker->thread) {
+            SDL_CleanupJobPool(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+int SDL_GetJobPoolThreadCount(SDL_JobPool *pool)
+{
+    if (!pool) {
+        return SDL_InvalidParamError("pool");
+    }
+    return pool->num_workers;
+}
+
+void SDL_DestroyJobPool(SDL_JobPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    SDL_WaitForJobs(pool, &pool->all);
+    SDL_CleanupJobPool(pool);
+}
+
+SDL_JobGroup *SDL_CreateJobGroup(SDL_JobPool *pool)
+{
+    SDL_JobGroup *group;
+
+    if (!pool) {
+        SDL_InvalidParamError("pool");
+        return NULL;
+    }
+
+    group = (SDL_JobGroup *)SDL_calloc(1, sizeof(*group));
+    if (!group) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    group->pool = pool;
+    return group;
+}
+
+void SDL_DestroyJobGroup(SDL_JobGroup *group)
+{
+    if (!group) {
+        return;
+    }
+
+    SDL_WaitForJobs(group->pool, group);
+    SDL_free(group);
+}
+
+int SDL_SubmitJob(SDL_JobPool *pool, SDL_JobGroup *group, SDL_JobFunction function, void *userdata)
+{
+    SDL_JobWorker *worker;
+    SDL_Job *job;
+
+    if (!pool) {
+        return SDL_InvalidParamError("pool");
+    }
+    if (!function) {
+        return SDL_InvalidParamError("function");
+    }
+    if (group && group->pool != pool) {
+        return SDL_SetError("Job group belongs to a different job pool");
+    }
+
+    job = SDL_AllocJob(pool);
+    if (!job) {
+        return -1;
+    }
+    job->function = function;
+    job->userdata = userdata;
+    job->group = group;
+    job->next = NULL;
+
+    if (group) {
+        SDL_AtomicIncRef(&group->pending);
+    }
+    SDL_AtomicIncRef(&pool->all.pending);
+
+    worker = SDL_GetCurrentJobWorker(pool);
+    if (!worker || !SDL_PushJob(&worker->deque, job)) {
+        SDL_LockMutex(pool->shared_lock);
+        if (pool->shared_tail) {
+            pool->shared_tail->next = job;
+        } else {
+            pool->shared_head = job;
+        }
+        pool->shared_tail = job;
+        SDL_AtomicAdd(&pool->shared_count, 1);
+        SDL_UnlockMutex(pool->shared_lock);
+    }
+
+    SDL_WakeJobWorker(pool);
+    return 0;
+}
+
+void SDL_WaitJobGroup(SDL_JobGroup *group)
+{
+    if (!group) {
+        return;
+    }
+
+    SDL_WaitForJobs(group->pool, group);
+}
+
+typedef struct SDL_ParallelForData
+{
+    SDL_ParallelForFunction function;
+    void *userdata;
+    int start;
+    int end;
+    int grain;
+    int num_chunks;
+    SDL_AtomicInt next_chunk;
+} SDL_ParallelForData;
+
+static void SDLCALL SDL_RunParallelFor(void *userdata)
+{
+    SDL_ParallelForData *data = (SDL_ParallelForData *)userdata;
+
+    for (;;) {
+        int chunk = SDL_AtomicAdd(&data->next_chunk, 1);
+        Sint64 start, end;
+
+        if (chunk >= data->num_chunks) {
+            break;
+        }
+        start = data->start + (Sint64)chunk * data->grain;
+        end = SDL_min(start + data->grain, (Sint64)data->end);
+        data->function(data->userdata, (int)start, (int)end);
+    }
+}
+
+int SDL_ParallelFor(SDL_JobPool *pool, int start, int end, int grain, SDL_ParallelForFunction function, void *userdata)
+{
+    SDL_ParallelForData data;
+    SDL_JobGroup group;
+    Sint64 range, num_chunks;
+    int i, num_jobs;
+
+    if (!pool) {
+        return SDL_InvalidParamError("pool");
+    }
+    if (!function) {
+        return SDL_InvalidParamError("function");
+    }
+    if (end <= start) {
+        return 0;
+    }
+
+    range = (Sint64)end - start;
+    if (grain <= 0) {
+        /* A few chunks per thread, so threads that finish early can help out */
+        grain = (int)SDL_max(range / ((pool->num_workers + 1) * 4), 1);
+    }
+    num_chunks = (range + grain - 1) / grain;
+    if (num_chunks > SDL_MAX_SINT32 / 2) {
+        /* Leave room for the chunk counter to overshoot */
+        num_chunks = SDL_MAX_SINT32 / 2;
+        grain = (int)((range + num_chunks - 1) / num_chunks);
+        num_chunks = (range + grain - 1) / grain;
+    }
+    if (num_chunks == 1) {
+        function(userdata, start, end);
+        return 0;
+    }
+
+    data.function = function;
+    data.userdata = userdata;
+    data.start = start;
+    data.end = end;
+    data.grain = grain;
+    data.num_chunks = (int)num_chunks;
+    SDL_AtomicSet(&data.next_chunk, 0);
+
+    group.pool = pool;
+    SDL_AtomicSet(&group.pending, 0);
+
+    /* The calling thread takes chunks too, so one job fewer than chunks will do */
+    num_jobs = (int)SDL_min((Sint64)pool->num_workers, num_chunks - 1);
+    for (i = 0; i < num_jobs; ++i) {
+        if (SDL_SubmitJob(pool, &group, SDL_RunParallelFor, &data) < 0) {
+            break;
+        }
+    }
+
+    SDL_RunParallelFor(&data);
+    SDL_WaitForJobs(pool, &group);
+    return 0;
+}
@@ -50,6 +50,9 @@ extern void SDL_SYS_SetupThread(const char *name);
 /* This function sets the current thread priority */
 extern int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority);
 
+/* This function sets the CPUs the current thread may run on, all of them if num_cpus is 0 */
+extern int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus);
+
 /* This function waits for the thread to finish and frees any data
    allocated by SDL_SYS_CreateThread()
  */
@@ -69,6 +72,9 @@ extern SDL_Thread *
 SDL_CreateThreadInternal(int(SDLCALL *fn)(void *), const char *name,
                          const size_t stacksize, void *data);
 
+/* Apply the CPU list in an affinity hint to the current thread, if it's set */
+extern void SDL_SetThreadAffinityFromHint(const char *name);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -25,6 +25,7 @@
 #include "SDL_thread_c.h"
 #include "SDL_systhread.h"
 #include "../SDL_error_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 SDL_TLSID SDL_CreateTLS(void)
 {
@@ -431,6 +432,41 @@ int SDL_SetThreadPriority(SDL_ThreadPriority priority)
     return SDL_SYS_SetThreadPriority(priority);
 }
 
+int SDL_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    int i;
+
+    if (num_cpus < 0 || (num_cpus > 0 && !cpus)) {
+        return SDL_InvalidParamError("cpus");
+    }
+    for (i = 0; i < num_cpus; ++i) {
+        if (cpus[i] < 0) {
+            return SDL_InvalidParamError("cpus");
+        }
+    }
+    return SDL_SYS_SetThreadAffinity(cpus, num_cpus);
+}
+
+void SDL_SetThreadAffinityFromHint(const char *name)
+{
+    const char *hint = SDL_GetHint(name);
+    int *cpus, num_cpus;
+
+    if (!hint || !*hint) {
+        return;
+    }
+
+    cpus = SDL_ParseCPUList(hint, &num_cpus);
+    if (!cpus) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Ignoring %s: %s", name, SDL_GetError());
+        return;
+    }
+    if (SDL_SetThreadAffinity(cpus, num_cpus) < 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Couldn't apply %s: %s", name, SDL_GetError());
+    }
+    SDL_free(cpus);
+}
+
 void SDL_WaitThread(SDL_Thread *thread, int *status)
 {
     if (thread) {
@@ -505,3 +541,26 @@ int SDL_WaitConditionTimeout(SDL_Condition *cond, SDL_Mutex *mutex, Sint32 timeo
     }
     return SDL_WaitConditionTimeoutNS(cond, mutex, timeoutNS);
 }
+
+#ifndef SDL_THREAD_LINUX_FUTEX
+/* Only the futex implementation takes properties or keeps counters for now */
+SDL_Mutex *SDL_CreateMutexWithProperties(SDL_PropertiesID props)
+{
+    (void)props;
+    return SDL_CreateMutex();
+}
+
+SDL_PropertiesID SDL_GetMutexProperties(SDL_Mutex *mutex)
+{
+    (void)mutex;
+    SDL_Unsupported();
+    return 0;
+}
+
+SDL_PropertiesID SDL_GetSemaphoreProperties(SDL_Semaphore *sem)
+{
+    (void)sem;
+    SDL_Unsupported();
+    return 0;
+}
+#endif /* !SDL_THREAD_LINUX_FUTEX */
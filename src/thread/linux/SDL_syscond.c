@@ -0,0 +1,110 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* An implementation of condition variables using Linux futexes
+
+   Waiters sleep on a sequence number that every signal bumps, so a signal
+   that arrives between unlocking the mutex and sleeping isn't lost.
+ */
+
+#include "SDL_sysmutex_c.h"
+
+struct SDL_Condition
+{
+    SDL_AtomicInt seq;
+    SDL_AtomicInt waiters;
+};
+
+/* Create a condition variable */
+SDL_Condition *SDL_CreateCondition(void)
+{
+    SDL_Condition *cond;
+
+    cond = (SDL_Condition *)SDL_calloc(1, sizeof(SDL_Condition));
+    if (!cond) {
+        SDL_OutOfMemory();
+    }
+    return cond;
+}
+
+/* Destroy a condition variable */
+void SDL_DestroyCondition(SDL_Condition *cond)
+{
+    if (cond) {
+        SDL_free(cond);
+    }
+}
+
+/* Restart one of the threads that are waiting on the condition variable */
+int SDL_SignalCondition(SDL_Condition *cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_AtomicAdd(&cond->seq, 1);
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_FutexWake(&cond->seq, 1);
+    }
+    return 0;
+}
+
+/* Restart all threads that are waiting on the condition variable */
+int SDL_BroadcastCondition(SDL_Condition *cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_AtomicAdd(&cond->seq, 1);
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_FutexWake(&cond->seq, INT_MAX);
+    }
+    return 0;
+}
+
+int SDL_WaitConditionTimeoutNS(SDL_Condition *cond, SDL_Mutex *mutex, Sint64 timeoutNS)
+{
+    int seq, recursive, result;
+
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+    if (!mutex) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    SDL_AtomicIncRef(&cond->waiters);
+    seq = SDL_AtomicGet(&cond->seq);
+    recursive = SDL_UnlockMutexForWait(mutex);
+
+    /* Spurious wakeups are allowed, so EINTR and EAGAIN just return */
+    result = SDL_FutexWait(&cond->seq, seq, timeoutNS);
+
+    SDL_RelockMutexAfterWait(mutex, recursive);
+    SDL_AtomicDecRef(&cond->waiters);
+
+    if (result == ETIMEDOUT) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    return 0;
+}
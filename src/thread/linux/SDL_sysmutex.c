@@ -0,0 +1,273 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* An implementation of mutexes using Linux futexes, that spin for a while before sleeping */
+
+#include "SDL_sysmutex_c.h"
+
+#include <pthread.h>
+
+#define SDL_FUTEX_DEFAULT_SPIN_COUNT 100
+
+static __thread int SDL_futex_tid;
+static pthread_once_t SDL_futex_atfork_once = PTHREAD_ONCE_INIT;
+static int SDL_futex_pi_supported = -1;
+
+/* The thread that calls fork() gets a new thread ID in the child */
+static void SDL_ResetFutexThreadID(void)
+{
+    SDL_futex_tid = 0;
+}
+
+static void SDL_RegisterFutexAtFork(void)
+{
+    pthread_atfork(NULL, NULL, SDL_ResetFutexThreadID);
+}
+
+static int SDL_GetFutexThreadID(void)
+{
+    if (!SDL_futex_tid) {
+        pthread_once(&SDL_futex_atfork_once, SDL_RegisterFutexAtFork);
+        SDL_futex_tid = (int)syscall(SYS_gettid);
+    }
+    return SDL_futex_tid;
+}
+
+int SDL_GetFutexSpinCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_MUTEX_SPIN_COUNT);
+    if (hint && *hint) {
+        return SDL_max(SDL_atoi(hint), 0);
+    }
+    /* Spinning only helps if the owner can run on another core meanwhile */
+    return (SDL_GetCPUCount() > 1) ? SDL_FUTEX_DEFAULT_SPIN_COUNT : 0;
+}
+
+static SDL_bool SDL_FutexSupportsPriorityInheritance(void)
+{
+    if (SDL_futex_pi_supported < 0) {
+        /* Unlocking an uncontended PI futex we own fails only if PI futexes aren't there at all */
+        SDL_AtomicInt word;
+        SDL_AtomicSet(&word, SDL_GetFutexThreadID());
+        SDL_futex_pi_supported = (SDL_futex(&word, FUTEX_UNLOCK_PI_PRIVATE, 0, NULL) == 0) ? 1 : 0;
+    }
+    return SDL_futex_pi_supported ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_Mutex *SDL_CreateMutexWithProperties(SDL_PropertiesID props)
+{
+    SDL_Mutex *mutex;
+    Sint64 spin_count;
+
+    mutex = (SDL_Mutex *)SDL_calloc(1, sizeof(*mutex));
+    if (!mutex) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    /* The properties code creates mutexes itself, so don't touch it unless we were given some */
+    spin_count = props ? SDL_GetNumberProperty(props, "SDL.mutex.spin_count", -1) : -1;
+    if (spin_count < 0) {
+        spin_count = SDL_GetFutexSpinCount();
+    }
+    mutex->spin_count = (int)SDL_min(spin_count, SDL_MAX_SINT32);
+    if (props && SDL_GetBooleanProperty(props, "SDL.mutex.priority_inheritance", SDL_FALSE) &&
+        SDL_FutexSupportsPriorityInheritance()) {
+        mutex->priority_inheritance = SDL_TRUE;
+    }
+    return mutex;
+}
+
+SDL_Mutex *SDL_CreateMutex(void)
+{
+    return SDL_CreateMutexWithProperties(0);
+}
+
+void SDL_DestroyMutex(SDL_Mutex *mutex)
+{
+    if (mutex) {
+        if (mutex->props) {
+            SDL_DestroyProperties(mutex->props);
+        }
+        SDL_free(mutex);
+    }
+}
+
+static SDL_bool SDL_TryAcquireFutexMutex(SDL_Mutex *mutex, int tid)
+{
+    return SDL_AtomicCAS(&mutex->state, 0, mutex->priority_inheritance ? tid : 1);
+}
+
+static void SDL_AcquireFutexMutex(SDL_Mutex *mutex, int tid)
+{
+    Uint64 sleeps = 0;
+    int i;
+
+    if (SDL_TryAcquireFutexMutex(mutex, tid)) {
+        ++mutex->locks;
+        return;
+    }
+
+    /* Most critical sections are short, so the owner is likely to be done soon */
+    for (i = 0; i < mutex->spin_count; ++i) {
+        SDL_CPUPauseInstruction();
+        if (SDL_AtomicGet(&mutex->state) == 0 && SDL_TryAcquireFutexMutex(mutex, tid)) {
+            goto acquired;
+        }
+    }
+
+    if (mutex->priority_inheritance) {
+        /* The kernel queues us and lends our priority to the owner */
+        while (SDL_futex(&mutex->state, FUTEX_LOCK_PI_PRIVATE, 0, NULL) < 0) {
+            if (errno != EINTR && errno != EAGAIN) {
+                /* EDEADLK, ESRCH or ENOMEM mean something is badly wrong, but we can't return an error from
+                   here, so back off instead of spinning and try again */
+                SDL_assert(!"Couldn't lock priority inheritance mutex");
+                SDL_Delay(1);
+            }
+        }
+        ++sleeps;
+    } else {
+        /* Mark the mutex as having waiters, so the owner wakes us when unlocking */
+        while (SDL_AtomicSet(&mutex->state, 2) != 0) {
+            SDL_FutexWait(&mutex->state, 2, -1);
+            ++sleeps;
+        }
+    }
+
+acquired:
+    ++mutex->locks;
+    ++mutex->contentions;
+    mutex->sleeps += sleeps;
+}
+
+static void SDL_ReleaseFutexMutex(SDL_Mutex *mutex, int tid)
+{
+    if (mutex->priority_inheritance) {
+        if (!SDL_AtomicCAS(&mutex->state, tid, 0)) {
+            SDL_futex(&mutex->state, FUTEX_UNLOCK_PI_PRIVATE, 0, NULL);
+        }
+    } else if (SDL_AtomicAdd(&mutex->state, -1) != 1) {
+        SDL_AtomicSet(&mutex->state, 0);
+        SDL_FutexWake(&mutex->state, 1);
+    }
+}
+
+void SDL_LockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS  /* clang doesn't know about NULL mutexes */
+{
+    if (mutex != NULL) {
+        const int tid = SDL_GetFutexThreadID();
+        if (SDL_AtomicGet(&mutex->owner) == tid) {
+            ++mutex->recursive;
+        } else {
+            SDL_AcquireFutexMutex(mutex, tid);
+            SDL_AtomicSet(&mutex->owner, tid);
+            mutex->recursive = 0;
+        }
+    }
+}
+
+int SDL_TryLockMutex(SDL_Mutex *mutex)
+{
+    int retval = 0;
+
+    if (mutex) {
+        const int tid = SDL_GetFutexThreadID();
+        if (SDL_AtomicGet(&mutex->owner) == tid) {
+            ++mutex->recursive;
+        } else if (SDL_TryAcquireFutexMutex(mutex, tid)) {
+            SDL_AtomicSet(&mutex->owner, tid);
+            mutex->recursive = 0;
+            ++mutex->locks;
+        } else {
+            retval = SDL_MUTEX_TIMEDOUT;
+        }
+    }
+
+    return retval;
+}
+
+void SDL_UnlockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS  /* clang doesn't know about NULL mutexes */
+{
+    if (mutex != NULL) {
+        const int tid = SDL_GetFutexThreadID();
+
+        /* We can only unlock the mutex if we own it */
+        if (SDL_AtomicGet(&mutex->owner) != tid) {
+            SDL_assert(!"mutex not owned by this thread");
+            return;
+        }
+
+        if (mutex->recursive) {
+            --mutex->recursive;
+        } else {
+            SDL_AtomicSet(&mutex->owner, 0);
+            SDL_ReleaseFutexMutex(mutex, tid);
+        }
+    }
+}
+
+int SDL_UnlockMutexForWait(SDL_Mutex *mutex)
+{
+    const int recursive = mutex->recursive;
+
+    mutex->recursive = 0;
+    SDL_UnlockMutex(mutex);
+    return recursive;
+}
+
+void SDL_RelockMutexAfterWait(SDL_Mutex *mutex, int recursive)
+{
+    SDL_LockMutex(mutex);
+    mutex->recursive = recursive;
+}
+
+SDL_PropertiesID SDL_GetMutexProperties(SDL_Mutex *mutex)
+{
+    SDL_PropertiesID props;
+    Uint64 locks, contentions, sleeps;
+
+    if (!mutex) {
+        SDL_InvalidParamError("mutex");
+        return 0;
+    }
+
+    SDL_LockMutex(mutex);
+    if (!mutex->props) {
+        mutex->props = SDL_CreateProperties();
+    }
+    props = mutex->props;
+    if (mutex->recursive == 0) {
+        --mutex->locks;  /* Don't count our own lock. If the caller already held the mutex, we didn't add one. */
+    }
+    locks = mutex->locks;
+    contentions = mutex->contentions;
+    sleeps = mutex->sleeps;
+    SDL_UnlockMutex(mutex);
+
+    if (props) {
+        SDL_SetNumberProperty(props, "SDL.mutex.locks", (Sint64)locks);
+        SDL_SetNumberProperty(props, "SDL.mutex.contentions", (Sint64)contentions);
+        SDL_SetNumberProperty(props, "SDL.mutex.sleeps", (Sint64)sleeps);
+    }
+    return props;
+}
@@ -0,0 +1,82 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_mutex_c_h_
+#define SDL_mutex_c_h_
+
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+struct SDL_Mutex
+{
+    /* Without priority inheritance: 0 unlocked, 1 locked, 2 locked with
+       waiters. With it: the owner's thread ID, plus FUTEX_WAITERS if there
+       are waiters, as the kernel expects. */
+    SDL_AtomicInt state;
+    SDL_AtomicInt owner;
+    int recursive;
+    int spin_count;
+    SDL_bool priority_inheritance;
+
+    /* Only changed while holding the mutex */
+    Uint64 locks;
+    Uint64 contentions;
+    Uint64 sleeps;
+    SDL_PropertiesID props;
+};
+
+/* Fully unlock and relock a mutex around a condition wait, whatever its recursion depth */
+extern int SDL_UnlockMutexForWait(SDL_Mutex *mutex);
+extern void SDL_RelockMutexAfterWait(SDL_Mutex *mutex, int recursive);
+
+extern int SDL_GetFutexSpinCount(void);
+
+static SDL_INLINE long SDL_futex(SDL_AtomicInt *word, int op, int value, const struct timespec *timeout)
+{
+    return syscall(SYS_futex, &word->value, op, value, timeout, NULL, 0);
+}
+
+/* Wait while the word holds value, returns 0 when woken or ETIMEDOUT, EINTR, EAGAIN */
+static SDL_INLINE int SDL_FutexWait(SDL_AtomicInt *word, int value, Sint64 timeoutNS)
+{
+    struct timespec timeout;
+
+    if (timeoutNS >= 0) {
+        timeout.tv_sec = (time_t)(timeoutNS / SDL_NS_PER_SECOND);
+        timeout.tv_nsec = (long)(timeoutNS % SDL_NS_PER_SECOND);
+    }
+    if (SDL_futex(word, FUTEX_WAIT_PRIVATE, value, (timeoutNS >= 0) ? &timeout : NULL) < 0) {
+        return errno;
+    }
+    return 0;
+}
+
+static SDL_INLINE void SDL_FutexWake(SDL_AtomicInt *word, int count)
+{
+    SDL_futex(word, FUTEX_WAKE_PRIVATE, count, NULL);
+}
+
+#endif /* SDL_mutex_c_h_ */
@@ -0,0 +1,180 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* An implementation of semaphores using Linux futexes, that spin for a while before sleeping */
+
+#include "SDL_sysmutex_c.h"
+
+struct SDL_Semaphore
+{
+    SDL_AtomicInt count;
+    SDL_AtomicInt waiters;
+    int spin_count;
+    SDL_AtomicU64 contentions;
+    SDL_AtomicU64 sleeps;
+    SDL_AtomicInt props;
+};
+
+/* Create a semaphore, initialized with value */
+SDL_Semaphore *SDL_CreateSemaphore(Uint32 initial_value)
+{
+    SDL_Semaphore *sem;
+
+    if (initial_value > SDL_MAX_SINT32) {
+        SDL_InvalidParamError("initial_value");
+        return NULL;
+    }
+
+    sem = (SDL_Semaphore *)SDL_calloc(1, sizeof(SDL_Semaphore));
+    if (!sem) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_AtomicSet(&sem->count, (int)initial_value);
+    sem->spin_count = SDL_GetFutexSpinCount();
+    return sem;
+}
+
+void SDL_DestroySemaphore(SDL_Semaphore *sem)
+{
+    if (sem) {
+        const SDL_PropertiesID props = (SDL_PropertiesID)SDL_AtomicGet(&sem->props);
+        if (props) {
+            SDL_DestroyProperties(props);
+        }
+        SDL_free(sem);
+    }
+}
+
+static SDL_bool SDL_TryTakeSemaphore(SDL_Semaphore *sem)
+{
+    int count = SDL_AtomicGet(&sem->count);
+
+    while (count > 0) {
+        if (SDL_AtomicCAS(&sem->count, count, count - 1)) {
+            return SDL_TRUE;
+        }
+        count = SDL_AtomicGet(&sem->count);
+    }
+    return SDL_FALSE;
+}
+
+int SDL_WaitSemaphoreTimeoutNS(SDL_Semaphore *sem, Sint64 timeoutNS)
+{
+    Uint64 end = 0;
+    int retval = 0;
+    int i;
+
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+
+    /* Try the easy cases first */
+    if (SDL_TryTakeSemaphore(sem)) {
+        return 0;
+    }
+    if (timeoutNS == 0) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+
+    SDL_AtomicAddU64(&sem->contentions, 1);
+    for (i = 0; i < sem->spin_count; ++i) {
+        SDL_CPUPauseInstruction();
+        if (SDL_TryTakeSemaphore(sem)) {
+            return 0;
+        }
+    }
+
+    if (timeoutNS > 0) {
+        end = SDL_GetTicksNS() + timeoutNS;
+    }
+
+    SDL_AtomicIncRef(&sem->waiters);
+    while (!SDL_TryTakeSemaphore(sem)) {
+        Sint64 remaining = -1;
+
+        if (timeoutNS > 0) {
+            const Uint64 now = SDL_GetTicksNS();
+            if (now >= end) {
+                retval = SDL_MUTEX_TIMEDOUT;
+                break;
+            }
+            remaining = (Sint64)(end - now);
+        }
+
+        /* Returns right away if a post came in since we last looked */
+        SDL_FutexWait(&sem->count, 0, remaining);
+        SDL_AtomicAddU64(&sem->sleeps, 1);
+    }
+    SDL_AtomicDecRef(&sem->waiters);
+
+    return retval;
+}
+
+Uint32 SDL_GetSemaphoreValue(SDL_Semaphore *sem)
+{
+    if (!sem) {
+        SDL_InvalidParamError("sem");
+        return 0;
+    }
+    return (Uint32)SDL_AtomicGet(&sem->count);
+}
+
+int SDL_PostSemaphore(SDL_Semaphore *sem)
+{
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+
+    SDL_AtomicAdd(&sem->count, 1);
+    if (SDL_AtomicGet(&sem->waiters) > 0) {
+        SDL_FutexWake(&sem->count, 1);
+    }
+    return 0;
+}
+
+SDL_PropertiesID SDL_GetSemaphoreProperties(SDL_Semaphore *sem)
+{
+    SDL_PropertiesID props;
+
+    if (!sem) {
+        SDL_InvalidParamError("sem");
+        return 0;
+    }
+
+    /* Semaphores have no lock of their own, so racing callers keep the first set created */
+    props = (SDL_PropertiesID)SDL_AtomicGet(&sem->props);
+    if (!props) {
+        props = SDL_CreateProperties();
+        if (!props) {
+            return 0;
+        }
+        if (!SDL_AtomicCAS(&sem->props, 0, (int)props)) {
+            SDL_DestroyProperties(props);
+            props = (SDL_PropertiesID)SDL_AtomicGet(&sem->props);
+        }
+    }
+
+    SDL_SetNumberProperty(props, "SDL.semaphore.contentions", (Sint64)SDL_AtomicGetU64(&sem->contentions));
+    SDL_SetNumberProperty(props, "SDL.semaphore.sleeps", (Sint64)SDL_AtomicGetU64(&sem->sleeps));
+    return props;
+}
@@ -90,6 +90,11 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     RThread t;
@@ -132,4 +132,9 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return ChangeThreadPriority(GetThreadId(), value);
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
 #endif /* SDL_THREAD_PS2 */
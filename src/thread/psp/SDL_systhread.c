@@ -104,4 +104,9 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return sceKernelChangeThreadPriority(sceKernelGetThreadId(), value);
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
 #endif /* SDL_THREAD_PSP */
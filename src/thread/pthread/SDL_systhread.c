@@ -272,6 +272,89 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif /* #if __RISCOS__ */
 }
 
+#if defined(__LINUX__) || defined(__ANDROID__)
+/* The affinity the process started with, which is restored when a thread lifts its restriction.
+   It's kept for the life of the process. */
+static SDL_SpinLock initial_affinity_lock;
+static cpu_set_t *initial_affinity = NULL;
+static size_t initial_affinity_size = 0;
+
+/* Called with initial_affinity_lock held */
+static int GetInitialAffinity(void)
+{
+    int num_cpus = CPU_SETSIZE;
+
+    while (!initial_affinity) {
+        cpu_set_t *set = CPU_ALLOC(num_cpus);
+        const size_t size = CPU_ALLOC_SIZE(num_cpus);
+
+        if (!set) {
+            return SDL_OutOfMemory();
+        }
+        /* The main thread's ID is the process ID, and SDL hasn't changed its affinity yet */
+        if (sched_getaffinity(getpid(), size, set) == 0) {
+            initial_affinity = set;
+            initial_affinity_size = size;
+            break;
+        }
+        CPU_FREE(set);
+        if (errno != EINVAL) {
+            return SDL_SetError("sched_getaffinity() failed");
+        }
+        /* The kernel supports more CPUs than the set has room for */
+        num_cpus *= 2;
+    }
+    return 0;
+}
+#endif
+
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+#if defined(__LINUX__) || defined(__ANDROID__)
+    cpu_set_t *set;
+    size_t size;
+    int max_cpu = CPU_SETSIZE - 1;
+    int i, rc;
+
+    SDL_AtomicLock(&initial_affinity_lock);
+    rc = GetInitialAffinity();
+    SDL_AtomicUnlock(&initial_affinity_lock);
+    if (rc < 0) {
+        return rc;
+    }
+
+    if (num_cpus == 0) {
+        /* This only affects the calling thread on Linux */
+        if (sched_setaffinity(0, initial_affinity_size, initial_affinity) < 0) {
+            return SDL_SetError("sched_setaffinity() failed");
+        }
+        return 0;
+    }
+
+    for (i = 0; i < num_cpus; ++i) {
+        max_cpu = SDL_max(max_cpu, cpus[i]);
+    }
+    set = CPU_ALLOC(max_cpu + 1);
+    if (!set) {
+        return SDL_OutOfMemory();
+    }
+    size = CPU_ALLOC_SIZE(max_cpu + 1);
+    CPU_ZERO_S(size, set);
+    for (i = 0; i < num_cpus; ++i) {
+        CPU_SET_S(cpus[i], size, set);
+    }
+
+    rc = sched_setaffinity(0, size, set);
+    CPU_FREE(set);
+    if (rc < 0) {
+        return SDL_SetError("sched_setaffinity() failed");
+    }
+    return 0;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     pthread_join(thread->handle, 0);
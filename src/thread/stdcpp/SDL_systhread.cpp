@@ -110,6 +110,12 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif
 }
 
+extern "C" int
+SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
 extern "C" void
 SDL_SYS_WaitThread(SDL_Thread *thread)
 {
@@ -186,6 +186,30 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    DWORD_PTR mask = 0;
+    int i;
+
+    if (num_cpus == 0) {
+        DWORD_PTR system_mask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &mask, &system_mask)) {
+            return WIN_SetError("GetProcessAffinityMask()");
+        }
+    }
+    for (i = 0; i < num_cpus; ++i) {
+        /* Going past this needs processor groups, which we don't handle yet */
+        if (cpus[i] >= (int)(sizeof(mask) * 8)) {
+            return SDL_SetError("CPU %d is outside of this thread's processor group", cpus[i]);
+        }
+        mask |= (DWORD_PTR)1 << cpus[i];
+    }
+    if (!SetThreadAffinityMask(GetCurrentThread(), mask)) {
+        return WIN_SetError("SetThreadAffinityMask()");
+    }
+    return 0;
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     WaitForSingleObjectEx(thread->handle, INFINITE, FALSE);
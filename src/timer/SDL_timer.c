@@ -34,6 +34,7 @@ typedef struct SDL_Timer
     void *param;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 sequence; /* timers scheduled for the same time run in the order they were queued */
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
 } SDL_Timer;
@@ -45,13 +46,15 @@ typedef struct SDL_TimerMap
     struct SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* The timers are kept in a binary heap, ordered by scheduling time */
 typedef struct
 {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_AtomicInt nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap; /* hash table of timer IDs, always a power of two buckets */
+    int timermap_size;
+    int timermap_count;
     SDL_Mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -64,8 +67,11 @@ typedef struct
     SDL_Timer *freelist;
     SDL_AtomicInt active;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -76,24 +82,64 @@ static SDL_TimerData SDL_timer_data;
  * Timers are removed by simply setting a canceled flag
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+static SDL_bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->sequence < b->sequence;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+/* Move the timer at this heap position towards the end until it's in order */
+static void SDL_SiftTimerDown(SDL_TimerData *data, int i)
+{
+    SDL_Timer *timer = data->timers[i];
+
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= data->num_timers) {
             break;
         }
+        if (child + 1 < data->num_timers && SDL_TimerBefore(data->timers[child + 1], data->timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(data->timers[child], timer)) {
+            break;
+        }
+        data->timers[i] = data->timers[child];
+        i = child;
     }
+    data->timers[i] = timer;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static int SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    int i;
+
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return -1;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->next_sequence++;
+
+    /* Insert the timer here, and move it towards the front until it's in order */
+    i = data->num_timers++;
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, data->timers[parent])) {
+            break;
+        }
+        data->timers[i] = data->timers[parent];
+        i = parent;
     }
-    timer->next = curr;
+    data->timers[i] = timer;
+    return 0;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
@@ -105,6 +151,8 @@ static int SDLCALL SDL_TimerThread(void *_data)
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
 
+    SDL_SetThreadAffinityFromHint(SDL_HINT_THREAD_AFFINITY_TIMER);
+
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
      *  2. Handle any timers that should dispatch this cycle
@@ -126,11 +174,13 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_AtomicUnlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
+            if (SDL_AddTimerInternal(data, current) < 0) {
+                break;
+            }
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
         }
         freelist_head = NULL;
         freelist_tail = NULL;
@@ -143,21 +193,29 @@ static int SDLCALL SDL_TimerThread(void *_data)
         /* Initial delay if there are no timers */
         delay = (Uint64)-1;
 
+        if (pending) {
+            /* We're out of memory, put the rest back and try again soon */
+            for (current = pending; current->next; current = current->next) {
+            }
+            SDL_AtomicLock(&data->lock);
+            current->next = data->pending;
+            data->pending = pending;
+            SDL_AtomicUnlock(&data->lock);
+            delay = SDL_MS_TO_NS(1);
+        }
+
         tick = SDL_GetTicksNS();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
             if (tick < current->scheduled) {
                 /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+                delay = SDL_min(delay, current->scheduled - tick);
                 break;
             }
 
-            /* We're going to do something with this timer */
-            data->timers = current->next;
-
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
             } else {
@@ -166,11 +224,18 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
 
             if (interval > 0) {
-                /* Reschedule this timer */
+                /* Reschedule this timer, it's still at the front of the heap */
                 current->interval = interval;
                 current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
+                current->sequence = data->next_sequence++;
+                SDL_SiftTimerDown(data, 0);
             } else {
+                /* We're done with this timer, take it out of the heap */
+                if (--data->num_timers > 0) {
+                    data->timers[0] = data->timers[data->num_timers];
+                    SDL_SiftTimerDown(data, 0);
+                }
+
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -178,6 +243,7 @@ static int SDLCALL SDL_TimerThread(void *_data)
                     freelist_tail->next = current;
                 }
                 freelist_tail = current;
+                current->next = NULL;
 
                 SDL_AtomicSet(&current->canceled, 1);
             }
@@ -238,6 +304,7 @@ void SDL_QuitTimers(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) { /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -251,9 +318,16 @@ void SDL_QuitTimers(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
+        for (i = 0; i < data->num_timers; ++i) {
+            SDL_free(data->timers[i]);
+        }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_timers = 0;
+        data->max_timers = 0;
+        while (data->pending) {
+            timer = data->pending;
+            data->pending = timer->next;
             SDL_free(timer);
         }
         while (data->freelist) {
@@ -261,22 +335,63 @@ void SDL_QuitTimers(void)
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_size; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_size = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
+/* Add an entry to the timer ID hash table, growing it as needed -- called with the timermap locked */
+static int SDL_AddTimerMapEntry(SDL_TimerData *data, SDL_TimerMap *entry)
+{
+    SDL_TimerMap **bucket;
+
+    if (data->timermap_count >= data->timermap_size) {
+        const int size = data->timermap_size ? (data->timermap_size * 2) : 64;
+        SDL_TimerMap **timermap = (SDL_TimerMap **)SDL_calloc(size, sizeof(*timermap));
+        if (timermap) {
+            int i;
+            for (i = 0; i < data->timermap_size; ++i) {
+                while (data->timermap[i]) {
+                    SDL_TimerMap *moved = data->timermap[i];
+                    data->timermap[i] = moved->next;
+                    moved->next = timermap[moved->timerID & (size - 1)];
+                    timermap[moved->timerID & (size - 1)] = moved;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_size = size;
+        } else if (!data->timermap) {
+            return -1;
+        }
+        /* otherwise the buckets just get a little longer */
+    }
+
+    bucket = &data->timermap[entry->timerID & (data->timermap_size - 1)];
+    entry->next = *bucket;
+    *bucket = entry;
+    ++data->timermap_count;
+    return 0;
+}
+
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int result;
 
     SDL_AtomicLock(&data->lock);
     if (!SDL_AtomicGet(&data->active)) {
@@ -316,9 +431,13 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
     entry->timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    result = SDL_AddTimerMapEntry(data, entry);
     SDL_UnlockMutex(data->timermap_lock);
+    if (result < 0) {
+        SDL_free(entry);
+        SDL_free(timer);
+        return 0;
+    }
 
     /* Add the timer to the pending list for the timer thread */
     SDL_AtomicLock(&data->lock);
@@ -335,20 +454,19 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
 SDL_bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *entry = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
+    if (data->timermap) {
+        SDL_TimerMap **prev = &data->timermap[id & (data->timermap_size - 1)];
+        for (entry = *prev; entry; prev = &entry->next, entry = entry->next) {
+            if (entry->timerID == id) {
+                *prev = entry->next;
+                --data->timermap_count;
+                break;
             }
-            break;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
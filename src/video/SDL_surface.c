@@ -28,6 +28,7 @@
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 #include "../render/SDL_sysrender.h"
+#include "../SDL_trace_c.h"
 #include "../video/SDL_yuv_c.h"
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
@@ -653,6 +654,8 @@ int SDL_GetSurfaceClipRect(SDL_Surface *surface, SDL_Rect *rect)
 int SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
                              SDL_Surface *dst, const SDL_Rect *dstrect)
 {
+    int retval;
+
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
         (dst->format->palette &&
@@ -668,7 +671,10 @@ int SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
         /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
         /*              dst->map->info.flags, src->map->blit); */
     }
-    return src->map->blit(src, srcrect, dst, dstrect);
+    SDL_BeginTraceZone("SDL_BlitSurface");
+    retval = src->map->blit(src, srcrect, dst, dstrect);
+    SDL_EndTraceZone();
+    return retval;
 }
 
 int SDL_BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -968,7 +974,12 @@ int SDL_PrivateBlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcr
         if (!(src->map->info.flags & complex_copy_flags) &&
             src->format->format == dst->format->format &&
             !SDL_ISPIXELFORMAT_INDEXED(src->format->format)) {
-            return SDL_SoftStretch(src, srcrect, dst, dstrect);
+            int retval;
+
+            SDL_BeginTraceZone("SDL_SoftStretch");
+            retval = SDL_SoftStretch(src, srcrect, dst, dstrect);
+            SDL_EndTraceZone();
+            return retval;
         } else {
             return SDL_BlitSurfaceUnchecked(src, srcrect, dst, dstrect);
         }
@@ -978,8 +989,13 @@ int SDL_PrivateBlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcr
             !SDL_ISPIXELFORMAT_INDEXED(src->format->format) &&
             src->format->BytesPerPixel == 4 &&
             src->format->format != SDL_PIXELFORMAT_ARGB2101010) {
+            int retval;
+
             /* fast path */
-            return SDL_SoftStretchLinear(src, srcrect, dst, dstrect);
+            SDL_BeginTraceZone("SDL_SoftStretchLinear");
+            retval = SDL_SoftStretchLinear(src, srcrect, dst, dstrect);
+            SDL_EndTraceZone();
+            return retval;
         } else {
             /* Use intermediate surface(s) */
             SDL_Surface *tmp1 = NULL;
@@ -1438,11 +1454,20 @@ int SDL_ConvertPixels(int width, int height,
 
 #if SDL_HAVE_YUV
     if (SDL_ISPIXELFORMAT_FOURCC(src_format) && SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_BeginTraceZone("SDL_ConvertPixels_YUV_to_YUV");
+        ret = SDL_ConvertPixels_YUV_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_EndTraceZone();
+        return ret;
     } else if (SDL_ISPIXELFORMAT_FOURCC(src_format)) {
-        return SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_BeginTraceZone("SDL_ConvertPixels_YUV_to_RGB");
+        ret = SDL_ConvertPixels_YUV_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_EndTraceZone();
+        return ret;
     } else if (SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
-        return SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_BeginTraceZone("SDL_ConvertPixels_RGB_to_YUV");
+        ret = SDL_ConvertPixels_RGB_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        SDL_EndTraceZone();
+        return ret;
     }
 #else
     if (SDL_ISPIXELFORMAT_FOURCC(src_format) || SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
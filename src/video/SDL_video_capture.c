@@ -394,6 +394,7 @@ SDL_CaptureVideoThread(void *devicep)
     /* The video_capture mixing is always a high priority thread */
     SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
 #endif
+    SDL_SetThreadAffinityFromHint(SDL_HINT_THREAD_AFFINITY_VIDEO_CAPTURE);
 
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
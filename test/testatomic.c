@@ -38,6 +38,7 @@ static void RunBasicTest(void)
     SDL_SpinLock lock = 0;
 
     SDL_AtomicInt v;
+    SDL_AtomicU64 v64;
     SDL_bool tfret = SDL_FALSE;
 
     SDL_Log("\nspin lock---------------------------------------\n\n");
@@ -73,6 +74,24 @@ static void RunBasicTest(void)
     value = SDL_AtomicGet(&v);
     tfret = (SDL_AtomicCAS(&v, value, 20) == SDL_TRUE);
     SDL_Log("AtomicCAS()          tfret=%s val=%d\n", tf(tfret), SDL_AtomicGet(&v));
+
+    SDL_AtomicSet(&v, 0x0F);
+    tfret = (SDL_AtomicOr(&v, 0xF0) == 0x0F) && (SDL_AtomicGet(&v) == 0xFF);
+    SDL_Log("AtomicOr()           tfret=%s val=%d\n", tf(tfret), SDL_AtomicGet(&v));
+    tfret = (SDL_AtomicAnd(&v, 0x3C) == 0xFF) && (SDL_AtomicGet(&v) == 0x3C);
+    SDL_Log("AtomicAnd()          tfret=%s val=%d\n", tf(tfret), SDL_AtomicGet(&v));
+
+    SDL_Log("\natomic 64-bit ----------------------------------\n\n");
+
+    SDL_AtomicSetU64(&v64, 0);
+    tfret = SDL_AtomicSetU64(&v64, ((Uint64)1 << 32)) == 0;
+    SDL_Log("AtomicSetU64(2^32)   tfret=%s val=%" SDL_PRIu64 "\n", tf(tfret), SDL_AtomicGetU64(&v64));
+    tfret = SDL_AtomicAddU64(&v64, -1) == ((Uint64)1 << 32) && SDL_AtomicGetU64(&v64) == 0xFFFFFFFF;
+    SDL_Log("AtomicAddU64(-1)     tfret=%s val=%" SDL_PRIu64 "\n", tf(tfret), SDL_AtomicGetU64(&v64));
+    tfret = (SDL_AtomicCASU64(&v64, 0, 20) == SDL_FALSE);
+    SDL_Log("AtomicCASU64()       tfret=%s val=%" SDL_PRIu64 "\n", tf(tfret), SDL_AtomicGetU64(&v64));
+    tfret = (SDL_AtomicCASU64(&v64, 0xFFFFFFFF, ((Uint64)0xFFFFFFFF << 32)) == SDL_TRUE);
+    SDL_Log("AtomicCASU64()       tfret=%s val=%" SDL_PRIu64 "\n", tf(tfret), SDL_AtomicGetU64(&v64));
 }
 
 /**************************************************************************/
@@ -695,6 +714,274 @@ static void RunFIFOTest(SDL_bool lock_free)
 /* End FIFO test */
 /**************************************************************************/
 
+/**************************************************************************/
+/* Lock-free stack and queue benchmark
+ *
+ * Compares SDL_AtomicU64, SDL_AtomicStack and SDL_AtomicQueue with the same
+ * operations done under an SDL_Mutex, and checks that nothing gets lost.
+ */
+
+#define NUM_BENCH_THREADS 4
+#define BENCH_OPS         100000
+#define BENCH_BATCH       8
+
+typedef struct
+{
+    SDL_Mutex *mutex;
+    void **items;
+    int count;
+    int head;
+    int capacity;
+    Uint64 counter;
+} MutexContainer;
+
+static void *PopMutexStack(MutexContainer *container)
+{
+    void *item = NULL;
+
+    SDL_LockMutex(container->mutex);
+    if (container->count > 0) {
+        item = container->items[--container->count];
+    }
+    SDL_UnlockMutex(container->mutex);
+    return item;
+}
+
+static void PushMutexStack(MutexContainer *container, void *item)
+{
+    SDL_LockMutex(container->mutex);
+    container->items[container->count++] = item;
+    SDL_UnlockMutex(container->mutex);
+}
+
+static void *PopMutexQueue(MutexContainer *container)
+{
+    void *item = NULL;
+
+    SDL_LockMutex(container->mutex);
+    if (container->count > 0) {
+        item = container->items[container->head];
+        container->head = (container->head + 1) % container->capacity;
+        --container->count;
+    }
+    SDL_UnlockMutex(container->mutex);
+    return item;
+}
+
+static void PushMutexQueue(MutexContainer *container, void *item)
+{
+    SDL_LockMutex(container->mutex);
+    container->items[(container->head + container->count) % container->capacity] = item;
+    ++container->count;
+    SDL_UnlockMutex(container->mutex);
+}
+
+typedef struct
+{
+    SDL_bool lock_free;
+    int index;
+    SDL_AtomicU64 *counter;
+    SDL_AtomicStack *stack;
+    SDL_AtomicQueue *queue;
+    MutexContainer *container;
+    int errors;
+} BenchData;
+
+static int SDLCALL Bench_Counter(void *_data)
+{
+    BenchData *data = (BenchData *)_data;
+    int i;
+
+    for (i = 0; i < BENCH_OPS; ++i) {
+        if (data->lock_free) {
+            SDL_AtomicAddU64(data->counter, 1);
+        } else {
+            SDL_LockMutex(data->container->mutex);
+            ++data->container->counter;
+            SDL_UnlockMutex(data->container->mutex);
+        }
+    }
+    return 0;
+}
+
+static int SDLCALL Bench_Stack(void *_data)
+{
+    BenchData *data = (BenchData *)_data;
+    int i, j;
+
+    /* Push a batch of our own items, then pop a batch of anybody's */
+    for (i = 0; i < BENCH_OPS; i += BENCH_BATCH) {
+        for (j = 0; j < BENCH_BATCH; ++j) {
+            void *item = (void *)(uintptr_t)(data->index * BENCH_OPS + i + j + 1);
+            if (data->lock_free) {
+                if (SDL_PushAtomicStack(data->stack, item) < 0) {
+                    ++data->errors;
+                }
+            } else {
+                PushMutexStack(data->container, item);
+            }
+        }
+        for (j = 0; j < BENCH_BATCH; ++j) {
+            void *item;
+            if (data->lock_free) {
+                item = SDL_PopAtomicStack(data->stack);
+            } else {
+                item = PopMutexStack(data->container);
+            }
+            if (!item) {
+                ++data->errors;
+            }
+        }
+    }
+    return 0;
+}
+
+static int SDLCALL Bench_QueueWriter(void *_data)
+{
+    BenchData *data = (BenchData *)_data;
+    int i;
+
+    for (i = 0; i < BENCH_OPS; ++i) {
+        /* The writer goes in the top bits and the sequence number in the bottom */
+        void *item = (void *)(uintptr_t)(((data->index + 1) << 24) | i);
+        if (data->lock_free) {
+            if (SDL_PushAtomicQueue(data->queue, item) < 0) {
+                ++data->errors;
+            }
+        } else {
+            PushMutexQueue(data->container, item);
+        }
+    }
+    return 0;
+}
+
+static int Bench_QueueReader(BenchData *data)
+{
+    int next[NUM_BENCH_THREADS];
+    int i, received = 0;
+
+    SDL_zeroa(next);
+    while (received < NUM_BENCH_THREADS * BENCH_OPS) {
+        void *item;
+        int writer, sequence;
+
+        if (data->lock_free) {
+            item = SDL_PopAtomicQueue(data->queue);
+        } else {
+            item = PopMutexQueue(data->container);
+        }
+        if (!item) {
+            SDL_Delay(0);
+            continue;
+        }
+
+        /* Items from each writer must come out in the order they went in */
+        writer = (int)(((uintptr_t)item >> 24) - 1);
+        sequence = (int)((uintptr_t)item & 0xFFFFFF);
+        if (writer < 0 || writer >= NUM_BENCH_THREADS || sequence != next[writer]) {
+            ++data->errors;
+        } else {
+            ++next[writer];
+        }
+        ++received;
+    }
+
+    for (i = 0; i < NUM_BENCH_THREADS; ++i) {
+        if (next[i] != BENCH_OPS) {
+            ++data->errors;
+        }
+    }
+    return 0;
+}
+
+static SDL_bool RunBenchmark(const char *name, SDL_bool lock_free, int (SDLCALL *fn)(void *), SDL_bool read_queue)
+{
+    SDL_AtomicU64 counter;
+    SDL_Thread *threads[NUM_BENCH_THREADS];
+    BenchData data[NUM_BENCH_THREADS + 1];
+    MutexContainer container;
+    Uint64 start, end;
+    int i, errors = 0;
+    SDL_bool passed;
+
+    SDL_zero(container);
+    container.mutex = SDL_CreateMutex();
+    container.capacity = NUM_BENCH_THREADS * BENCH_OPS;
+    container.items = (void **)SDL_malloc(container.capacity * sizeof(*container.items));
+    SDL_AtomicSetU64(&counter, 0);
+
+    SDL_zeroa(data);
+    for (i = 0; i <= NUM_BENCH_THREADS; ++i) {
+        data[i].lock_free = lock_free;
+        data[i].index = i;
+        data[i].counter = &counter;
+        data[i].container = &container;
+    }
+    data[0].stack = SDL_CreateAtomicStack();
+    data[0].queue = SDL_CreateAtomicQueue();
+    for (i = 1; i <= NUM_BENCH_THREADS; ++i) {
+        data[i].stack = data[0].stack;
+        data[i].queue = data[0].queue;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_BENCH_THREADS; ++i) {
+        char threadname[64];
+        (void)SDL_snprintf(threadname, sizeof(threadname), "Bench%d", i);
+        threads[i] = SDL_CreateThread(fn, threadname, &data[i]);
+    }
+    if (read_queue) {
+        Bench_QueueReader(&data[NUM_BENCH_THREADS]);
+    }
+    for (i = 0; i < NUM_BENCH_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    end = SDL_GetTicksNS();
+
+    for (i = 0; i <= NUM_BENCH_THREADS; ++i) {
+        errors += data[i].errors;
+    }
+    if (fn == Bench_Counter) {
+        Uint64 total = lock_free ? SDL_AtomicGetU64(&counter) : container.counter;
+        if (total != NUM_BENCH_THREADS * BENCH_OPS) {
+            ++errors;
+        }
+    } else if (lock_free ? (SDL_PopAtomicStack(data[0].stack) || SDL_PopAtomicQueue(data[0].queue)) : (container.count != 0)) {
+        ++errors;
+    }
+    passed = (errors == 0) ? SDL_TRUE : SDL_FALSE;
+
+    SDL_Log("%-8s %-8s %8.3f ms, %8.1f ns/op, %s\n", name, lock_free ? "LockFree" : "Mutex",
+            (end - start) / 1000000.0, (double)(end - start) / (NUM_BENCH_THREADS * BENCH_OPS),
+            passed ? "passed" : "FAILED");
+
+    SDL_DestroyAtomicStack(data[0].stack);
+    SDL_DestroyAtomicQueue(data[0].queue);
+    SDL_free(container.items);
+    SDL_DestroyMutex(container.mutex);
+    return passed;
+}
+
+static SDL_bool RunLockFreeBenchmark(void)
+{
+    SDL_bool passed = SDL_TRUE;
+    int i;
+
+    SDL_Log("\nlock-free benchmark-----------------------------\n\n");
+    SDL_Log("%d threads, %d operations each\n", NUM_BENCH_THREADS, BENCH_OPS);
+
+    for (i = 0; i < 2; ++i) {
+        SDL_bool lock_free = (i == 0) ? SDL_TRUE : SDL_FALSE;
+        passed &= RunBenchmark("Counter", lock_free, Bench_Counter, SDL_FALSE);
+        passed &= RunBenchmark("Stack", lock_free, Bench_Stack, SDL_FALSE);
+        passed &= RunBenchmark("Queue", lock_free, Bench_QueueWriter, SDL_TRUE);
+    }
+    return passed;
+}
+
+/* End lock-free benchmark */
+/**************************************************************************/
+
 int main(int argc, char *argv[])
 {
     SDLTest_CommonState *state;
@@ -726,6 +1013,10 @@ int main(int argc, char *argv[])
     RunFIFOTest(SDL_FALSE);
 #endif
     RunFIFOTest(SDL_TRUE);
+    if (!RunLockFreeBenchmark()) {
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
     SDLTest_CommonDestroyState(state);
     return 0;
 }
@@ -0,0 +1,289 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast SDL_AudioStream converts, resamples and mixes audio, without playing anything. */
+
+#include <stdio.h>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define BENCH_CHUNK_FRAMES 4096
+#define BENCH_DISK_FILE    "testaudiobench.raw"
+
+typedef struct
+{
+    const char *name;
+    SDL_AudioFormat format;
+} BenchFormat;
+
+static const BenchFormat formats[] = {
+    { "u8", SDL_AUDIO_U8 },
+    { "s8", SDL_AUDIO_S8 },
+    { "s16", SDL_AUDIO_S16 },
+    { "s32", SDL_AUDIO_S32 },
+    { "f32", SDL_AUDIO_F32 },
+};
+
+static const char *format_name(SDL_AudioFormat format)
+{
+    int i;
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        if (formats[i].format == format) {
+            return formats[i].name;
+        }
+    }
+    return "other";
+}
+
+static int num_streams = 4;
+static int seconds = 10;
+static SDL_AudioSpec src_spec = { SDL_AUDIO_S16, 2, 44100 };
+static SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, 48000 };
+
+/* Makes `frames` frames of a quiet sine wave in `spec`'s format. */
+static Uint8 *make_audio(const SDL_AudioSpec *spec, int frames, int *len)
+{
+    const SDL_AudioSpec float_spec = { SDL_AUDIO_F32, spec->channels, spec->freq };
+    const int float_len = frames * (int)SDL_AUDIO_FRAMESIZE(float_spec);
+    float *samples = (float *)SDL_malloc(float_len);
+    Uint8 *data = NULL;
+    int i;
+
+    if (!samples) {
+        return NULL;
+    }
+    for (i = 0; i < frames * spec->channels; ++i) {
+        samples[i] = (float)SDL_sin((double)i * 0.013) * 0.25f;
+    }
+    if (SDL_ConvertAudioSamples(&float_spec, (const Uint8 *)samples, float_len, spec, &data, len) < 0) {
+        data = NULL;
+    }
+    SDL_free(samples);
+    return data;
+}
+
+/* Pushes all of `data` through a stream from `in` to `out`, and returns the nanoseconds spent per output frame. */
+static double bench_stream(const SDL_AudioSpec *in, const SDL_AudioSpec *out, const Uint8 *data, int len)
+{
+    const int in_chunk = BENCH_CHUNK_FRAMES * (int)SDL_AUDIO_FRAMESIZE(*in);
+    const int out_chunk = BENCH_CHUNK_FRAMES * (int)SDL_AUDIO_FRAMESIZE(*out);
+    SDL_AudioStream *stream = SDL_CreateAudioStream(in, out);
+    Uint8 *buf = (Uint8 *)SDL_malloc(out_chunk);
+    Sint64 out_frames = 0;
+    Uint64 start, elapsed;
+    int offset, got;
+
+    if (!stream || !buf) {
+        SDL_DestroyAudioStream(stream);
+        SDL_free(buf);
+        return -1.0;
+    }
+
+    start = SDL_GetTicksNS();
+    for (offset = 0; offset < len; offset += in_chunk) {
+        SDL_PutAudioStreamData(stream, data + offset, SDL_min(in_chunk, len - offset));
+        while ((got = SDL_GetAudioStreamData(stream, buf, out_chunk)) > 0) {
+            out_frames += got / SDL_AUDIO_FRAMESIZE(*out);
+        }
+    }
+    SDL_FlushAudioStream(stream);
+    while ((got = SDL_GetAudioStreamData(stream, buf, out_chunk)) > 0) {
+        out_frames += got / SDL_AUDIO_FRAMESIZE(*out);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(buf);
+    return out_frames ? (double)elapsed / (double)out_frames : 0.0;
+}
+
+/* Plays every stream through the disk driver as fast as it will go, and reports the device's own counters. */
+static int bench_mix(const Uint8 *data, int len)
+{
+    SDL_AudioStream **streams = (SDL_AudioStream **)SDL_calloc(num_streams, sizeof(SDL_AudioStream *));
+    SDL_AudioSpec device_spec;
+    SDL_AudioDeviceID devid;
+    SDL_PropertiesID props;
+    Uint64 start, elapsed;
+    Sint64 iterations, buffer_ns;
+    int sample_frames = 0;
+    int remaining;
+    int i;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &dst_spec);
+    if (!devid || !streams) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open the disk audio device: %s\n", SDL_GetError());
+        SDL_free(streams);
+        return -1;
+    }
+    SDL_GetAudioDeviceFormat(devid, &device_spec, &sample_frames);
+    SDL_PauseAudioDevice(devid);
+
+    for (i = 0; i < num_streams; ++i) {
+        streams[i] = SDL_CreateAudioStream(&src_spec, &device_spec);
+        SDL_PutAudioStreamData(streams[i], data, len);
+        SDL_FlushAudioStream(streams[i]);
+    }
+    SDL_BindAudioStreams(devid, streams, num_streams);
+
+    start = SDL_GetTicksNS();
+    SDL_ResumeAudioDevice(devid);
+    do {
+        SDL_Delay(1);
+        remaining = 0;
+        for (i = 0; i < num_streams; ++i) {
+            remaining += SDL_GetAudioStreamAvailable(streams[i]);
+        }
+    } while (remaining > 0);
+    elapsed = SDL_GetTicksNS() - start;
+
+    props = SDL_GetAudioDeviceProperties(devid);
+    iterations = SDL_GetNumberProperty(props, "SDL.audio.device.iterations", 0);
+    buffer_ns = SDL_GetNumberProperty(props, "SDL.audio.device.buffer_ns", 0);
+    if (iterations > 0) {
+        const double frames = (double)iterations * sample_frames;
+        const double avg_ns = (double)SDL_GetNumberProperty(props, "SDL.audio.device.iterate_ns", 0) / (double)iterations;
+        const double max_ns = (double)SDL_GetNumberProperty(props, "SDL.audio.device.iterate_max_ns", 0);
+        SDL_Log("Mixing: %d streams to %s %dch %dHz: %8.2f ns/frame (%.2f ns/frame per stream)\n",
+                num_streams, format_name(device_spec.format), device_spec.channels, device_spec.freq,
+                (double)elapsed / frames, (double)elapsed / frames / num_streams);
+        SDL_Log("Device thread: %d buffers of %d frames, %d underruns, %.1f us average, %.1f us max, %.1f us per buffer\n",
+                (int)iterations, sample_frames, (int)SDL_GetNumberProperty(props, "SDL.audio.device.underruns", 0),
+                avg_ns / 1000.0, max_ns / 1000.0, (double)buffer_ns / 1000.0);
+    }
+
+    SDL_CloseAudioDevice(devid);
+    for (i = 0; i < num_streams; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(streams);
+    (void)remove(BENCH_DISK_FILE);
+    return 0;
+}
+
+static SDL_bool parse_format(const char *name, SDL_AudioFormat *format)
+{
+    int i;
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        if (SDL_strcasecmp(name, formats[i].name) == 0) {
+            *format = formats[i].format;
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AudioSpec float_src, float_dst;
+    Uint8 *data, *float_data;
+    int len, float_len, frames;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed && argv[i + 1]) {
+            consumed = 2;
+            if (SDL_strcmp(argv[i], "--streams") == 0) {
+                num_streams = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--seconds") == 0) {
+                seconds = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--format") == 0) {
+                consumed = parse_format(argv[i + 1], &src_spec.format) ? 2 : -1;
+            } else if (SDL_strcmp(argv[i], "--channels") == 0) {
+                src_spec.channels = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--out-channels") == 0) {
+                dst_spec.channels = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--rate") == 0) {
+                src_spec.freq = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--out-rate") == 0) {
+                dst_spec.freq = SDL_atoi(argv[i + 1]);
+            } else if (SDL_strcmp(argv[i], "--mix-threads") == 0) {
+                SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS, argv[i + 1]);
+            } else {
+                consumed = 0;
+            }
+        }
+        if (consumed <= 0 || num_streams <= 0 || seconds <= 0 ||
+            src_spec.channels < 1 || src_spec.channels > 8 || dst_spec.channels < 1 || dst_spec.channels > 8 ||
+            src_spec.freq <= 0 || dst_spec.freq <= 0) {
+            static const char *options[] = {
+                "[--streams N]", "[--seconds N]", "[--format u8|s8|s16|s32|f32]", "[--channels N]",
+                "[--out-channels N]", "[--rate N]", "[--out-rate N]", "[--mix-threads N]", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* Mix with the disk driver, as fast as it can write. */
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "disk");
+    SDL_setenv("SDL_DISKAUDIOFILE", BENCH_DISK_FILE, 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "fast", 1);
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize the disk audio driver: %s\n", SDL_GetError());
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    frames = seconds * src_spec.freq;
+    data = make_audio(&src_spec, frames, &len);
+    float_src = src_spec;
+    float_src.format = SDL_AUDIO_F32;
+    float_src.channels = dst_spec.channels;
+    float_data = make_audio(&float_src, frames, &float_len);
+    if (!data || !float_data) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't make test audio: %s\n", SDL_GetError());
+        SDL_free(data);
+        SDL_free(float_data);
+        SDL_Quit();
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    SDL_Log("%d seconds of %s %dch %dHz audio, output %dch %dHz\n", seconds, format_name(src_spec.format),
+            src_spec.channels, src_spec.freq, dst_spec.channels, dst_spec.freq);
+
+    /* Format and channel conversion alone, with no change of rate. */
+    float_dst = dst_spec;
+    float_dst.freq = src_spec.freq;
+    SDL_Log("Conversion: %8.2f ns/frame\n", bench_stream(&src_spec, &float_dst, data, len));
+
+    /* Resampling alone, float to float. */
+    SDL_Log("Resampling: %8.2f ns/frame\n", bench_stream(&float_src, &dst_spec, float_data, float_len));
+
+    /* Everything, for every stream, mixed by a device. */
+    if (bench_mix(data, len) < 0) {
+        result = 1;
+    }
+
+    SDL_free(data);
+    SDL_free(float_data);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -30,10 +30,13 @@ static void audioSetUp(void *arg)
     }
 }
 
+#define DISK_WAVE_TEST_FILE "sdlaudio-test.wav"
+
 static void audioTearDown(void *arg)
 {
     /* Remove a possibly created file from SDL disk writer audio driver; ignore errors */
     (void)remove("sdlaudio.raw");
+    (void)remove(DISK_WAVE_TEST_FILE);
 
     SDLTest_AssertPass("Cleanup of test files completed");
 }
@@ -1249,6 +1252,1455 @@ cleanup:
 
     return status;
 }
+
+/**
+ * Check that stream gain and float mixing scale the output as expected
+ *
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_MixAudioFormat
+ */
+static int audio_streamGain(void *arg)
+{
+    int i;
+    SDL_AudioSpec spec;
+    float src[67];
+    float dst[67];
+    Sint16 src16[64];
+    Sint16 dst16[64];
+    int retval;
+    SDL_AudioStream *stream;
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 1;
+    spec.freq = 48000;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 1.0f, "Expected default gain to be 1.0");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, -1.0f) == -1, "Expected negative gain to be rejected");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, 0.5f) == 0, "Expected SDL_SetAudioStreamGain to succeed");
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 0.5f, "Expected gain to be 0.5");
+
+    for (i = 0; i < SDL_arraysize(src); ++i) {
+        src[i] = (float) i / SDL_arraysize(src);
+    }
+
+    retval = SDL_PutAudioStreamData(stream, src, sizeof(src));
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_PutAudioStreamData to succeed");
+    retval = SDL_GetAudioStreamData(stream, dst, sizeof(dst));
+    SDLTest_AssertCheck(retval == sizeof(dst), "Expected SDL_GetAudioStreamData to return %i, got %i", (int) sizeof(dst), retval);
+    for (i = 0; i < SDL_arraysize(dst); ++i) {
+        if (!SDLTest_AssertCheck(SDL_fabs(dst[i] - (src[i] * 0.5f)) < 0.0001f, "Expected sample %d to be %f, got %f", i, src[i] * 0.5f, dst[i])) {
+            break;
+        }
+    }
+
+    /* non-float formats that would otherwise be copied straight through must still get gain applied. */
+    spec.format = SDL_AUDIO_S16;
+    retval = SDL_SetAudioStreamFormat(stream, &spec, &spec);
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_SetAudioStreamFormat to succeed");
+    for (i = 0; i < SDL_arraysize(src16); ++i) {
+        src16[i] = (Sint16) (i * 256);
+    }
+    retval = SDL_PutAudioStreamData(stream, src16, sizeof(src16));
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_PutAudioStreamData to succeed");
+    retval = SDL_GetAudioStreamData(stream, dst16, sizeof(dst16));
+    SDLTest_AssertCheck(retval == sizeof(dst16), "Expected SDL_GetAudioStreamData to return %i, got %i", (int) sizeof(dst16), retval);
+    for (i = 0; i < SDL_arraysize(dst16); ++i) {
+        if (!SDLTest_AssertCheck(SDL_abs(dst16[i] - (src16[i] / 2)) <= 1, "Expected sample %d to be %d, got %d", i, src16[i] / 2, dst16[i])) {
+            break;
+        }
+    }
+
+    SDL_DestroyAudioStream(stream);
+
+    /* Mixing F32 should scale by volume and accumulate, including the non-SIMD tail. */
+    for (i = 0; i < SDL_arraysize(dst); ++i) {
+        dst[i] = 0.25f;
+    }
+    retval = SDL_MixAudioFormat((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, sizeof(src), SDL_MIX_MAXVOLUME / 2);
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_MixAudioFormat to succeed");
+    for (i = 0; i < SDL_arraysize(dst); ++i) {
+        if (!SDLTest_AssertCheck(SDL_fabs(dst[i] - (0.25f + src[i] * 0.5f)) < 0.0001f, "Expected mixed sample %d to be %f, got %f", i, 0.25f + src[i] * 0.5f, dst[i])) {
+            break;
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a stream's gain is applied when a device mixes it.
+ *
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_BindAudioStream
+ */
+static int audio_deviceStreamGain(void *arg)
+{
+    const int frames = 4800;
+    SDL_AudioSpec spec;
+    SDL_AudioSpec wav_spec;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    Uint8 *wav_buf = NULL;
+    Uint32 wav_len = 0;
+    float *data;
+    int total_delay = 0;
+    int audio_refs = 0;
+    int i;
+
+    /* Mix through the disk driver, so the output can be read back. */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        audio_refs++;
+    }
+    SDL_SetHintWithPriority("SDL_AUDIO_DRIVER", "disk", SDL_HINT_OVERRIDE);
+    SDL_setenv("SDL_DISKAUDIOFILE", DISK_WAVE_TEST_FILE, 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "fast", 1);
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected the disk audio driver to initialize: %s", SDL_GetError());
+        SDL_ResetHint("SDL_AUDIO_DRIVER");
+        for (i = 0; i < audio_refs; ++i) {
+            SDL_InitSubSystem(SDL_INIT_AUDIO);
+        }
+        return TEST_ABORTED;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &spec);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed");
+
+    data = (float *)SDL_malloc(frames * 2 * sizeof(float));
+    for (i = 0; i < frames * 2; ++i) {
+        data[i] = (float)SDL_sin((double)i * 0.01) * 0.5f;
+    }
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, 0.25f) == 0, "Expected SDL_SetAudioStreamGain to succeed");
+    SDL_PutAudioStreamData(stream, data, frames * 2 * sizeof(float));
+    SDL_FlushAudioStream(stream);
+
+    if (devid != 0 && SDL_BindAudioStream(devid, stream) == 0) {
+        while (SDL_GetAudioStreamAvailable(stream) > 0 && total_delay < 5000) {
+            SDL_Delay(10);
+            total_delay += 10;
+        }
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 0, "Expected the device to mix the whole stream");
+    }
+
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+
+    if (SDLTest_AssertCheck(SDL_LoadWAV_RW(SDL_RWFromFile(DISK_WAVE_TEST_FILE, "rb"), SDL_TRUE, &wav_spec, &wav_buf, &wav_len) == 0, "Expected SDL_LoadWAV_RW to read the written file: %s", SDL_GetError())) {
+        const float *mixed = (const float *)wav_buf;
+        if (SDLTest_AssertCheck(wav_len >= frames * 2 * sizeof(float), "Expected at least %d frames of audio, got %u bytes", frames, (unsigned int)wav_len)) {
+            for (i = 0; i < frames * 2; ++i) {
+                if (SDL_fabs(mixed[i] - data[i] * 0.25f) >= 0.00001f) {
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(i == frames * 2, "Expected the mixed output to be scaled by the stream's gain, matched %d of %d samples", i, frames * 2);
+        }
+        SDL_free(wav_buf);
+    }
+    SDL_free(data);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_setenv("SDL_DISKAUDIOFILE", "sdlaudio.raw", 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "realtime", 1);
+    SDL_ResetHint("SDL_AUDIO_DRIVER");
+    for (i = 0; i < audio_refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that gain ramps are applied per sample frame, across multiple reads
+ *
+ * \sa SDL_SetAudioStreamGainRamp
+ */
+static int audio_streamGainRamp(void *arg)
+{
+    int i;
+    SDL_AudioSpec spec;
+    float src[150 * 2];
+    float dst[150 * 2];
+    const int ramp_frames = 100;
+    const int first_read = 37;
+    int retval;
+    SDL_AudioStream *stream;
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(src); ++i) {
+        src[i] = 1.0f;
+    }
+
+    SDLTest_AssertCheck(SDL_SetAudioStreamGainRamp(stream, 0.0f, -1) == -1, "Expected negative ramp length to be rejected");
+    retval = SDL_SetAudioStreamGainRamp(stream, 0.0f, ramp_frames);
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_SetAudioStreamGainRamp to succeed");
+
+    retval = SDL_PutAudioStreamData(stream, src, sizeof(src));
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_PutAudioStreamData to succeed");
+
+    retval = SDL_GetAudioStreamData(stream, dst, first_read * 2 * sizeof(float));
+    SDLTest_AssertCheck(retval == first_read * 2 * sizeof(float), "Expected first SDL_GetAudioStreamData to succeed, got %i", retval);
+    SDLTest_AssertCheck(SDL_fabs(SDL_GetAudioStreamGain(stream) - (1.0f - ((float) first_read / ramp_frames))) < 0.0001f, "Expected gain to be partway through the ramp");
+
+    retval = SDL_GetAudioStreamData(stream, dst + (first_read * 2), sizeof(dst) - (first_read * 2 * sizeof(float)));
+    SDLTest_AssertCheck(retval == sizeof(dst) - (first_read * 2 * sizeof(float)), "Expected second SDL_GetAudioStreamData to succeed, got %i", retval);
+
+    for (i = 0; i < SDL_arraysize(dst); ++i) {
+        const int frame = i / 2;
+        const float expected = (frame < ramp_frames) ? (1.0f - ((float) (frame + 1) / ramp_frames)) : 0.0f;
+        if (!SDLTest_AssertCheck(SDL_fabs(dst[i] - expected) < 0.0001f, "Expected sample %d to be %f, got %f", i, expected, dst[i])) {
+            break;
+        }
+    }
+
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 0.0f, "Expected gain to be 0.0 after the ramp");
+
+    SDL_DestroyAudioStream(stream);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check each resampler quality level, and switching between them mid-stream.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ */
+static int audio_resamplerQuality(void *arg)
+{
+    const int rate_in = 44100;
+    const int rate_out = 48000;
+    const int freq = 5000;
+    const int frames_in = rate_in;
+    const int frames_out = rate_out;
+    /* Minimum signal-to-noise ratio for each quality level, in dB. */
+    const double min_signal_to_noise[] = { 20.0, 40.0, 55.0, 70.0 };
+    double last_signal_to_noise = 0.0;
+    SDL_AudioSpec spec_in, spec_out;
+    SDL_AudioStream *stream;
+    float *buf_in;
+    float *buf_out;
+    int quality;
+    int i;
+    int ret;
+
+    spec_in.format = SDL_AUDIO_F32;
+    spec_in.channels = 1;
+    spec_in.freq = rate_in;
+    spec_out.format = SDL_AUDIO_F32;
+    spec_out.channels = 1;
+    spec_out.freq = rate_out;
+
+    buf_in = (float *)SDL_malloc(frames_in * sizeof(float));
+    buf_out = (float *)SDL_malloc(frames_out * sizeof(float));
+    if (!SDLTest_AssertCheck(buf_in != NULL && buf_out != NULL, "Expected buffers to be created.")) {
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; ++i) {
+        buf_in[i] = (float)sine_wave_sample(i, rate_in, freq, 0);
+    }
+
+    for (quality = SDL_AUDIO_RESAMPLER_LINEAR; quality <= SDL_AUDIO_RESAMPLER_SINC_HIGH; ++quality) {
+        double sum_squared_error = 0;
+        double sum_squared_value = 0;
+        double signal_to_noise;
+
+        stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+        if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.")) {
+            break;
+        }
+
+        SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(stream) == SDL_AUDIO_RESAMPLER_SINC_HIGH, "Expected streams to default to SDL_AUDIO_RESAMPLER_SINC_HIGH");
+        ret = SDL_SetAudioStreamResamplerQuality(stream, (SDL_AudioResamplerQuality)quality);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamResamplerQuality(%d) to succeed", quality);
+        SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(stream) == quality, "Expected SDL_GetAudioStreamResamplerQuality to return %d", quality);
+
+        SDL_PutAudioStreamData(stream, buf_in, frames_in * sizeof(float));
+        SDL_FlushAudioStream(stream);
+        ret = SDL_GetAudioStreamData(stream, buf_out, frames_out * sizeof(float));
+        SDLTest_AssertCheck(ret == frames_out * (int)sizeof(float), "Expected %d bytes of output, got %d", frames_out * (int)sizeof(float), ret);
+        SDL_DestroyAudioStream(stream);
+
+        for (i = 0; i < frames_out; ++i) {
+            const double target = sine_wave_sample(i, rate_out, freq, 0);
+            const double error = target - buf_out[i];
+            sum_squared_error += error * error;
+            sum_squared_value += target * target;
+        }
+
+        signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+        SDLTest_AssertCheck(signal_to_noise >= min_signal_to_noise[quality], "Quality %d signal-to-noise ratio %f dB should be no less than %f dB.",
+                            quality, signal_to_noise, min_signal_to_noise[quality]);
+        SDLTest_AssertCheck(signal_to_noise > last_signal_to_noise, "Quality %d should be better than the level below it.", quality);
+        last_signal_to_noise = signal_to_noise;
+    }
+
+    /* Switch quality in both directions while audio is flowing, so the history has to shrink and grow. */
+    stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+    if (SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.")) {
+        const SDL_AudioResamplerQuality qualities[] = { SDL_AUDIO_RESAMPLER_LINEAR, SDL_AUDIO_RESAMPLER_SINC_HIGH, SDL_AUDIO_RESAMPLER_CUBIC, SDL_AUDIO_RESAMPLER_SINC_LOW };
+        const int chunk_in = frames_in / 4;
+        int total = 0;
+
+        SDLTest_AssertCheck(SDL_SetAudioStreamResamplerQuality(stream, (SDL_AudioResamplerQuality)-1) == -1, "Expected invalid quality to be rejected");
+        SDLTest_AssertCheck(SDL_SetAudioStreamResamplerQuality(NULL, SDL_AUDIO_RESAMPLER_LINEAR) == -1, "Expected NULL stream to be rejected");
+
+        for (i = 0; i < SDL_arraysize(qualities); ++i) {
+            SDL_SetAudioStreamResamplerQuality(stream, qualities[i]);
+            SDL_PutAudioStreamData(stream, buf_in + (i * chunk_in), chunk_in * sizeof(float));
+            if (i == SDL_arraysize(qualities) - 1) {
+                SDL_FlushAudioStream(stream);
+            }
+            ret = SDL_GetAudioStreamData(stream, buf_out + total, (frames_out - total) * sizeof(float));
+            SDLTest_AssertCheck(ret >= 0, "Expected SDL_GetAudioStreamData to succeed");
+            total += ret / (int)sizeof(float);
+        }
+
+        SDLTest_AssertCheck(total == frames_out, "Expected %d frames of output after switching quality, got %d", frames_out, total);
+        for (i = 0; i < total; ++i) {
+            if (!SDLTest_AssertCheck(SDL_fabs(buf_out[i]) <= 1.01f, "Expected output to stay in range, got %f at frame %d", buf_out[i], i)) {
+                break;
+            }
+        }
+        SDL_DestroyAudioStream(stream);
+    }
+
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+
+    return TEST_COMPLETED;
+}
+
+#define LOCK_FREE_TEST_FRAMES 200000
+
+static int SDLCALL lock_free_producer(void *data)
+{
+    SDL_AudioStream *stream = (SDL_AudioStream *)data;
+    Sint32 buf[257];
+    int total = 0;
+    int i;
+
+    while (total < LOCK_FREE_TEST_FRAMES) {
+        const int count = SDL_min((int)SDL_arraysize(buf), LOCK_FREE_TEST_FRAMES - total);
+        for (i = 0; i < count; ++i) {
+            buf[i] = total + i;
+        }
+        if (SDL_PutAudioStreamData(stream, buf, count * sizeof(Sint32)) < 0) {
+            return -1;
+        }
+        total += count;
+    }
+
+    return 0;
+}
+
+/**
+ * Check a lock-free stream, with one thread putting data while another gets it.
+ *
+ * \sa SDL_CreateAudioStreamWithProperties
+ */
+static int audio_lockFreeStream(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioSpec other_spec;
+    SDL_PropertiesID props;
+    SDL_AudioStream *stream;
+    SDL_Thread *thread;
+    Sint32 buf[300];
+    int expected = 0;
+    int thread_result = 0;
+    int ret;
+    int i;
+
+    spec.format = SDL_AUDIO_S32;
+    spec.channels = 1;
+    spec.freq = 48000;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_LOCK_FREE_BOOLEAN, SDL_TRUE);
+
+    stream = SDL_CreateAudioStreamWithProperties(props);
+    SDLTest_AssertCheck(stream == NULL, "Expected a lock-free stream without a src_spec to be rejected");
+
+    SDL_SetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER, &spec);
+    stream = SDL_CreateAudioStreamWithProperties(props);
+    if (SDLTest_AssertCheck(stream != NULL, "Expected a lock-free stream without a dst_spec to be created")) {
+        SDL_memset(buf, 0, sizeof(buf));
+        SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, buf, sizeof(buf)) == -1, "Expected putting data before there is an output format to fail");
+        SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 0, "Expected nothing to be queued, got %d bytes", SDL_GetAudioStreamQueued(stream));
+        SDL_DestroyAudioStream(stream);
+    }
+
+    SDL_SetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER, &spec);
+    stream = SDL_CreateAudioStreamWithProperties(props);
+    SDL_DestroyProperties(props);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    other_spec = spec;
+    other_spec.freq = 44100;
+    SDLTest_AssertCheck(SDL_SetAudioStreamFormat(stream, &other_spec, NULL) == -1, "Expected the input format of a lock-free stream to be fixed");
+    SDLTest_AssertCheck(SDL_SetAudioStreamFormat(stream, &spec, &spec) == 0, "Expected setting the same input format to succeed");
+
+    thread = SDL_CreateThread(lock_free_producer, "lock_free_producer", stream);
+    if (!SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed")) {
+        SDL_DestroyAudioStream(stream);
+        return TEST_ABORTED;
+    }
+
+    while (expected < LOCK_FREE_TEST_FRAMES) {
+        ret = SDL_GetAudioStreamData(stream, buf, sizeof(buf));
+        if (ret < 0) {
+            SDLTest_AssertCheck(ret >= 0, "Expected SDL_GetAudioStreamData to succeed");
+            break;
+        }
+        for (i = 0; i < ret / (int)sizeof(Sint32); ++i, ++expected) {
+            if (buf[i] != expected) {
+                break;
+            }
+        }
+        if (i != ret / (int)sizeof(Sint32)) {
+            SDLTest_AssertCheck(buf[i] == expected, "Expected frame %d to be %d, got %d", expected, expected, buf[i]);
+            break;
+        }
+    }
+
+    SDL_WaitThread(thread, &thread_result);
+    SDLTest_AssertCheck(thread_result == 0, "Expected the producer thread to put all its data");
+    SDLTest_AssertCheck(expected == LOCK_FREE_TEST_FRAMES, "Expected to get %d frames, got %d", LOCK_FREE_TEST_FRAMES, expected);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 0, "Expected nothing to be left in the stream");
+
+    /* A flush finishes the current track, and the next put starts a new one. */
+    buf[0] = 1;
+    buf[1] = 2;
+    SDL_PutAudioStreamData(stream, buf, 2 * sizeof(Sint32));
+    SDL_FlushAudioStream(stream);
+    buf[0] = 3;
+    SDL_PutAudioStreamData(stream, buf, 1 * sizeof(Sint32));
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 3 * sizeof(Sint32), "Expected 3 frames to be queued, got %d bytes", SDL_GetAudioStreamQueued(stream));
+    ret = SDL_GetAudioStreamData(stream, buf, sizeof(buf));
+    SDLTest_AssertCheck(ret == 3 * sizeof(Sint32) && buf[0] == 1 && buf[1] == 2 && buf[2] == 3, "Expected to get the data back across the flush");
+
+    SDL_ClearAudioStream(stream);
+    SDL_PutAudioStreamData(stream, buf, 2 * sizeof(Sint32));
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 2 * sizeof(Sint32), "Expected puts to work after a clear");
+
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buf, 2 * sizeof(Sint32), NULL, NULL);
+    SDLTest_AssertCheck(ret == -1, "Expected SDL_PutAudioStreamDataNoCopy to be rejected on a lock-free stream");
+
+    SDL_DestroyAudioStream(stream);
+
+    return TEST_COMPLETED;
+}
+
+#define PARALLEL_MIX_TEST_STREAMS 12
+#define PARALLEL_MIX_TEST_FRAMES 4096
+
+typedef struct
+{
+    SDL_AtomicInt captured;
+    int buflen;
+    float buffer[PARALLEL_MIX_TEST_FRAMES * 2];
+    SDL_AudioDeviceID devid;
+    SDL_AtomicInt callbacks;
+    SDL_threadID postmix_thread;
+    SDL_threadID callback_thread;
+    SDL_bool callback_threads_differ;
+} parallel_mix_capture;
+
+static void SDLCALL parallel_mix_get_callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    parallel_mix_capture *capture = (parallel_mix_capture *)userdata;
+    SDL_AudioSpec spec;
+
+    /* This takes the device lock, which would deadlock if we were called from a mixing thread. */
+    SDL_GetAudioDeviceFormat(capture->devid, &spec, NULL);
+
+    /* Only one thread ever calls these, so there's no need to protect this. */
+    if (SDL_AtomicIncRef(&capture->callbacks) == 0) {
+        capture->callback_thread = SDL_ThreadID();
+    } else if (capture->callback_thread != SDL_ThreadID()) {
+        capture->callback_threads_differ = SDL_TRUE;
+    }
+}
+
+static void SDLCALL parallel_mix_postmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    parallel_mix_capture *capture = (parallel_mix_capture *)userdata;
+    if (!SDL_AtomicGet(&capture->captured)) {
+        capture->buflen = SDL_min(buflen, (int)sizeof(capture->buffer));
+        SDL_memcpy(capture->buffer, buffer, capture->buflen);
+        capture->postmix_thread = SDL_ThreadID();
+        SDL_AtomicSet(&capture->captured, 1);
+    }
+}
+
+/* Mix a bunch of streams into one device buffer, with or without mixing threads. */
+static int parallel_mix_run(const char *mix_threads, parallel_mix_capture *capture)
+{
+    SDL_AudioStream *streams[PARALLEL_MIX_TEST_STREAMS];
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceID devid;
+    float *data;
+    int total_delay = 0;
+    int i, j;
+
+    SDL_zerop(capture);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS, mix_threads);
+    SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS_MIN_STREAMS, "2");
+    SDL_SetHint("SDL_AUDIO_DRIVER", "dummy");
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected the dummy audio driver to initialize: %s", SDL_GetError());
+        return -1;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &spec);
+    if (!SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed")) {
+        return -1;
+    }
+    SDL_PauseAudioDevice(devid);
+    SDL_SetAudioPostmixCallback(devid, parallel_mix_postmix, capture);
+    capture->devid = devid;
+
+    data = (float *)SDL_malloc(PARALLEL_MIX_TEST_FRAMES * 2 * sizeof(float));
+    for (i = 0; i < PARALLEL_MIX_TEST_STREAMS; ++i) {
+        /* Give every stream different data, and resample some of them, so the streams do real work. */
+        SDL_AudioSpec src_spec = spec;
+        src_spec.freq = (i & 1) ? 44100 : 48000;
+        for (j = 0; j < PARALLEL_MIX_TEST_FRAMES * 2; ++j) {
+            data[j] = (float)SDL_sin((double)(j * (i + 1)) * 0.01) * 0.05f;
+        }
+        streams[i] = SDL_CreateAudioStream(&src_spec, &spec);
+        SDL_PutAudioStreamData(streams[i], data, PARALLEL_MIX_TEST_FRAMES * 2 * sizeof(float));
+        SDL_SetAudioStreamGain(streams[i], 1.0f - (float)i / PARALLEL_MIX_TEST_STREAMS);
+    }
+    SDL_free(data);
+
+    /* Callbacks that don't add any data shouldn't change the output, but they have to run on the device thread. */
+    for (i = PARALLEL_MIX_TEST_STREAMS / 2; i < PARALLEL_MIX_TEST_STREAMS; i += 2) {
+        SDL_SetAudioStreamGetCallback(streams[i], parallel_mix_get_callback, capture);
+    }
+
+    SDL_BindAudioStreams(devid, streams, PARALLEL_MIX_TEST_STREAMS);
+    SDL_ResumeAudioDevice(devid);
+
+    while (!SDL_AtomicGet(&capture->captured) && total_delay < 2000) {
+        SDL_Delay(10);
+        total_delay += 10;
+    }
+
+    SDL_CloseAudioDevice(devid);
+    for (i = 0; i < PARALLEL_MIX_TEST_STREAMS; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS, NULL);
+    SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS_MIN_STREAMS, NULL);
+    SDL_SetHint("SDL_AUDIO_DRIVER", NULL);
+    SDL_InitSubSystem(SDL_INIT_AUDIO);
+
+    SDLTest_AssertCheck(SDL_AtomicGet(&capture->callbacks) > 0, "Expected the get callbacks to run");
+    SDLTest_AssertCheck(!capture->callback_threads_differ && capture->callback_thread == capture->postmix_thread, "Expected the get callbacks to run on the device thread");
+    return SDLTest_AssertCheck(SDL_AtomicGet(&capture->captured), "Expected the postmix callback to run") ? 0 : -1;
+}
+
+/**
+ * Check that mixing on worker threads gives exactly the same output as mixing on the device thread.
+ *
+ * \sa SDL_HINT_AUDIO_MIX_THREADS
+ */
+static int audio_parallelMix(void *arg)
+{
+    static parallel_mix_capture serial;
+    static parallel_mix_capture parallel;
+
+    if (parallel_mix_run("0", &serial) < 0 || parallel_mix_run("3", &parallel) < 0) {
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertCheck(serial.buflen > 0 && serial.buflen == parallel.buflen, "Expected the same buffer size, got %d and %d", serial.buflen, parallel.buflen);
+    SDLTest_AssertCheck(SDL_memcmp(serial.buffer, parallel.buffer, serial.buflen) == 0, "Expected parallel mixing to match serial mixing exactly");
+
+    return TEST_COMPLETED;
+}
+
+typedef struct
+{
+    int count;
+    const void *buf;
+    int buflen;
+} no_copy_release;
+
+static void SDLCALL no_copy_released(void *userdata, const void *buf, int buflen)
+{
+    no_copy_release *release = (no_copy_release *)userdata;
+    release->count++;
+    release->buf = buf;
+    release->buflen = buflen;
+}
+
+/**
+ * Check adding data to a stream without copying it.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+static int audio_putNoCopy(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    no_copy_release release;
+    Sint16 copied[100];
+    Sint16 referenced[300];
+    Sint16 out[500];
+    int ret;
+    int i;
+
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 1;
+    spec.freq = 48000;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(copied); ++i) {
+        copied[i] = (Sint16)i;
+    }
+    for (i = 0; i < SDL_arraysize(referenced); ++i) {
+        referenced[i] = (Sint16)(1000 + i);
+    }
+
+    SDL_zero(release);
+    SDLTest_AssertCheck(SDL_PutAudioStreamDataNoCopy(stream, referenced, 3, no_copy_released, &release) == -1, "Expected partial sample frames to be rejected");
+    SDLTest_AssertCheck(release.count == 0, "Expected the callback not to fire when the put fails");
+
+    SDL_PutAudioStreamData(stream, copied, sizeof(copied));
+    ret = SDL_PutAudioStreamDataNoCopy(stream, referenced, sizeof(referenced), no_copy_released, &release);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamDataNoCopy to succeed");
+    SDL_PutAudioStreamData(stream, copied, sizeof(copied));
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == sizeof(out), "Expected %d bytes to be available, got %d", (int)sizeof(out), SDL_GetAudioStreamAvailable(stream));
+
+    /* The referenced data has to stay around until it has all been read... */
+    ret = SDL_GetAudioStreamData(stream, out, 200 * sizeof(Sint16));
+    SDLTest_AssertCheck(ret == 200 * sizeof(Sint16), "Expected to get 200 frames, got %d bytes", ret);
+    SDLTest_AssertCheck(release.count == 0, "Expected the data to still be in use");
+
+    /* ...then it should be given back straight away. */
+    ret += SDL_GetAudioStreamData(stream, out + 200, 300 * sizeof(Sint16));
+    SDLTest_AssertCheck(ret == sizeof(out), "Expected to get all the data back, got %d bytes", ret);
+    SDLTest_AssertCheck(release.count == 1, "Expected the callback to fire once, got %d", release.count);
+    SDLTest_AssertCheck(release.buf == referenced && release.buflen == sizeof(referenced), "Expected the callback to get the original buffer");
+
+    for (i = 0; i < SDL_arraysize(out); ++i) {
+        const Sint16 expected = (i < 100) ? (Sint16)i : (i < 400) ? (Sint16)(1000 + i - 100) : (Sint16)(i - 400);
+        if (out[i] != expected) {
+            SDLTest_AssertCheck(out[i] == expected, "Expected frame %d to be %d, got %d", i, expected, out[i]);
+            break;
+        }
+    }
+
+    /* Data that never gets read is given back when the stream is cleared or destroyed. */
+    SDL_zero(release);
+    SDL_PutAudioStreamDataNoCopy(stream, referenced, sizeof(referenced), no_copy_released, &release);
+    SDL_ClearAudioStream(stream);
+    SDLTest_AssertCheck(release.count == 1, "Expected clearing the stream to release the data, got %d calls", release.count);
+
+    SDL_zero(release);
+    SDL_PutAudioStreamDataNoCopy(stream, referenced, sizeof(referenced), no_copy_released, &release);
+    SDL_DestroyAudioStream(stream);
+    SDLTest_AssertCheck(release.count == 1, "Expected destroying the stream to release the data, got %d calls", release.count);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check conversions that are done in a single fused pass give the same results as doing them step by step.
+ *
+ * \sa SDL_ConvertAudioSamples
+ */
+static int audio_convertFused(void *arg)
+{
+    SDL_AudioSpec src_spec, dst_spec;
+    Sint16 src[2 * 64];
+    Uint8 *dst = NULL;
+    int dst_len = 0;
+    int ret;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(src); ++i) {
+        src[i] = (Sint16)((i & 1) ? -(i * 511) : (i * 257));
+    }
+    src[0] = SDL_MIN_SINT16;
+    src[1] = SDL_MIN_SINT16;
+    src[2] = SDL_MAX_SINT16;
+    src[3] = SDL_MAX_SINT16;
+
+    src_spec.format = SDL_AUDIO_S16;
+    src_spec.channels = 2;
+    src_spec.freq = 48000;
+    dst_spec.format = SDL_AUDIO_F32;
+    dst_spec.channels = 1;
+    dst_spec.freq = 48000;
+
+    ret = SDL_ConvertAudioSamples(&src_spec, (const Uint8 *)src, sizeof(src), &dst_spec, &dst, &dst_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudioSamples to succeed");
+    SDLTest_AssertCheck(dst_len == 64 * sizeof(float), "Expected %d bytes of output, got %d", (int)(64 * sizeof(float)), dst_len);
+
+    if (ret == 0) {
+        const float *fdst = (const float *)dst;
+        for (i = 0; i < 64; ++i) {
+            const float expected = ((float)src[i * 2] / 32768.0f) * 0.5f + ((float)src[i * 2 + 1] / 32768.0f) * 0.5f;
+            if (fdst[i] != expected) {
+                SDLTest_AssertCheck(fdst[i] == expected, "Expected frame %d to be %f, got %f", i, expected, fdst[i]);
+                break;
+            }
+        }
+        SDLTest_AssertCheck(fdst[0] == -1.0f && fdst[1] == (32767.0f / 32768.0f), "Expected full scale input to stay in range");
+    }
+
+    SDL_free(dst);
+
+    return TEST_COMPLETED;
+}
+
+/* Writes a little endian value into a WAVE file being built. */
+static Uint8 *wave_put(Uint8 *ptr, Uint32 value, int bytes)
+{
+    int i;
+    for (i = 0; i < bytes; ++i) {
+        *(ptr++) = (Uint8)(value >> (i * 8));
+    }
+    return ptr;
+}
+
+/* Builds a WAVE file in memory, with a fmt chunk followed by a data chunk. Returns its size. */
+static size_t build_wave(Uint8 *wave, Uint16 formattag, Uint16 channels, Uint16 blockalign, Uint16 bitspersample, Uint16 samplesperblock, const Uint8 *data, Uint32 datalen)
+{
+    const Uint32 fmtlen = samplesperblock ? 20 : 16;
+    Uint8 *ptr = wave;
+
+    ptr = wave_put(ptr, 0x46464952, 4); /* RIFF */
+    ptr = wave_put(ptr, 4 + 8 + fmtlen + 8 + datalen, 4);
+    ptr = wave_put(ptr, 0x45564157, 4); /* WAVE */
+    ptr = wave_put(ptr, 0x20746D66, 4); /* fmt  */
+    ptr = wave_put(ptr, fmtlen, 4);
+    ptr = wave_put(ptr, formattag, 2);
+    ptr = wave_put(ptr, channels, 2);
+    ptr = wave_put(ptr, 22050, 4);
+    ptr = wave_put(ptr, 22050 * blockalign, 4);
+    ptr = wave_put(ptr, blockalign, 2);
+    ptr = wave_put(ptr, bitspersample, 2);
+    if (samplesperblock) {
+        ptr = wave_put(ptr, 2, 2);
+        ptr = wave_put(ptr, samplesperblock, 2);
+    }
+    ptr = wave_put(ptr, 0x61746164, 4); /* data */
+    ptr = wave_put(ptr, datalen, 4);
+    SDL_memcpy(ptr, data, datalen);
+
+    return (size_t)(ptr - wave) + datalen;
+}
+
+/* Checks a WAVE stream against the whole file loaded with SDL_LoadWAV_RW, starting at a given sample frame. */
+static void check_wave_stream(SDL_AudioStream *stream, const Uint8 *expected, Uint32 expected_len, int framesize, Sint64 frame, const char *name)
+{
+    Uint8 buf[1000];
+    Uint32 pos = (Uint32)(frame * framesize);
+    int len;
+
+    do {
+        len = SDL_GetAudioStreamData(stream, buf, sizeof(buf));
+        if (len < 0 || pos + (Uint32)len > expected_len) {
+            SDLTest_AssertCheck(SDL_FALSE, "%s: Expected no more than %u bytes, got %u", name, (unsigned int)expected_len, (unsigned int)(pos + len));
+            return;
+        } else if (SDL_memcmp(buf, expected + pos, len) != 0) {
+            SDLTest_AssertCheck(SDL_FALSE, "%s: Expected the data at byte %u to match SDL_LoadWAV_RW", name, (unsigned int)pos);
+            return;
+        }
+        pos += (Uint32)len;
+    } while (len > 0);
+
+    SDLTest_AssertCheck(pos == expected_len, "%s: Expected to read up to byte %u, stopped at %u", name, (unsigned int)expected_len, (unsigned int)pos);
+}
+
+/**
+ * Check decoding WAVE files with an audio stream gives the same data as loading them in one go, and seeking.
+ *
+ * \sa SDL_LoadWAVStream_RW
+ * \sa SDL_SeekWAVStream
+ */
+static int audio_loadWAVStream(void *arg)
+{
+    const int num_bytes = 5 * 256; /* 5 IMA ADPCM blocks, or 640 stereo 8-bit PCM frames. */
+    Uint8 *data = (Uint8 *)SDL_malloc(num_bytes);
+    Uint8 *wave = (Uint8 *)SDL_malloc(num_bytes + 64);
+    int i, j;
+
+    SDLTest_AssertCheck(data && wave, "Expected memory to be allocated");
+    if (!data || !wave) {
+        SDL_free(data);
+        SDL_free(wave);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < num_bytes; ++i) {
+        data[i] = (Uint8)((i * 7919) >> 3);
+    }
+    for (i = 0; i < num_bytes; i += 256) {
+        /* A valid IMA ADPCM block header: initial sample, step index, reserved byte. */
+        data[i + 2] = (Uint8)(i / 32);
+        data[i + 3] = 0;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        static const struct
+        {
+            Uint16 formattag, channels, blockalign, bitspersample, samplesperblock;
+            const char *name;
+        } formats[] = {
+            { 0x0001, 2, 4, 16, 0, "16-bit PCM" },
+            { 0x0001, 1, 3, 24, 0, "24-bit PCM" },
+            { 0x0007, 2, 2, 8, 0, "mu-law" },
+            { 0x0011, 1, 256, 4, 505, "IMA ADPCM" },
+        };
+        const size_t wave_len = build_wave(wave, formats[i].formattag, formats[i].channels, formats[i].blockalign, formats[i].bitspersample, formats[i].samplesperblock, data, num_bytes);
+        SDL_AudioSpec expected_spec, spec;
+        Uint8 *expected = NULL;
+        Uint32 expected_len = 0;
+        Sint64 sample_frames = 0;
+        SDL_AudioStream *stream;
+        int framesize;
+
+        if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, wave_len), SDL_TRUE, &expected_spec, &expected, &expected_len) < 0) {
+            SDLTest_AssertCheck(SDL_FALSE, "%s: Expected SDL_LoadWAV_RW to succeed, failed with: %s", formats[i].name, SDL_GetError());
+            continue;
+        }
+        framesize = SDL_AUDIO_FRAMESIZE(expected_spec);
+
+        stream = SDL_LoadWAVStream_RW(SDL_RWFromConstMem(wave, wave_len), SDL_TRUE, &spec, &sample_frames);
+        SDLTest_AssertCheck(stream != NULL, "%s: Expected SDL_LoadWAVStream_RW to succeed", formats[i].name);
+        if (stream) {
+            SDLTest_AssertCheck(spec.format == expected_spec.format && spec.channels == expected_spec.channels && spec.freq == expected_spec.freq, "%s: Expected the same spec as SDL_LoadWAV_RW", formats[i].name);
+            SDLTest_AssertCheck(sample_frames * framesize == expected_len, "%s: Expected %u sample frames, got %d", formats[i].name, (unsigned int)(expected_len / framesize), (int)sample_frames);
+
+            check_wave_stream(stream, expected, expected_len, framesize, 0, formats[i].name);
+
+            for (j = 0; j < 3; ++j) {
+                /* The start, the middle of an ADPCM block, and past the end. */
+                const Sint64 frame = (j == 0) ? 0 : (j == 1) ? 700 : sample_frames + 10;
+                const int ret = SDL_SeekWAVStream(stream, frame);
+                SDLTest_AssertCheck(ret == 0, "%s: Expected SDL_SeekWAVStream to frame %d to succeed", formats[i].name, (int)frame);
+                check_wave_stream(stream, expected, expected_len, framesize, SDL_min(frame, sample_frames), formats[i].name);
+            }
+
+            SDL_DestroyAudioStream(stream);
+        }
+
+        SDL_free(expected);
+    }
+
+    /* Streams that don't decode a WAVE file can't seek. */
+    {
+        SDL_AudioSpec spec;
+        SDL_AudioStream *stream;
+
+        spec.format = SDL_AUDIO_S16;
+        spec.channels = 1;
+        spec.freq = 22050;
+        stream = SDL_CreateAudioStream(&spec, &spec);
+        SDLTest_AssertCheck(SDL_SeekWAVStream(stream, 0) == -1, "Expected SDL_SeekWAVStream on a plain stream to fail");
+        SDL_DestroyAudioStream(stream);
+    }
+
+    SDL_free(data);
+    SDL_free(wave);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check A-law and mu-law data is expanded to the values given by the G.711 formulas, for every byte value.
+ *
+ * \sa SDL_LoadWAV_RW
+ */
+static int audio_loadWAVCompanded(void *arg)
+{
+    /* Odd-sized, so both the vectorized and scalar decoders see some of it. */
+    const int num_samples = 256 * 3 + 5;
+    Uint8 data[256 * 3 + 5];
+    Uint8 wave[256 * 3 + 5 + 64];
+    int i, j;
+
+    for (i = 0; i < num_samples; ++i) {
+        data[i] = (Uint8)((i * 97) & 0xff);
+    }
+
+    for (i = 0; i < 2; ++i) {
+        const Uint16 formattag = (i == 0) ? 0x0006 : 0x0007;
+        const char *name = (i == 0) ? "A-law" : "mu-law";
+        const size_t wave_len = build_wave(wave, formattag, 1, 1, 8, 0, data, num_samples);
+        SDL_AudioSpec spec;
+        Uint8 *audio_buf = NULL;
+        Uint32 audio_len = 0;
+        int ret;
+
+        ret = SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, wave_len), SDL_TRUE, &spec, &audio_buf, &audio_len);
+        SDLTest_AssertCheck(ret == 0, "%s: Expected SDL_LoadWAV_RW to succeed", name);
+        if (ret < 0) {
+            continue;
+        }
+        SDLTest_AssertCheck(spec.format == SDL_AUDIO_S16, "%s: Expected 16-bit samples", name);
+        SDLTest_AssertCheck(audio_len == num_samples * sizeof(Sint16), "%s: Expected %d bytes, got %u", name, (int)(num_samples * sizeof(Sint16)), (unsigned int)audio_len);
+
+        for (j = 0; j < num_samples && audio_len == num_samples * sizeof(Sint16); ++j) {
+            const Sint16 actual = ((const Sint16 *)audio_buf)[j];
+            Sint32 expected;
+            if (i == 0) {
+                const Uint8 x = (data[j] & 0x7f) ^ 0x55;
+                const int exponent = x >> 4;
+                expected = ((x & 0xf) << 4) | 0x8;
+                if (exponent > 0) {
+                    expected = (expected + 0x100) << (exponent - 1);
+                }
+                expected = (data[j] & 0x80) ? expected : -expected;
+            } else {
+                const Uint8 x = (Uint8)~data[j];
+                expected = ((((x & 0xf) << 3) + 0x84) << ((x >> 4) & 0x7)) - 0x84;
+                expected = (x & 0x80) ? -expected : expected;
+            }
+            if (actual != expected) {
+                SDLTest_AssertCheck(actual == expected, "%s: Expected byte 0x%02x to expand to %d, got %d", name, data[j], (int)expected, (int)actual);
+                break;
+            }
+        }
+
+        SDL_free(audio_buf);
+    }
+
+    return TEST_COMPLETED;
+}
+
+static const Uint16 ima_adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+/* A plain IMA ADPCM decoder to check SDL's against: decodes the first `frames` sample frames of one block. */
+static void ima_adpcm_reference_block(const Uint8 *block, int channels, int frames, Sint16 *out)
+{
+    static const int index_table[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+    int c, f;
+
+    for (c = 0; c < channels; ++c) {
+        Sint32 sample = (Sint16)(block[c * 4] | (block[c * 4 + 1] << 8));
+        int index = block[c * 4 + 2];
+
+        out[c] = (Sint16)sample;
+        for (f = 1; f < frames; ++f) {
+            /* Each channel's nibbles come in 4 byte runs, one run per channel for every 8 frames. */
+            const int n = f - 1;
+            const Uint8 byte = block[channels * 4 + (n / 8) * channels * 4 + c * 4 + (n % 8) / 2];
+            const int nibble = (n & 1) ? (byte >> 4) : (byte & 0x0f);
+            const Sint32 step = ima_adpcm_step_table[index];
+            Sint32 diff = step >> 3;
+
+            if (nibble & 4) {
+                diff += step;
+            }
+            if (nibble & 2) {
+                diff += step >> 1;
+            }
+            if (nibble & 1) {
+                diff += step >> 2;
+            }
+            sample += (nibble & 8) ? -diff : diff;
+            sample = SDL_clamp(sample, -32768, 32767);
+            index = SDL_clamp(index + index_table[nibble], 0, 88);
+            out[f * channels + c] = (Sint16)sample;
+        }
+    }
+}
+
+/* Puts a fact chunk holding the number of sample frames in front of the data chunk of a file from build_wave. */
+static size_t add_wave_fact(Uint8 *wave, size_t wave_len, Uint32 frames)
+{
+    const size_t data_pos = 12 + 8 + (wave[16] | (wave[17] << 8));
+    Uint32 riff_len = (Uint32)(wave_len - 8 + 12);
+
+    SDL_memmove(wave + data_pos + 12, wave + data_pos, wave_len - data_pos);
+    wave_put(wave + data_pos, 0x74636166, 4); /* fact */
+    wave_put(wave + data_pos + 4, 4, 4);
+    wave_put(wave + data_pos + 8, frames, 4);
+    wave_put(wave + 4, riff_len, 4);
+
+    return wave_len + 12;
+}
+
+/**
+ * Check IMA ADPCM decoding against a reference decoder, for blocks that end in a partial
+ * 8-frame group, a final block cut short by the fact chunk, and a truncated final block.
+ *
+ * \sa SDL_LoadWAV_RW
+ */
+static int audio_loadWAVIMAADPCM(void *arg)
+{
+    static const struct
+    {
+        int channels;
+        Uint32 fact_frames;  /* 0 for no fact chunk. */
+        Uint32 trailing_bytes;  /* bytes of a truncated final block, 0 for none. */
+        int trailing_frames;  /* frames decodable from those bytes. */
+        const char *name;
+    } cases[] = {
+        { 2, 36 * 2 + 20, 0, 0, "stereo, partial last block" },
+        { 3, 36 * 2 + 20, 0, 0, "3 channels, partial last block" },
+        { 2, 0, 8 + 16 + 6, 1 + 16 + 4, "stereo, truncated last block" },
+        { 3, 0, 12 + 24 + 10, 1 + 16 + 4, "3 channels, truncated last block" },
+    };
+    /* 35 frames after the header need 5 groups of 8, so every block ends in a partial group. */
+    const int samplesperblock = 36;
+    const int num_blocks = 3;
+    Uint8 data[72 * 3];
+    Uint8 wave[72 * 3 + 64];
+    Sint16 expected[36 * 3 * 3];
+    int i, j;
+
+    for (i = 0; i < (int)SDL_arraysize(cases); ++i) {
+        const int channels = cases[i].channels;
+        const int blockalign = channels * 4 + 5 * channels * 4;
+        const Uint32 datalen = cases[i].trailing_bytes ? (Uint32)(blockalign * (num_blocks - 1) + cases[i].trailing_bytes) : (Uint32)(blockalign * num_blocks);
+        const int frames = cases[i].fact_frames ? (int)cases[i].fact_frames : (cases[i].trailing_bytes ? samplesperblock * (num_blocks - 1) + cases[i].trailing_frames : samplesperblock * num_blocks);
+        size_t wave_len;
+        SDL_AudioSpec spec;
+        Uint8 *audio_buf = NULL;
+        Uint32 audio_len = 0;
+        int ret;
+
+        for (j = 0; j < (int)datalen; ++j) {
+            data[j] = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        }
+        for (j = 0; j < num_blocks; ++j) {
+            int c;
+            for (c = 0; c < channels; ++c) {
+                Uint8 *header = data + j * blockalign + c * 4;
+                header[2] = (Uint8)SDLTest_RandomIntegerInRange(0, 88);
+                header[3] = 0;
+            }
+        }
+
+        for (j = 0; j < num_blocks; ++j) {
+            const int block_frames = SDL_min(samplesperblock, frames - j * samplesperblock);
+            ima_adpcm_reference_block(data + j * blockalign, channels, block_frames, expected + j * samplesperblock * channels);
+        }
+
+        wave_len = build_wave(wave, 0x0011, (Uint16)channels, (Uint16)blockalign, 4, (Uint16)samplesperblock, data, datalen);
+        if (cases[i].fact_frames) {
+            wave_len = add_wave_fact(wave, wave_len, cases[i].fact_frames);
+            SDL_SetHint(SDL_HINT_WAVE_FACT_CHUNK, "truncate");
+        }
+        if (cases[i].trailing_bytes) {
+            SDL_SetHint(SDL_HINT_WAVE_TRUNCATION, "dropframe");
+        }
+
+        ret = SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, wave_len), SDL_TRUE, &spec, &audio_buf, &audio_len);
+        SDL_ResetHint(SDL_HINT_WAVE_FACT_CHUNK);
+        SDL_ResetHint(SDL_HINT_WAVE_TRUNCATION);
+        SDLTest_AssertCheck(ret == 0, "%s: Expected SDL_LoadWAV_RW to succeed: %s", cases[i].name, ret == 0 ? "" : SDL_GetError());
+        if (ret < 0) {
+            continue;
+        }
+        SDLTest_AssertCheck(spec.format == SDL_AUDIO_S16 && spec.channels == channels, "%s: Expected 16-bit samples in %d channels", cases[i].name, channels);
+        SDLTest_AssertCheck(audio_len == frames * channels * sizeof(Sint16), "%s: Expected %d sample frames, got %d", cases[i].name, frames, (int)(audio_len / (channels * sizeof(Sint16))));
+
+        if (audio_len == frames * channels * sizeof(Sint16)) {
+            int matched = 0;
+            for (j = 0; j < frames * channels; ++j) {
+                if (((const Sint16 *)audio_buf)[j] == expected[j]) {
+                    matched++;
+                }
+            }
+            SDLTest_AssertCheck(matched == frames * channels, "%s: Expected every sample to match the reference decoder, matched %d of %d", cases[i].name, matched, frames * channels);
+        }
+
+        SDL_free(audio_buf);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a capture device feeds every bound stream in its own output format,
+ * even while one of the streams is locked.
+ *
+ * \sa SDL_BindAudioStreams
+ * \sa SDL_GetAudioStreamQueued
+ */
+static int audio_captureFanOut(void *arg)
+{
+    SDL_AudioStream *streams[3];
+    SDL_AudioSpec spec;
+    SDL_AudioSpec dst_specs[3];
+    SDL_AudioDeviceID devid;
+    int total_delay = 0;
+    int i, j;
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint("SDL_AUDIO_DRIVER", "dummy");
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected the dummy audio driver to initialize: %s", SDL_GetError());
+        SDL_SetHint("SDL_AUDIO_DRIVER", NULL);
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+        return TEST_ABORTED;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_CAPTURE, &spec);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed for the capture device");
+
+    /* Two streams want the same format, the third has to resample. */
+    dst_specs[0].format = SDL_AUDIO_S16;
+    dst_specs[0].channels = 2;
+    dst_specs[0].freq = 48000;
+    dst_specs[1] = dst_specs[0];
+    dst_specs[2].format = SDL_AUDIO_F32;
+    dst_specs[2].channels = 1;
+    dst_specs[2].freq = 22050;
+    for (i = 0; i < SDL_arraysize(streams); ++i) {
+        streams[i] = SDL_CreateAudioStream(&spec, &dst_specs[i]);
+        SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed");
+    }
+
+    if (devid != 0 && SDL_BindAudioStreams(devid, streams, SDL_arraysize(streams)) == 0) {
+        /* Holding a stream's lock must not keep the others from getting data. */
+        SDL_LockAudioStream(streams[0]);
+        while ((SDL_GetAudioStreamAvailable(streams[1]) <= 0 || SDL_GetAudioStreamAvailable(streams[2]) <= 0) && total_delay < 2000) {
+            SDL_Delay(10);
+            total_delay += 10;
+        }
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(streams[1]) > 0, "Expected data in the second stream while the first is locked");
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(streams[2]) > 0, "Expected data in the third stream while the first is locked");
+        SDL_UnlockAudioStream(streams[0]);
+
+        total_delay = 0;
+        while (SDL_GetAudioStreamAvailable(streams[0]) <= 0 && total_delay < 2000) {
+            SDL_Delay(10);
+            total_delay += 10;
+        }
+        SDL_UnbindAudioStreams(streams, SDL_arraysize(streams));
+
+        /* The dummy driver captures silence, which is zero in every format here. */
+        for (i = 0; i < SDL_arraysize(streams); ++i) {
+            const int frame_size = SDL_AUDIO_FRAMESIZE(dst_specs[i]);
+            Uint8 buf[1024];
+            const int len = SDL_GetAudioStreamData(streams[i], buf, sizeof(buf));
+            SDLTest_AssertCheck(len > 0 && (len % frame_size) == 0, "Expected whole frames from stream %d, got %d bytes", i, len);
+            for (j = 0; j < len && buf[j] == 0; ++j) {
+            }
+            SDLTest_AssertCheck(j == len, "Expected silence from stream %d", i);
+        }
+    } else {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_BindAudioStreams to succeed: %s", SDL_GetError());
+    }
+
+    for (i = 0; i < SDL_arraysize(streams); ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_CloseAudioDevice(devid);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint("SDL_AUDIO_DRIVER", NULL);
+    SDL_InitSubSystem(SDL_INIT_AUDIO);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that the disk driver can write a WAVE file faster than real time.
+ *
+ * \sa SDL_OpenAudioDevice
+ * \sa SDL_LoadWAV_RW
+ */
+static int audio_diskFastWave(void *arg)
+{
+    const int frames = 48000 * 2; /* two seconds of audio */
+    SDL_AudioSpec spec;
+    SDL_AudioSpec wav_spec;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    SDL_RWops *wav_io;
+    Uint8 *wav_buf = NULL;
+    Uint32 wav_len = 0;
+    float *data;
+    int total_delay = 0;
+    int audio_refs = 0;
+    int i;
+
+    /* The test harness holds the audio subsystem too, so let go of every reference to really restart it. */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        audio_refs++;
+    }
+    SDL_SetHintWithPriority("SDL_AUDIO_DRIVER", "disk", SDL_HINT_OVERRIDE);
+    SDL_setenv("SDL_DISKAUDIOFILE", DISK_WAVE_TEST_FILE, 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "fast", 1);
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected the disk audio driver to initialize: %s", SDL_GetError());
+        SDL_ResetHint("SDL_AUDIO_DRIVER");
+        for (i = 0; i < audio_refs; ++i) {
+            SDL_InitSubSystem(SDL_INIT_AUDIO);
+        }
+        return TEST_ABORTED;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &spec);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed");
+
+    data = (float *)SDL_malloc(frames * 2 * sizeof(float));
+    for (i = 0; i < frames * 2; ++i) {
+        data[i] = (float)SDL_sin((double)i * 0.01) * 0.5f;
+    }
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDL_PutAudioStreamData(stream, data, frames * 2 * sizeof(float));
+    SDL_FlushAudioStream(stream);
+
+    if (devid != 0 && SDL_BindAudioStream(devid, stream) == 0) {
+        /* Two seconds of audio should take far less than two seconds to write. */
+        while (SDL_GetAudioStreamAvailable(stream) > 0 && total_delay < 5000) {
+            SDL_Delay(10);
+            total_delay += 10;
+        }
+        SDLTest_AssertCheck(total_delay < 2000, "Expected the audio to be written faster than real time, took %d ms", total_delay);
+    }
+
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+
+    if (SDLTest_AssertCheck(SDL_LoadWAV_RW(SDL_RWFromFile(DISK_WAVE_TEST_FILE, "rb"), SDL_TRUE, &wav_spec, &wav_buf, &wav_len) == 0, "Expected SDL_LoadWAV_RW to read the written file: %s", SDL_GetError())) {
+        const Uint32 data_len = (Uint32)(frames * 2 * sizeof(float));
+        SDLTest_AssertCheck(wav_spec.format == SDL_AUDIO_F32 && wav_spec.channels == 2 && wav_spec.freq == 48000, "Expected the file to be in the device format");
+        SDLTest_AssertCheck(wav_len >= data_len, "Expected at least %u bytes of audio, got %u", (unsigned int)data_len, (unsigned int)wav_len);
+        SDLTest_AssertCheck(wav_len >= data_len && SDL_memcmp(wav_buf, data, data_len) == 0, "Expected the file to hold exactly what was played");
+        SDL_free(wav_buf);
+    }
+    SDL_free(data);
+
+    /* The RIFF size covers everything after it, including any pad byte after the data. */
+    wav_io = SDL_RWFromFile(DISK_WAVE_TEST_FILE, "rb");
+    if (SDLTest_AssertCheck(wav_io != NULL, "Expected to reopen the written file")) {
+        Uint32 riff_len = 0;
+        const Sint64 file_len = SDL_RWsize(wav_io);
+        SDL_RWseek(wav_io, 4, SDL_RW_SEEK_SET);
+        SDL_ReadU32LE(wav_io, &riff_len);
+        SDLTest_AssertCheck((Sint64)riff_len + 8 == file_len, "Expected the RIFF size to match the file size, got %u for %d bytes", (unsigned int)riff_len, (int)file_len);
+        SDLTest_AssertCheck((file_len % 2) == 0, "Expected the file to have an even length");
+        SDL_RWclose(wav_io);
+    }
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_setenv("SDL_DISKAUDIOFILE", "sdlaudio.raw", 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "realtime", 1);
+    SDL_ResetHint("SDL_AUDIO_DRIVER");
+    for (i = 0; i < audio_refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that the disk driver's fast mode waits for every bound stream before mixing.
+ *
+ * \sa SDL_OpenAudioDevice
+ * \sa SDL_BindAudioStreams
+ */
+static int audio_diskFastWaveStreams(void *arg)
+{
+    const int frames = 480 * 50; /* half a second of audio */
+    const int chunk_frames = 480;
+    SDL_AudioSpec spec;
+    SDL_AudioSpec wav_spec;
+    SDL_AudioStream *streams[2];
+    SDL_AudioDeviceID devid;
+    Uint8 *wav_buf = NULL;
+    Uint32 wav_len = 0;
+    float *data;
+    int total_delay = 0;
+    int audio_refs = 0;
+    int i;
+
+    /* The test harness holds the audio subsystem too, so let go of every reference to really restart it. */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        audio_refs++;
+    }
+    SDL_SetHintWithPriority("SDL_AUDIO_DRIVER", "disk", SDL_HINT_OVERRIDE);
+    SDL_setenv("SDL_DISKAUDIOFILE", DISK_WAVE_TEST_FILE, 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "fast", 1);
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected the disk audio driver to initialize: %s", SDL_GetError());
+        SDL_ResetHint("SDL_AUDIO_DRIVER");
+        for (i = 0; i < audio_refs; ++i) {
+            SDL_InitSubSystem(SDL_INIT_AUDIO);
+        }
+        return TEST_ABORTED;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &spec);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed");
+
+    data = (float *)SDL_malloc(frames * 2 * sizeof(float));
+    for (i = 0; i < frames * 2; ++i) {
+        data[i] = (float)SDL_sin((double)i * 0.01) * 0.25f;
+    }
+
+    /* The first stream has all its data up front; the second trickles in slower than the device could write it. */
+    streams[0] = SDL_CreateAudioStream(&spec, &spec);
+    streams[1] = SDL_CreateAudioStream(&spec, &spec);
+    SDL_PutAudioStreamData(streams[0], data, frames * 2 * sizeof(float));
+    SDL_FlushAudioStream(streams[0]);
+
+    if (devid != 0 && SDL_BindAudioStreams(devid, streams, 2) == 0) {
+        for (i = 0; i < frames; i += chunk_frames) {
+            SDL_PutAudioStreamData(streams[1], &data[i * 2], chunk_frames * 2 * sizeof(float));
+            SDL_Delay(2);
+        }
+        SDL_FlushAudioStream(streams[1]);
+        while ((SDL_GetAudioStreamAvailable(streams[0]) > 0 || SDL_GetAudioStreamAvailable(streams[1]) > 0) && total_delay < 5000) {
+            SDL_Delay(10);
+            total_delay += 10;
+        }
+    }
+
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(streams[0]);
+    SDL_DestroyAudioStream(streams[1]);
+
+    /* If the device had mixed the first stream alone while waiting on the second, they'd be out of step. */
+    if (SDLTest_AssertCheck(SDL_LoadWAV_RW(SDL_RWFromFile(DISK_WAVE_TEST_FILE, "rb"), SDL_TRUE, &wav_spec, &wav_buf, &wav_len) == 0, "Expected SDL_LoadWAV_RW to read the written file: %s", SDL_GetError())) {
+        const float *mixed = (const float *)wav_buf;
+        const int mixed_samples = (int)(wav_len / sizeof(float));
+        int matched = 0;
+        SDLTest_AssertCheck(wav_spec.format == SDL_AUDIO_F32 && wav_spec.channels == 2, "Expected the file to be in the device format");
+        SDLTest_AssertCheck(mixed_samples >= frames * 2, "Expected at least %d samples of audio, got %d", frames * 2, mixed_samples);
+        for (i = 0; i < frames * 2 && i < mixed_samples; ++i) {
+            if (SDL_fabsf(mixed[i] - (data[i] * 2.0f)) <= 1e-6f) {
+                matched++;
+            }
+        }
+        SDLTest_AssertCheck(matched == frames * 2, "Expected both streams to be mixed in step, matched %d of %d samples", matched, frames * 2);
+        SDL_free(wav_buf);
+    }
+    SDL_free(data);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_setenv("SDL_DISKAUDIOFILE", "sdlaudio.raw", 1);
+    SDL_setenv("SDL_DISKAUDIOTIMING", "realtime", 1);
+    SDL_ResetHint("SDL_AUDIO_DRIVER");
+    for (i = 0; i < audio_refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check the device thread's counters reported in an audio device's properties.
+ *
+ * \sa SDL_GetAudioDeviceProperties
+ */
+static int audio_deviceProperties(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    SDL_PropertiesID props;
+    Sint64 iterations = 0;
+    float data[480 * 2];
+    int total_delay = 0;
+    int i;
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, &spec);
+    if (!SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    props = SDL_GetAudioDeviceProperties(devid);
+    SDLTest_AssertCheck(props != 0, "Expected SDL_GetAudioDeviceProperties to succeed");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.audio.device.buffer_ns", 0) > 0, "Expected a buffer duration");
+
+    for (i = 0; i < SDL_arraysize(data); ++i) {
+        data[i] = 0.25f;
+    }
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDL_PutAudioStreamData(stream, data, sizeof(data));
+    SDL_BindAudioStream(devid, stream);
+
+    while (iterations < 2 && total_delay < 2000) {
+        SDL_Delay(10);
+        total_delay += 10;
+        iterations = SDL_GetNumberProperty(SDL_GetAudioDeviceProperties(devid), "SDL.audio.device.iterations", 0);
+    }
+    SDLTest_AssertCheck(iterations >= 2, "Expected the device thread to count its buffers, got %d", (int)iterations);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.audio.device.iterate_ns", 0) > 0, "Expected time spent in the device thread");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.audio.device.iterate_max_ns", 0) > 0, "Expected a longest buffer time");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.audio.device.iterate_max_ns", 0) <= SDL_GetNumberProperty(props, "SDL.audio.device.iterate_ns", 0),
+                        "Expected the longest buffer time to be no more than the total");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.audio.device.underruns", -1) >= 0, "Expected an underrun count");
+
+    SDL_DestroyAudioStream(stream);
+    SDL_CloseAudioDevice(devid);
+
+    SDLTest_AssertCheck(SDL_GetAudioDeviceProperties(0) == 0, "Expected an invalid device to fail");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1326,12 +2778,74 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_streamGain, "audio_streamGain", "Check stream gain and float mixing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_streamGainRamp, "audio_streamGainRamp", "Check stream gain ramps.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_resamplerQuality, "audio_resamplerQuality", "Check resampler quality levels.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_lockFreeStream, "audio_lockFreeStream", "Check lock-free single producer, single consumer streams.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_parallelMix, "audio_parallelMix", "Check mixing bound streams on worker threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_putNoCopy, "audio_putNoCopy", "Check adding data to a stream without copying it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_convertFused, "audio_convertFused", "Check fused format and channel conversions.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_loadWAVStream, "audio_loadWAVStream", "Check decoding WAVE files with an audio stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    audio_loadWAVCompanded, "audio_loadWAVCompanded", "Check expanding A-law and mu-law data.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest28 = {
+    audio_captureFanOut, "audio_captureFanOut", "Check that a capture device feeds every bound stream in its own format.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest29 = {
+    audio_diskFastWave, "audio_diskFastWave", "Check that the disk driver can write a WAVE file faster than real time.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest30 = {
+    audio_deviceProperties, "audio_deviceProperties", "Check the device thread's counters reported in an audio device's properties.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest31 = {
+    audio_deviceStreamGain, "audio_deviceStreamGain", "Check stream gain applied while a device mixes.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest32 = {
+    audio_diskFastWaveStreams, "audio_diskFastWaveStreams", "Check that the disk driver's fast mode waits for every bound stream before mixing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest33 = {
+    audio_loadWAVIMAADPCM, "audio_loadWAVIMAADPCM", "Check IMA ADPCM decoding of partial and truncated blocks against a reference decoder.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22,
+    &audioTest23, &audioTest24, &audioTest25, &audioTest26, &audioTest27, &audioTest28, &audioTest29, &audioTest30,
+    &audioTest31, &audioTest32, &audioTest33, NULL
 };
 
 /* Audio test suite (global) */
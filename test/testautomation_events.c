@@ -175,6 +175,497 @@ static int events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Event filter that keeps user events with an even code */
+static int SDLCALL events_keepEvenCodes(void *userdata, SDL_Event *event)
+{
+    return (event->user.code % 2) == 0;
+}
+
+/**
+ * Check that the event queue keeps events in order as it wraps around and grows,
+ * and while events are taken out of the middle of it.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_FlushEvents
+ * \sa SDL_FilterEvents
+ */
+static int events_queueOrder(void *arg)
+{
+    SDL_Event events[512];
+    SDL_Event event;
+    int i, result, pushed = 0;
+    SDL_bool ordered;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_zero(event);
+
+    /* Fill and partly drain the queue, so it wraps around before it has to grow */
+    for (i = 0; i < 100; ++i, ++pushed) {
+        event.type = SDL_EVENT_USER + (pushed % 2);
+        event.user.code = pushed;
+        SDL_PushEvent(&event);
+    }
+    result = SDL_PeepEvents(events, 90, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == 90, "Check number of events taken, expected: 90, got: %d", result);
+    for (i = 0; i < 400; ++i, ++pushed) {
+        event.type = SDL_EVENT_USER + (pushed % 2);
+        event.user.code = pushed;
+        SDL_PushEvent(&event);
+    }
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == 410, "Check number of events queued, expected: 410, got: %d", result);
+    for (i = 0, ordered = SDL_TRUE; i < result; ++i) {
+        ordered = ordered && (events[i].user.code == 90 + i);
+    }
+    SDLTest_AssertCheck(ordered, "Check that queued events are in order");
+
+    /* Take out every other event */
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER + 1, SDL_EVENT_USER + 1);
+    SDLTest_AssertCheck(result == 205, "Check number of odd events taken, expected: 205, got: %d", result);
+    for (i = 0, ordered = SDL_TRUE; i < result; ++i) {
+        ordered = ordered && (events[i].type == SDL_EVENT_USER + 1) && (events[i].user.code == 91 + i * 2);
+    }
+    SDLTest_AssertCheck(ordered, "Check that odd events came out in order");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 1), "Check that no odd events are left");
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == 205, "Check number of even events left, expected: 205, got: %d", result);
+    for (i = 0, ordered = SDL_TRUE; i < result; ++i) {
+        ordered = ordered && (events[i].type == SDL_EVENT_USER) && (events[i].user.code == 90 + i * 2);
+    }
+    SDLTest_AssertCheck(ordered, "Check that even events stayed in order");
+
+    /* Filter out some of what's left, then flush the rest */
+    for (i = 0; i < 5; ++i) {
+        event.type = SDL_EVENT_USER + 2;
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    SDL_FilterEvents(events_keepEvenCodes, NULL);
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, SDL_EVENT_USER + 2, SDL_EVENT_USER + 2);
+    SDLTest_AssertCheck(result == 3, "Check number of events left after filtering, expected: 3, got: %d", result);
+    SDLTest_AssertCheck(result == 3 && events[0].user.code == 0 && events[1].user.code == 2 && events[2].user.code == 4, "Check that filtered events stayed in order");
+
+    SDL_FlushEvents(SDL_EVENT_USER, SDL_EVENT_USER + 2);
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_USER, SDL_EVENT_LAST), "Check that all user events were flushed");
+
+    return TEST_COMPLETED;
+}
+
+#define EVENTS_FILTERED 100
+#define EVENTS_PUSHED_PER_FILTER_CALL 20
+
+/* Event filter that keeps user events with an even code, and pushes more events for each odd one */
+static int SDLCALL events_pushWhileFiltering(void *userdata, SDL_Event *event)
+{
+    SDL_Event pushed;
+    int i;
+
+    if ((event->user.code % 2) == 0) {
+        return 1;
+    }
+
+    SDL_zero(pushed);
+    pushed.type = SDL_EVENT_USER + 4;
+    for (i = 0; i < EVENTS_PUSHED_PER_FILTER_CALL; ++i) {
+        pushed.user.code = event->user.code * EVENTS_PUSHED_PER_FILTER_CALL + i;
+        SDL_PushEvent(&pushed);
+    }
+    return 0;
+}
+
+/**
+ * Check that events pushed by the filter passed to SDL_FilterEvents() are kept,
+ * even when they make the queue grow.
+ *
+ * \sa SDL_FilterEvents
+ */
+static int events_filterPushes(void *arg)
+{
+    const int expected_pushed = (EVENTS_FILTERED / 2) * EVENTS_PUSHED_PER_FILTER_CALL;
+    const int expected = EVENTS_FILTERED / 2 + expected_pushed;
+    SDL_Event *events;
+    SDL_Event event;
+    int i, result;
+    SDL_bool ordered = SDL_TRUE;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    events = (SDL_Event *)SDL_malloc((expected + 1) * sizeof(*events));
+    if (!SDLTest_AssertCheck(events != NULL, "Check event array allocation")) {
+        return TEST_ABORTED;
+    }
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER + 3;
+    for (i = 0; i < EVENTS_FILTERED; ++i) {
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+
+    SDL_FilterEvents(events_pushWhileFiltering, NULL);
+    SDLTest_AssertPass("Call to SDL_FilterEvents() with a filter that pushes events");
+
+    result = SDL_PeepEvents(events, expected + 1, SDL_PEEKEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == expected, "Check number of events queued, expected: %d, got: %d", expected, result);
+    if (result == expected) {
+        /* The events that stayed come first, then the ones pushed while filtering, in the order they were pushed */
+        for (i = 0; i < EVENTS_FILTERED / 2; ++i) {
+            ordered = ordered && events[i].type == SDL_EVENT_USER + 3 && events[i].user.code == i * 2;
+        }
+        for (i = 0; i < expected_pushed; ++i) {
+            const SDL_Event *pushed = &events[EVENTS_FILTERED / 2 + i];
+            const int source = (i / EVENTS_PUSHED_PER_FILTER_CALL) * 2 + 1;
+            ordered = ordered && pushed->type == SDL_EVENT_USER + 4 &&
+                      pushed->user.code == source * EVENTS_PUSHED_PER_FILTER_CALL + (i % EVENTS_PUSHED_PER_FILTER_CALL);
+        }
+        SDLTest_AssertCheck(ordered, "Check that the queue holds the kept events, then the pushed events, in order");
+    }
+
+    /* The type counts have to agree with what's in the queue for these to work */
+    result = SDL_PeepEvents(events, expected + 1, SDL_GETEVENT, SDL_EVENT_USER + 4, SDL_EVENT_USER + 4);
+    SDLTest_AssertCheck(result == expected_pushed, "Check number of pushed events taken, expected: %d, got: %d", expected_pushed, result);
+    SDL_FlushEvents(SDL_EVENT_USER + 3, SDL_EVENT_USER + 3);
+    SDLTest_AssertCheck(!SDL_HasEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST), "Check that the queue is empty");
+
+    SDL_free(events);
+    return TEST_COMPLETED;
+}
+
+#define EVENTS_PUSH_THREADS 4
+#define EVENTS_PER_PUSH_THREAD 5000
+
+/* Thread that pushes a numbered run of user events */
+static int SDLCALL events_pushThread(void *data)
+{
+    const int thread_index = *(int *)data;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.windowID = thread_index;
+    for (i = 0; i < EVENTS_PER_PUSH_THREAD; ++i) {
+        event.user.code = i;
+        event.common.timestamp = 0;
+        if (SDL_PushEvent(&event) <= 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Push events from several threads while they're being read, and check
+ * that none go missing and each thread's events arrive in order.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ */
+static int events_pushFromThreads(void *arg)
+{
+    SDL_Thread *threads[EVENTS_PUSH_THREADS];
+    int thread_index[EVENTS_PUSH_THREADS];
+    int next_code[EVENTS_PUSH_THREADS];
+    SDL_Event events[64];
+    int i, result, received = 0, status;
+    SDL_bool ordered = SDL_TRUE;
+    const Uint64 deadline = SDL_GetTicks() + 10000;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    for (i = 0; i < EVENTS_PUSH_THREADS; ++i) {
+        thread_index[i] = i;
+        next_code[i] = 0;
+        threads[i] = SDL_CreateThread(events_pushThread, "EventPush", &thread_index[i]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check thread %d creation", i);
+    }
+
+    while (received < EVENTS_PUSH_THREADS * EVENTS_PER_PUSH_THREAD && SDL_GetTicks() < deadline) {
+        result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+        for (i = 0; i < result; ++i) {
+            const Uint32 index = events[i].user.windowID;
+            if (index >= EVENTS_PUSH_THREADS || events[i].user.code != next_code[index]) {
+                ordered = SDL_FALSE;
+            } else {
+                ++next_code[index];
+            }
+        }
+        if (result > 0) {
+            received += result;
+        }
+    }
+
+    for (i = 0; i < EVENTS_PUSH_THREADS; ++i) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], &status);
+            SDLTest_AssertCheck(status == 0, "Check that thread %d pushed all its events", i);
+        }
+    }
+    received += SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+
+    SDLTest_AssertCheck(received == EVENTS_PUSH_THREADS * EVENTS_PER_PUSH_THREAD, "Check number of events received, expected: %d, got: %d", EVENTS_PUSH_THREADS * EVENTS_PER_PUSH_THREAD, received);
+    SDLTest_AssertCheck(ordered, "Check that each thread's events arrived in order");
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
+/* Push a mouse motion event */
+static void events_pushMouseMotion(SDL_WindowID windowID, SDL_MouseID which, float x, float y, float xrel, float yrel)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.windowID = windowID;
+    event.motion.which = which;
+    event.motion.x = x;
+    event.motion.y = y;
+    event.motion.xrel = xrel;
+    event.motion.yrel = yrel;
+    SDL_PushEvent(&event);
+}
+
+/**
+ * Check that motion events are merged as they're queued when SDL_HINT_EVENT_COALESCE_MOTION is set.
+ *
+ * \sa SDL_PushEvent
+ */
+static int events_coalesceMotion(void *arg)
+{
+    SDL_Event events[8];
+    int result;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+    events_pushMouseMotion(1, 1, 10.0f, 10.0f, 1.0f, 2.0f);
+    events_pushMouseMotion(1, 1, 11.0f, 12.0f, 1.0f, 2.0f);
+    events_pushMouseMotion(1, 1, 12.0f, 14.0f, 1.0f, 2.0f);
+    events_pushMouseMotion(1, 2, 50.0f, 50.0f, 5.0f, 5.0f);
+    events_pushMouseMotion(1, 1, 13.0f, 16.0f, 1.0f, 2.0f);
+    events_pushMouseMotion(1, 1, 14.0f, 18.0f, 1.0f, 2.0f);
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION);
+    SDLTest_AssertCheck(result == 3, "Check number of merged events, expected: 3, got: %d", result);
+    if (result == 3) {
+        SDLTest_AssertCheck(events[0].motion.which == 1 && events[0].motion.x == 12.0f && events[0].motion.y == 14.0f,
+                            "Check that the first event has the latest position, got: %g,%g", events[0].motion.x, events[0].motion.y);
+        SDLTest_AssertCheck(events[0].motion.xrel == 3.0f && events[0].motion.yrel == 6.0f,
+                            "Check that the first event has the sum of the relative motion, got: %g,%g", events[0].motion.xrel, events[0].motion.yrel);
+        SDLTest_AssertCheck(events[1].motion.which == 2 && events[1].motion.xrel == 5.0f, "Check that motion from another mouse isn't merged");
+        SDLTest_AssertCheck(events[2].motion.which == 1 && events[2].motion.x == 14.0f && events[2].motion.xrel == 2.0f && events[2].motion.yrel == 4.0f,
+                            "Check that only consecutive events are merged");
+    }
+
+    SDL_ResetHint(SDL_HINT_EVENT_COALESCE_MOTION);
+    events_pushMouseMotion(1, 1, 10.0f, 10.0f, 1.0f, 2.0f);
+    events_pushMouseMotion(1, 1, 11.0f, 12.0f, 1.0f, 2.0f);
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION);
+    SDLTest_AssertCheck(result == 2, "Check that events aren't merged by default, expected: 2, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that SDL_PollEventBatch() returns events from the chosen categories, grouped by type.
+ *
+ * \sa SDL_PollEventBatch
+ */
+static int events_pollBatch(void *arg)
+{
+    SDL_Event events[16];
+    SDL_Event event;
+    int i, result;
+    SDL_bool ordered;
+
+    /* Start from an empty queue, without a poll sentinel pending */
+    while (SDL_PollEvent(&event)) {
+    }
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Alternate key, mouse and user events */
+    SDL_zero(event);
+    for (i = 0; i < 9; ++i) {
+        switch (i % 3) {
+        case 0:
+            event.type = SDL_EVENT_KEY_DOWN;
+            event.key.windowID = i;
+            break;
+        case 1:
+            event.type = SDL_EVENT_MOUSE_WHEEL;
+            event.wheel.which = i;
+            break;
+        default:
+            event.type = SDL_EVENT_USER;
+            event.user.code = i;
+            break;
+        }
+        SDL_PushEvent(&event);
+    }
+
+    result = SDL_PollEventBatch(events, SDL_arraysize(events), SDL_EVENTCATEGORY_INPUT, SDL_TRUE);
+    SDLTest_AssertPass("Call to SDL_PollEventBatch(SDL_EVENTCATEGORY_INPUT)");
+    SDLTest_AssertCheck(result == 6, "Check number of input events, expected: 6, got: %d", result);
+    if (result == 6) {
+        ordered = SDL_TRUE;
+        for (i = 0; i < 3; ++i) {
+            ordered = ordered && events[i].type == SDL_EVENT_KEY_DOWN && events[i].key.windowID == (SDL_WindowID)(i * 3);
+            ordered = ordered && events[3 + i].type == SDL_EVENT_MOUSE_WHEEL && events[3 + i].wheel.which == (SDL_MouseID)(i * 3 + 1);
+        }
+        SDLTest_AssertCheck(ordered, "Check that the events are grouped by type and in queue order within each type");
+    }
+    SDLTest_AssertCheck(SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_USER, SDL_EVENT_USER) == 3, "Check that the user events are still queued");
+
+    result = SDL_PollEventBatch(events, 2, SDL_EVENTCATEGORY_ALL, SDL_FALSE);
+    SDLTest_AssertCheck(result == 2, "Check number of events with a short array, expected: 2, got: %d", result);
+    SDLTest_AssertCheck(result == 2 && events[0].user.code == 2 && events[1].user.code == 5, "Check that the first user events were returned in order");
+    result = SDL_PollEventBatch(events, SDL_arraysize(events), SDL_EVENTCATEGORY_ALL, SDL_FALSE);
+    SDLTest_AssertCheck(result == 1 && events[0].user.code == 8, "Check that the last user event was returned, got %d events", result);
+
+    /* Render events come after the pen events, but they aren't input */
+    SDL_zero(event);
+    event.type = SDL_EVENT_RENDER_TARGETS_RESET;
+    SDL_PushEvent(&event);
+    event.type = SDL_EVENT_RENDER_DEVICE_RESET;
+    SDL_PushEvent(&event);
+    result = SDL_PollEventBatch(events, SDL_arraysize(events), SDL_EVENTCATEGORY_INPUT, SDL_FALSE);
+    SDLTest_AssertCheck(result == 0, "Check that render events aren't input events, got %d events", result);
+    result = SDL_PollEventBatch(events, SDL_arraysize(events), SDL_EVENTCATEGORY_APPLICATION, SDL_FALSE);
+    SDLTest_AssertCheck(result == 2 && events[0].type == SDL_EVENT_RENDER_TARGETS_RESET && events[1].type == SDL_EVENT_RENDER_DEVICE_RESET,
+                        "Check that render events are application events, got %d events", result);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that memory from SDL_AllocateEventMemory() stays valid until its event has been handled.
+ *
+ * \sa SDL_AllocateEventMemory
+ */
+static int events_eventMemory(void *arg)
+{
+    const size_t sizes[] = { 0, 1, 13, 100, 3000, 5000, 64, 20000, 7 };
+    SDL_Event event;
+    int i, received = 0;
+    SDL_bool intact = SDL_TRUE, aligned = SDL_TRUE;
+
+    while (SDL_PollEvent(&event)) {
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(sizes); ++i) {
+        Uint8 *memory = (Uint8 *)SDL_AllocateEventMemory(sizes[i]);
+        SDLTest_AssertCheck(memory != NULL, "Check SDL_AllocateEventMemory(%u) result", (unsigned int)sizes[i]);
+        if (memory == NULL) {
+            return TEST_ABORTED;
+        }
+        aligned = aligned && (((uintptr_t)memory % sizeof(void *)) == 0);
+        SDL_memset(memory, i, sizes[i]);
+
+        SDL_zero(event);
+        event.type = SDL_EVENT_USER;
+        event.user.code = i;
+        event.user.data1 = memory;
+        SDL_PushEvent(&event);
+    }
+    SDLTest_AssertCheck(aligned, "Check that event memory is aligned");
+
+    while (SDL_PollEvent(&event)) {
+        if (event.type == SDL_EVENT_USER) {
+            const Uint8 *memory = (const Uint8 *)event.user.data1;
+            size_t j;
+            for (j = 0; j < sizes[event.user.code]; ++j) {
+                if (memory[j] != (Uint8)event.user.code) {
+                    intact = SDL_FALSE;
+                    break;
+                }
+            }
+            ++received;
+        }
+    }
+    SDLTest_AssertCheck(received == (int)SDL_arraysize(sizes), "Check number of events received, expected: %d, got: %d", (int)SDL_arraysize(sizes), received);
+    SDLTest_AssertCheck(intact, "Check that event memory was intact when its event was received");
+
+    return TEST_COMPLETED;
+}
+
+/* Properties with the event latency histogram */
+static const char *g_latencyProps[] = {
+    "SDL.events.latency_under_250us", "SDL.events.latency_under_1ms", "SDL.events.latency_under_4ms",
+    "SDL.events.latency_under_16ms", "SDL.events.latency_under_64ms", "SDL.events.latency_over_64ms"
+};
+
+/**
+ * Check the counters reported by SDL_GetEventQueueProperties().
+ *
+ * \sa SDL_GetEventQueueProperties
+ */
+static int events_queueProperties(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_Event event;
+    Sint64 pushed, pushed_user, dropped, latency, pumps;
+    char name[64];
+    int i, result;
+
+    while (SDL_PollEvent(&event)) {
+    }
+
+    props = SDL_GetEventQueueProperties();
+    SDLTest_AssertCheck(props != 0, "Check SDL_GetEventQueueProperties() result");
+    pushed = SDL_GetNumberProperty(props, "SDL.events.pushed", -1);
+    (void)SDL_snprintf(name, sizeof(name), "SDL.events.pushed.%d", SDL_EVENT_USER);
+    pushed_user = SDL_GetNumberProperty(props, name, 0);
+    dropped = SDL_GetNumberProperty(props, "SDL.events.dropped", -1);
+    pumps = SDL_GetNumberProperty(props, "SDL.events.pumps", -1);
+    SDLTest_AssertCheck(pushed >= 0 && dropped >= 0 && pumps > 0, "Check that the counters are present");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.events.queued", -1) == 0, "Check that the queue is empty");
+
+    latency = 0;
+    for (i = 0; i < (int)SDL_arraysize(g_latencyProps); ++i) {
+        latency -= SDL_GetNumberProperty(props, g_latencyProps[i], 0);
+    }
+
+    /* Push and receive some events */
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    for (i = 0; i < 10; ++i) {
+        event.common.timestamp = 0;
+        SDL_PushEvent(&event);
+    }
+    result = 0;
+    while (SDL_PollEvent(&event)) {
+        ++result;
+    }
+    SDLTest_AssertCheck(result >= 10, "Check number of events received, expected: >= 10, got: %d", result);
+
+    /* Fill the queue until it overflows */
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    for (i = 0; i < 70000; ++i) {
+        if (SDL_PushEvent(&event) < 0) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i < 70000, "Check that the event queue filled up after %d events", i);
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    props = SDL_GetEventQueueProperties();
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.events.pushed", -1) >= pushed + 10 + i, "Check that pushed events were counted");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, name, 0) >= pushed_user + 10 + i, "Check that pushed user events were counted");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.events.dropped", -1) == dropped + 1, "Check that the dropped event was counted");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.events.max_queued", -1) == 65535, "Check the most events queued, got: %d", (int)SDL_GetNumberProperty(props, "SDL.events.max_queued", -1));
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, "SDL.events.pumps", -1) > pumps, "Check that pumping events was counted");
+    for (i = 0; i < (int)SDL_arraysize(g_latencyProps); ++i) {
+        latency += SDL_GetNumberProperty(props, g_latencyProps[i], 0);
+    }
+    SDLTest_AssertCheck(latency >= 10, "Check that the latency of received events was counted, got: %d", (int)latency);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -190,9 +681,37 @@ static const SDLTest_TestCaseReference eventsTest3 = {
     (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest4 = {
+    (SDLTest_TestCaseFp)events_queueOrder, "events_queueOrder", "Checks the order of queued events as they are added and removed", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest5 = {
+    (SDLTest_TestCaseFp)events_pushFromThreads, "events_pushFromThreads", "Pushes events from several threads while reading them", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest6 = {
+    (SDLTest_TestCaseFp)events_coalesceMotion, "events_coalesceMotion", "Checks that motion events are merged when requested", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest7 = {
+    (SDLTest_TestCaseFp)events_pollBatch, "events_pollBatch", "Polls events by category with SDL_PollEventBatch()", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest8 = {
+    (SDLTest_TestCaseFp)events_eventMemory, "events_eventMemory", "Checks memory allocated for events", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest9 = {
+    (SDLTest_TestCaseFp)events_queueProperties, "events_queueProperties", "Checks the event queue statistics", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest10 = {
+    (SDLTest_TestCaseFp)events_filterPushes, "events_filterPushes", "Checks that events pushed by a filter are kept", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, &eventsTest6, &eventsTest7, &eventsTest8, &eventsTest9, &eventsTest10, NULL
 };
 
 /* Events test suite (global) */
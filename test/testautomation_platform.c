@@ -520,6 +520,63 @@ static int platform_testGetPowerInfo(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests SDL_GetCPUTopology and SDL_SetThreadAffinity
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_SetThreadAffinity
+ */
+static int platform_testCPUTopology(void *arg)
+{
+    SDL_CPUInfo *info;
+    int count = 0;
+    int i, result;
+    SDL_bool pinned = SDL_FALSE;
+
+    info = SDL_GetCPUTopology(&count);
+    SDLTest_AssertPass("SDL_GetCPUTopology()");
+    SDLTest_AssertCheck(info != NULL, "SDL_GetCPUTopology() != NULL");
+    if (!info) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(count > 0, "SDL_GetCPUTopology(): expected count > 0, was: %i", count);
+
+    for (i = 0; i < count; ++i) {
+        SDLTest_AssertCheck(i == 0 || info[i].cpu > info[i - 1].cpu,
+                            "CPU %i is listed in order", info[i].cpu);
+        SDLTest_AssertCheck(info[i].core >= 0 && info[i].core <= info[i].cpu,
+                            "CPU %i: expected core in [0,%i], was: %i", info[i].cpu, info[i].cpu, info[i].core);
+        SDLTest_AssertCheck(info[i].l2_group <= info[i].cpu,
+                            "CPU %i: expected L2 group <= %i, was: %i", info[i].cpu, info[i].cpu, info[i].l2_group);
+        SDLTest_AssertCheck(info[i].l3_group <= info[i].cpu,
+                            "CPU %i: expected L3 group <= %i, was: %i", info[i].cpu, info[i].cpu, info[i].l3_group);
+        SDLTest_AssertCheck(info[i].type == SDL_CPU_CORE_UNKNOWN ||
+                                info[i].type == SDL_CPU_CORE_PERFORMANCE ||
+                                info[i].type == SDL_CPU_CORE_EFFICIENCY,
+                            "CPU %i: core type %i is one of the expected values", info[i].cpu, (int)info[i].type);
+    }
+
+    result = SDL_SetThreadAffinity(NULL, -1);
+    SDLTest_AssertCheck(result < 0, "SDL_SetThreadAffinity(NULL, -1) fails, returned: %i", result);
+
+    /* Some CPUs may be off limits to this process, but not all of them */
+    for (i = 0; i < count && !pinned; ++i) {
+        result = SDL_SetThreadAffinity(&info[i].cpu, 1);
+        if (result == 0) {
+            pinned = SDL_TRUE;
+        }
+    }
+    SDLTest_AssertPass("SDL_SetThreadAffinity() on each CPU");
+    if (pinned) {
+        result = SDL_SetThreadAffinity(NULL, 0);
+        SDLTest_AssertCheck(result == 0, "SDL_SetThreadAffinity(NULL, 0) resets affinity, returned: %i", result);
+    } else {
+        SDLTest_Log("SDL_SetThreadAffinity() isn't available: %s", SDL_GetError());
+    }
+
+    SDL_free(info);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Platform test cases */
@@ -567,6 +624,10 @@ static const SDLTest_TestCaseReference platformTest11 = {
     (SDLTest_TestCaseFp)platform_testGetPowerInfo, "platform_testGetPowerInfo", "Tests SDL_GetPowerInfo function", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference platformTest12 = {
+    (SDLTest_TestCaseFp)platform_testCPUTopology, "platform_testCPUTopology", "Tests SDL_GetCPUTopology and SDL_SetThreadAffinity", TEST_ENABLED
+};
+
 /* Sequence of Platform test cases */
 static const SDLTest_TestCaseReference *platformTests[] = {
     &platformTest1,
@@ -580,6 +641,7 @@ static const SDLTest_TestCaseReference *platformTests[] = {
     &platformTest9,
     &platformTest10,
     &platformTest11,
+    &platformTest12,
     NULL
 };
 
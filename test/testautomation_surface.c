@@ -781,6 +781,55 @@ static int surface_testOverflow(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that blits show up in a saved trace while tracing is enabled
+ */
+static int surface_testTrace(void *arg)
+{
+    static char buf[64 * 1024];
+    SDL_RWops *rw;
+    Sint64 size;
+    int ret;
+
+    SDL_SetHint(SDL_HINT_TRACE, "1");
+    ret = SDL_BlitSurface(referenceSurface, NULL, testSurface, NULL);
+    SDLTest_AssertPass("Call to SDL_BlitSurface()");
+    SDLTest_AssertCheck(ret == 0, "Verify result from blitting, expected: 0, got: %i", ret);
+    SDL_SetHint(SDL_HINT_TRACE, "0");
+
+    /* Disabling tracing keeps what was already recorded */
+    SDL_memset(buf, '\0', sizeof(buf));
+    rw = SDL_RWFromMem(buf, sizeof(buf) - 1);
+    SDLTest_AssertCheck(rw != NULL, "Verify result from SDL_RWFromMem is not NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    ret = SDL_SaveTrace_RW(rw, SDL_FALSE);
+    SDLTest_AssertPass("Call to SDL_SaveTrace_RW()");
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveTrace_RW, expected: 0, got: %i", ret);
+    size = SDL_RWtell(rw);
+    SDL_RWclose(rw);
+
+    SDLTest_AssertCheck(size > 0, "Verify trace is not empty, got %" SDL_PRIs64 " bytes", size);
+    SDLTest_AssertCheck(SDL_strstr(buf, "\"traceEvents\":[") != NULL, "Verify trace has a list of events");
+    SDLTest_AssertCheck(SDL_strstr(buf, "\"name\":\"SDL_BlitSurface\"") != NULL, "Verify trace contains the blit");
+
+    /* A new trace starts empty */
+    SDL_SetHint(SDL_HINT_TRACE, "1");
+    SDL_SetHint(SDL_HINT_TRACE, "0");
+    SDL_memset(buf, '\0', sizeof(buf));
+    rw = SDL_RWFromMem(buf, sizeof(buf) - 1);
+    ret = SDL_SaveTrace_RW(rw, SDL_TRUE);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveTrace_RW, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(SDL_strstr(buf, "\"name\":\"SDL_BlitSurface\"") == NULL, "Verify restarted trace doesn't contain the earlier blit");
+
+    ret = SDL_SaveTrace_RW(NULL, SDL_FALSE);
+    SDLTest_AssertCheck(ret == -1, "Verify SDL_SaveTrace_RW(NULL) fails, got: %i", ret);
+
+    SDL_ResetHint(SDL_HINT_TRACE);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -839,11 +888,15 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestTrace = {
+    surface_testTrace, "surface_testTrace", "Tests saving a trace of blits.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestTrace, NULL
 };
 
 /* Surface test suite (global) */
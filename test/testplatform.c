@@ -386,6 +386,24 @@ static int Test64Bit(SDL_bool verbose)
     return failed ? 1 : 0;
 }
 
+static void TestCPUTopology(void)
+{
+    static const char *types[] = { "unknown", "performance", "efficiency" };
+    SDL_CPUInfo *info;
+    int count, i;
+
+    info = SDL_GetCPUTopology(&count);
+    if (!info) {
+        SDL_Log("CPU topology unavailable: %s\n", SDL_GetError());
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        SDL_Log("CPU %d: core %d, package %d, L2 group %d, L3 group %d, %s core\n",
+                info[i].cpu, info[i].core, info[i].package, info[i].l2_group, info[i].l3_group, types[info[i].type]);
+    }
+    SDL_free(info);
+}
+
 static int TestCPUInfo(SDL_bool verbose)
 {
     if (verbose) {
@@ -406,6 +424,7 @@ static int TestCPUInfo(SDL_bool verbose)
         SDL_Log("LSX %s\n", SDL_HasLSX() ? "detected" : "not detected");
         SDL_Log("LASX %s\n", SDL_HasLASX() ? "detected" : "not detected");
         SDL_Log("System RAM %d MB\n", SDL_GetSystemRAM());
+        TestCPUTopology();
     }
     return 0;
 }
@@ -14,11 +14,246 @@
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_test.h>
 
+/* Hack to avoid dynapi renaming */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+/* Build a private copy of the resampler, so we can pick which implementation runs and call it directly. */
+/* Renaming its functions avoids link-time symbol clashes with SDL's own copy. */
+#define SDL_SetupAudioResampler          SDL_SUT_SetupAudioResampler
+#define SDL_GetResampleRate              SDL_SUT_GetResampleRate
+#define SDL_GetResamplerHistoryFrames    SDL_SUT_GetResamplerHistoryFrames
+#define SDL_GetResamplerMaxHistoryFrames SDL_SUT_GetResamplerMaxHistoryFrames
+#define SDL_GetResamplerPaddingFrames    SDL_SUT_GetResamplerPaddingFrames
+#define SDL_GetResamplerInputFrames      SDL_SUT_GetResamplerInputFrames
+#define SDL_GetResamplerOutputFrames     SDL_SUT_GetResamplerOutputFrames
+#define SDL_ResampleAudio                SDL_SUT_ResampleAudio
+
+#include "../src/SDL_internal.h"
+#include "../src/audio/SDL_audioresample.c"
+
 static void log_usage(char *progname, SDLTest_CommonState *state) {
-    static const char *options[] = { "in.wav", "out.wav", "newfreq", "newchan", NULL };
+    static const char *options[] = { "in.wav", "out.wav", "newfreq", "newchan", "| --benchmark | --compare", NULL };
     SDLTest_CommonLogUsage(state, progname, options);
 }
 
+typedef struct
+{
+    const char *name;
+    ResampleAudioFunc resample;
+} ResamplerImpl;
+
+/* Fills `impls` with every implementation of the default resampler this CPU can run, scalar first. */
+static int get_resamplers(ResamplerImpl *impls)
+{
+    int count = 0;
+
+    impls[count].name = "scalar";
+    impls[count].resample = ResampleAudio_Scalar;
+    count++;
+
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        impls[count].name = "NEON";
+        impls[count].resample = ResampleAudio_NEON;
+        count++;
+    }
+#endif
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        impls[count].name = "SSE";
+        impls[count].resample = ResampleAudio_SSE;
+        count++;
+    }
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        impls[count].name = "AVX2";
+        impls[count].resample = ResampleAudio_AVX2;
+        count++;
+    }
+#endif
+
+    return count;
+}
+
+static void use_resampler(const ResamplerImpl *impl)
+{
+    ResamplerQualityLevels[SDL_AUDIO_RESAMPLER_SINC_HIGH].resample = impl->resample;
+}
+
+static const struct
+{
+    int src_freq;
+    int dst_freq;
+} rates[] = {
+    { 48000, 44100 },
+    { 44100, 48000 },
+    { 24000, 48000 },
+    { 96000, 48000 },
+};
+
+#define MAX_CHANNELS 8
+
+/* Enough input for `block_frames` of output at the steepest rate above, plus padding on both sides. */
+static float *create_noise(int block_frames, int *padding_frames)
+{
+    const int padding = SDL_GetResamplerMaxHistoryFrames();
+    const int total = ((block_frames * 2) + 2 + (padding * 2)) * MAX_CHANNELS;
+    float *buf = (float *)SDL_malloc(total * sizeof(float));
+    int i;
+
+    if (buf) {
+        for (i = 0; i < total; i++) {
+            buf[i] = (float)((i * 7919) % 2001 - 1000) / 1000.0f;
+        }
+    }
+    *padding_frames = padding;
+    return buf;
+}
+
+/* Resamples a few seconds of noise with each implementation, for some common layouts and rates, and reports the throughput. */
+/* Only the resampler itself is timed, not the rest of the audio stream's conversion path. */
+static int run_benchmark(void)
+{
+    static const int channel_counts[] = { 1, 2, 6, 8 };
+    const int seconds = 4;
+    const int block_frames = 4096;
+    ResamplerImpl impls[4];
+    int num_impls;
+    float *src_buf;
+    float *dst_buf;
+    int padding;
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    int i, j, k;
+
+    src_buf = create_noise(block_frames, &padding);
+    dst_buf = (float *)SDL_malloc(block_frames * MAX_CHANNELS * sizeof(float));
+    if (!src_buf || !dst_buf) {
+        SDL_free(src_buf);
+        SDL_free(dst_buf);
+        return -1;
+    }
+
+    num_impls = get_resamplers(impls);
+
+    for (k = 0; k < num_impls; k++) {
+        use_resampler(&impls[k]);
+        SDL_Log("Resampler benchmark, using %s\n", impls[k].name);
+
+        for (i = 0; i < SDL_arraysize(rates); i++) {
+            for (j = 0; j < SDL_arraysize(channel_counts); j++) {
+                const int channels = channel_counts[j];
+                const int total_frames = rates[i].dst_freq * seconds;
+                const Sint64 resample_rate = SDL_GetResampleRate(rates[i].src_freq, rates[i].dst_freq);
+                Sint64 resample_offset = 0;
+                Uint64 elapsed = 0;
+                int frames_out;
+
+                for (frames_out = 0; frames_out < total_frames; frames_out += block_frames) {
+                    const int inframes = (int)SDL_GetResamplerInputFrames(block_frames, resample_rate, resample_offset);
+                    const Uint64 start = SDL_GetPerformanceCounter();
+                    SDL_ResampleAudio(channels, src_buf + padding * channels, inframes, dst_buf, block_frames,
+                                      resample_rate, &resample_offset, SDL_AUDIO_RESAMPLER_SINC_HIGH);
+                    elapsed += SDL_GetPerformanceCounter() - start;
+                }
+
+                SDL_Log("%6d -> %6d Hz, %d channel(s): %10.0f frames/sec (%.1fx realtime)\n",
+                        rates[i].src_freq, rates[i].dst_freq, channels,
+                        (double)frames_out * freq / (elapsed ? elapsed : 1),
+                        ((double)frames_out / rates[i].dst_freq) / ((double)(elapsed ? elapsed : 1) / freq));
+            }
+        }
+    }
+
+    SDL_free(src_buf);
+    SDL_free(dst_buf);
+    return 0;
+}
+
+/* Checks every SIMD implementation against the scalar one, for each rate and channel count, from a few starting offsets. */
+static int run_compare(void)
+{
+    static const Sint64 offsets[] = { 0, 0x2AAAAAAB, -0x80000000LL };
+    const int block_frames = 1021;
+    const float tolerance = 1e-5f;
+    ResamplerImpl impls[4];
+    int num_impls;
+    float *src_buf;
+    float *expected;
+    float *actual;
+    int padding;
+    int failures = 0;
+    int i, j, k, n;
+
+    src_buf = create_noise(block_frames, &padding);
+    expected = (float *)SDL_malloc(block_frames * MAX_CHANNELS * sizeof(float));
+    actual = (float *)SDL_malloc(block_frames * MAX_CHANNELS * sizeof(float));
+    if (!src_buf || !expected || !actual) {
+        SDL_free(src_buf);
+        SDL_free(expected);
+        SDL_free(actual);
+        return -1;
+    }
+
+    num_impls = get_resamplers(impls);
+    if (num_impls == 1) {
+        SDL_Log("No SIMD resamplers available, nothing to compare\n");
+    }
+
+    for (k = 1; k < num_impls; k++) {
+        float max_error = 0.0f;
+
+        for (i = 0; i < SDL_arraysize(rates); i++) {
+            const Sint64 resample_rate = SDL_GetResampleRate(rates[i].src_freq, rates[i].dst_freq);
+
+            for (j = 0; j < SDL_arraysize(offsets); j++) {
+                int channels;
+
+                for (channels = 1; channels <= MAX_CHANNELS; channels++) {
+                    const float *src = src_buf + padding * channels;
+                    const int inframes = (int)SDL_GetResamplerInputFrames(block_frames, resample_rate, offsets[j]);
+                    Sint64 resample_offset;
+                    float error = 0.0f;
+
+                    use_resampler(&impls[0]);
+                    resample_offset = offsets[j];
+                    SDL_ResampleAudio(channels, src, inframes, expected, block_frames, resample_rate, &resample_offset, SDL_AUDIO_RESAMPLER_SINC_HIGH);
+
+                    use_resampler(&impls[k]);
+                    resample_offset = offsets[j];
+                    SDL_ResampleAudio(channels, src, inframes, actual, block_frames, resample_rate, &resample_offset, SDL_AUDIO_RESAMPLER_SINC_HIGH);
+
+                    for (n = 0; n < block_frames * channels; n++) {
+                        error = SDL_max(error, SDL_fabsf(actual[n] - expected[n]));
+                    }
+
+                    if (error > tolerance) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s differs from scalar by %g: %d -> %d Hz, %d channel(s), offset 0x%" SDL_PRIx64 "\n",
+                                     impls[k].name, error, rates[i].src_freq, rates[i].dst_freq, channels, (Uint64)offsets[j]);
+                        failures++;
+                    }
+                    max_error = SDL_max(max_error, error);
+                }
+            }
+        }
+
+        SDL_Log("%s matches scalar to within %g\n", impls[k].name, max_error);
+    }
+
+    use_resampler(&impls[0]);
+
+    SDL_free(src_buf);
+    SDL_free(expected);
+    SDL_free(actual);
+    return failures ? -1 : 0;
+}
+
 int main(int argc, char **argv)
 {
     SDL_AudioSpec spec;
@@ -38,6 +273,8 @@ int main(int argc, char **argv)
     SDLTest_CommonState *state;
     char *file_in = NULL;
     char *file_out = NULL;
+    SDL_bool benchmark = SDL_FALSE;
+    SDL_bool compare = SDL_FALSE;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -56,7 +293,13 @@ int main(int argc, char **argv)
 
         consumed = SDLTest_CommonArg(state, i);
         if (!consumed) {
-            if (argpos == 0) {
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = SDL_TRUE;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--compare") == 0) {
+                compare = SDL_TRUE;
+                consumed = 1;
+            } else if (argpos == 0) {
                 file_in = argv[i];
                 argpos++;
                 consumed = 1;
@@ -89,6 +332,16 @@ int main(int argc, char **argv)
         i += consumed;
     }
 
+    if (benchmark || compare) {
+        SDL_SetupAudioResampler();
+        if (compare && run_compare() < 0) {
+            ret = 8;
+        } else if (benchmark && run_benchmark() < 0) {
+            ret = 7;
+        }
+        goto end;
+    }
+
     if (argpos != 4) {
         log_usage(argv[0], state);
         ret = 1;
@@ -191,6 +191,7 @@ TestOverheadContended(SDL_bool try_wait)
     Uint64 duration;
     Thread_State thread_states[NUM_THREADS] = { { 0 } };
     char textBuffer[1024];
+    SDL_PropertiesID props;
     int loop_count;
     int content_count;
     int i, j;
@@ -249,9 +250,91 @@ TestOverheadContended(SDL_bool try_wait)
     (void)SDL_snprintf(textBuffer + len, sizeof(textBuffer) - len, " }\n");
     SDL_Log("%s\n", textBuffer);
 
+    props = SDL_GetSemaphoreProperties(sem);
+    if (props) {
+        SDL_Log("Semaphore was contended %" SDL_PRIs64 " times, threads slept %" SDL_PRIs64 " times\n\n",
+                SDL_GetNumberProperty(props, "SDL.semaphore.contentions", 0), SDL_GetNumberProperty(props, "SDL.semaphore.sleeps", 0));
+    }
+
     SDL_DestroySemaphore(sem);
 }
 
+static SDL_Mutex *mutex;
+static int mutex_counter;
+
+static int SDLCALL
+ThreadFuncMutexContended(void *data)
+{
+    Thread_State *state = (Thread_State *)data;
+    int i;
+
+    for (i = 0; i < NUM_OVERHEAD_OPS; i++) {
+        SDL_LockMutex(mutex);
+        /* Lock recursively now and then, the count must stay right */
+        if ((i % 16) == 0) {
+            SDL_LockMutex(mutex);
+            ++mutex_counter;
+            SDL_UnlockMutex(mutex);
+        } else {
+            ++mutex_counter;
+        }
+        SDL_UnlockMutex(mutex);
+        ++state->loop_count;
+    }
+    return 0;
+}
+
+static void
+TestMutexContended(SDL_bool priority_inheritance)
+{
+    Uint64 start_ticks;
+    Uint64 end_ticks;
+    Thread_State thread_states[NUM_THREADS] = { { 0 } };
+    SDL_PropertiesID props;
+    int i;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, "SDL.mutex.priority_inheritance", priority_inheritance);
+    mutex = SDL_CreateMutexWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDL_assert_release(mutex != NULL);
+    mutex_counter = 0;
+
+    SDL_Log("Doing %d contended Lock/Unlock operations on %s mutex using %d threads\n",
+            NUM_OVERHEAD_OPS * NUM_THREADS, priority_inheritance ? "a priority inheriting" : "a", NUM_THREADS);
+
+    start_ticks = SDL_GetTicks();
+    for (i = 0; i < NUM_THREADS; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "Thread%u", (unsigned int)i);
+        thread_states[i].thread = SDL_CreateThread(ThreadFuncMutexContended, name, (void *)&thread_states[i]);
+    }
+    for (i = 0; i < NUM_THREADS; ++i) {
+        SDL_WaitThread(thread_states[i].thread, NULL);
+    }
+    end_ticks = SDL_GetTicks();
+
+    SDL_assert_release(mutex_counter == NUM_OVERHEAD_OPS * NUM_THREADS);
+
+    SDL_Log("Took %" SDL_PRIu64 " milliseconds\n", end_ticks - start_ticks);
+    props = SDL_GetMutexProperties(mutex);
+    if (props) {
+        SDL_assert_release(SDL_GetNumberProperty(props, "SDL.mutex.locks", 0) == NUM_OVERHEAD_OPS * NUM_THREADS);
+
+        /* Asking while holding the mutex counts the caller's lock, but not the query's own */
+        SDL_LockMutex(mutex);
+        props = SDL_GetMutexProperties(mutex);
+        SDL_assert_release(SDL_GetNumberProperty(props, "SDL.mutex.locks", 0) == NUM_OVERHEAD_OPS * NUM_THREADS + 1);
+        SDL_UnlockMutex(mutex);
+        SDL_Log("Mutex was contended %" SDL_PRIs64 " times, threads slept %" SDL_PRIs64 " times\n\n",
+                SDL_GetNumberProperty(props, "SDL.mutex.contentions", 0), SDL_GetNumberProperty(props, "SDL.mutex.sleeps", 0));
+    } else {
+        SDL_Log("Mutex counters aren't available: %s\n\n", SDL_GetError());
+    }
+
+    SDL_DestroyMutex(mutex);
+}
+
 int main(int argc, char **argv)
 {
     int arg_count = 0;
@@ -314,6 +397,10 @@ int main(int argc, char **argv)
 
     TestOverheadContended(SDL_TRUE);
 
+    TestMutexContended(SDL_FALSE);
+
+    TestMutexContended(SDL_TRUE);
+
     SDL_Quit();
     SDLTest_CommonDestroyState(state);
 
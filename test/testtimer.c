@@ -63,6 +63,111 @@ callback(Uint32 interval, void *param)
     return interval;
 }
 
+typedef struct
+{
+    Uint64 due;
+    Uint64 fired;
+} StressTimer;
+
+static SDL_AtomicInt stress_fired;
+
+static Uint32 SDLCALL
+stress_callback(Uint32 interval, void *param)
+{
+    StressTimer *timer = (StressTimer *)param;
+    timer->fired = SDL_GetTicksNS();
+    SDL_AtomicIncRef(&stress_fired);
+    return 0;
+}
+
+static int SDLCALL
+compare_latency(const void *a, const void *b)
+{
+    const Uint64 A = *(const Uint64 *)a;
+    const Uint64 B = *(const Uint64 *)b;
+    return (A < B) ? -1 : (A > B) ? 1 : 0;
+}
+
+/* Schedule lots of one-shot timers, cancel some of them, and measure how late the rest fire */
+static int stress_timers(int count)
+{
+    StressTimer *timers = (StressTimer *)SDL_calloc(count, sizeof(*timers));
+    SDL_TimerID *ids = (SDL_TimerID *)SDL_calloc(count, sizeof(*ids));
+    Uint64 *latency = (Uint64 *)SDL_calloc(count, sizeof(*latency));
+    SDLTest_RandomContext rng;
+    Uint64 start, now, total = 0;
+    int i, removed = 0, expected, fired = 0;
+    int return_code = 0;
+
+    if (!timers || !ids || !latency) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_free(timers);
+        SDL_free(ids);
+        SDL_free(latency);
+        return 1;
+    }
+
+    SDLTest_RandomInit(&rng, 0x5D1, 0x7133);
+
+    SDL_Log("Adding %d timers of 1 to 1000 ms\n", count);
+    start = SDL_GetTicksNS();
+    for (i = 0; i < count; ++i) {
+        const Uint32 interval = 1 + (SDLTest_Random(&rng) % 1000);
+        timers[i].due = SDL_GetTicksNS() + SDL_MS_TO_NS(interval);
+        ids[i] = SDL_AddTimer(interval, stress_callback, &timers[i]);
+        if (!ids[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create timer %d: %s\n", i, SDL_GetError());
+            return_code = 1;
+            break;
+        }
+    }
+    count = i;
+    now = SDL_GetTicksNS();
+    SDL_Log("Added %d timers in %f ms\n", count, (double)(now - start) / SDL_NS_PER_MS);
+
+    /* Cancel every fourth timer, if it hasn't fired yet */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < count; i += 4) {
+        if (SDL_RemoveTimer(ids[i])) {
+            ++removed;
+        }
+    }
+    now = SDL_GetTicksNS();
+    SDL_Log("Removed %d timers in %f ms\n", removed, (double)(now - start) / SDL_NS_PER_MS);
+
+    expected = count - removed;
+    start = SDL_GetTicks();
+    while (SDL_AtomicGet(&stress_fired) < expected && (SDL_GetTicks() - start) < 10000) {
+        SDL_Delay(10);
+    }
+    SDL_Delay(100); /* make sure canceled timers don't fire */
+
+    for (i = 0; i < count; ++i) {
+        if (timers[i].fired) {
+            latency[fired] = (timers[i].fired > timers[i].due) ? (timers[i].fired - timers[i].due) : 0;
+            total += latency[fired];
+            ++fired;
+        }
+    }
+    if (fired != expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d timers to fire, %d did\n", expected, fired);
+        return_code = 1;
+    }
+    if (fired > 0) {
+        SDL_qsort(latency, fired, sizeof(*latency), compare_latency);
+        SDL_Log("Timer latency: average %f ms, median %f ms, 99th percentile %f ms, max %f ms\n",
+                (double)total / fired / SDL_NS_PER_MS,
+                (double)latency[fired / 2] / SDL_NS_PER_MS,
+                (double)latency[(fired * 99) / 100] / SDL_NS_PER_MS,
+                (double)latency[fired - 1] / SDL_NS_PER_MS);
+    }
+
+    SDL_free(timers);
+    SDL_free(ids);
+    SDL_free(latency);
+    return return_code;
+}
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -72,6 +177,7 @@ int main(int argc, char *argv[])
     Uint64 start_perf, now_perf;
     SDLTest_CommonState  *state;
     SDL_bool run_interactive_tests = SDL_TRUE;
+    int stress = 0;
     int return_code = 0;
 
     /* Initialize test framework */
@@ -92,6 +198,13 @@ int main(int argc, char *argv[])
             if (SDL_strcmp(argv[i], "--no-interactive") == 0) {
                 run_interactive_tests = SDL_FALSE;
                 consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--stress") == 0) {
+                stress = 100000;
+                consumed = 1;
+                if (argv[i + 1] && SDL_isdigit(*argv[i + 1])) {
+                    stress = SDL_atoi(argv[i + 1]);
+                    consumed = 2;
+                }
             } else if (desired < 0) {
                 char *endptr;
 
@@ -102,7 +215,7 @@ int main(int argc, char *argv[])
             }
         }
         if (consumed <= 0) {
-            static const char *options[] = { "[--no-interactive]", "[interval]", NULL };
+            static const char *options[] = { "[--no-interactive]", "[--stress [count]]", "[interval]", NULL };
             SDLTest_CommonLogUsage(state, argv[0], options);
             return 1;
         }
@@ -115,6 +228,13 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (stress > 0) {
+        return_code = stress_timers(stress);
+        SDLTest_CommonDestroyState(state);
+        SDL_Quit();
+        return return_code;
+    }
+
     if (SDL_getenv("SDL_TESTS_QUICK") != NULL) {
         SDL_Log("Not running slower tests");
         SDL_Quit();
@@ -0,0 +1,199 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast SDL_LoadWAV_RW decodes large synthetic files of each encoding. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    const char *name;
+    Uint16 formattag;
+    Uint16 channels;
+    Uint16 bitspersample;
+    Uint16 blockalign;
+    Uint16 samplesperblock; /* Only for ADPCM. */
+} WaveEncoding;
+
+static const WaveEncoding encodings[] = {
+    { "PCM 16-bit stereo", 0x0001, 2, 16, 4, 0 },
+    { "PCM 24-bit stereo", 0x0001, 2, 24, 6, 0 },
+    { "A-law stereo", 0x0006, 2, 8, 2, 0 },
+    { "mu-law stereo", 0x0007, 2, 8, 2, 0 },
+    { "MS ADPCM mono", 0x0002, 1, 4, 256, 500 },
+    { "MS ADPCM stereo", 0x0002, 2, 4, 512, 500 },
+    { "IMA ADPCM mono", 0x0011, 1, 4, 256, 505 },
+    { "IMA ADPCM stereo", 0x0011, 2, 4, 512, 505 },
+};
+
+static const Sint16 ms_adpcm_coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+
+static Uint8 *put_le(Uint8 *ptr, Uint32 value, int bytes)
+{
+    int i;
+    for (i = 0; i < bytes; ++i) {
+        *(ptr++) = (Uint8)(value >> (i * 8));
+    }
+    return ptr;
+}
+
+/* Builds a WAVE file of roughly datalen bytes of noise in the given encoding. */
+static Uint8 *build_wave(const WaveEncoding *enc, Uint32 datalen, SDLTest_RandomContext *rndctx, size_t *wave_len)
+{
+    const Uint32 fmtlen = (enc->formattag == 0x0002) ? 50 : (enc->formattag == 0x0011) ? 20 : 16;
+    Uint8 *wave, *ptr, *data;
+    Uint32 i, c;
+
+    datalen -= datalen % enc->blockalign;
+    wave = (Uint8 *)SDL_malloc(datalen + fmtlen + 28);
+    if (!wave) {
+        return NULL;
+    }
+
+    ptr = put_le(wave, 0x46464952, 4); /* RIFF */
+    ptr = put_le(ptr, 4 + 8 + fmtlen + 8 + datalen, 4);
+    ptr = put_le(ptr, 0x45564157, 4); /* WAVE */
+    ptr = put_le(ptr, 0x20746D66, 4); /* fmt  */
+    ptr = put_le(ptr, fmtlen, 4);
+    ptr = put_le(ptr, enc->formattag, 2);
+    ptr = put_le(ptr, enc->channels, 2);
+    ptr = put_le(ptr, 44100, 4);
+    ptr = put_le(ptr, 44100 * enc->blockalign, 4);
+    ptr = put_le(ptr, enc->blockalign, 2);
+    ptr = put_le(ptr, enc->bitspersample, 2);
+    if (enc->formattag == 0x0002) {
+        ptr = put_le(ptr, 32, 2);
+        ptr = put_le(ptr, enc->samplesperblock, 2);
+        ptr = put_le(ptr, 7, 2);
+        for (i = 0; i < SDL_arraysize(ms_adpcm_coeffs); ++i) {
+            ptr = put_le(ptr, (Uint16)ms_adpcm_coeffs[i], 2);
+        }
+    } else if (enc->formattag == 0x0011) {
+        ptr = put_le(ptr, 2, 2);
+        ptr = put_le(ptr, enc->samplesperblock, 2);
+    }
+    ptr = put_le(ptr, 0x61746164, 4); /* data */
+    ptr = put_le(ptr, datalen, 4);
+
+    data = ptr;
+    for (i = 0; i < datalen; ++i) {
+        data[i] = (Uint8)SDLTest_Random(rndctx);
+    }
+
+    /* Give every ADPCM block a valid header. */
+    for (i = 0; enc->samplesperblock && i < datalen; i += enc->blockalign) {
+        Uint8 *block = data + i;
+        for (c = 0; c < enc->channels; ++c) {
+            if (enc->formattag == 0x0002) {
+                block[c] = (Uint8)(SDLTest_Random(rndctx) % 7);
+                put_le(block + enc->channels + c * 2, 16 + SDLTest_Random(rndctx) % 512, 2);
+            } else {
+                block[c * 4 + 2] = (Uint8)(SDLTest_Random(rndctx) % 89);
+                block[c * 4 + 3] = 0;
+            }
+        }
+    }
+
+    *wave_len = (size_t)(data - wave) + datalen;
+    return wave;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDLTest_RandomContext rndctx;
+    int megabytes = 16;
+    int iterations = 3;
+    int i, j;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--megabytes") == 0 && argv[i + 1]) {
+                megabytes = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || megabytes <= 0 || megabytes > 1024 || iterations <= 0) {
+            static const char *options[] = { "[--megabytes N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    SDLTest_RandomInit(&rndctx, 0x5D1, 0x3A7E);
+
+    SDL_Log("Decoding %d MB of each encoding, best of %d runs\n", megabytes, iterations);
+
+    for (i = 0; i < SDL_arraysize(encodings); ++i) {
+        const WaveEncoding *enc = &encodings[i];
+        size_t wave_len = 0;
+        Uint8 *wave = build_wave(enc, (Uint32)megabytes * 1024 * 1024, &rndctx, &wave_len);
+        Uint64 best = 0;
+        Uint32 decoded_len = 0;
+
+        if (!wave) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+            SDLTest_CommonDestroyState(state);
+            return 1;
+        }
+
+        for (j = 0; j < iterations; ++j) {
+            SDL_AudioSpec spec;
+            Uint8 *audio_buf = NULL;
+            const Uint64 start = SDL_GetPerformanceCounter();
+            const int result = SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, wave_len), SDL_TRUE, &spec, &audio_buf, &decoded_len);
+            const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+
+            if (result < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: SDL_LoadWAV_RW failed: %s\n", enc->name, SDL_GetError());
+                SDL_free(wave);
+                SDLTest_CommonDestroyState(state);
+                return 1;
+            }
+            SDL_free(audio_buf);
+
+            if (j == 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+
+        {
+            const double seconds = (double)best / (double)SDL_GetPerformanceFrequency();
+            const double mb = 1024.0 * 1024.0;
+            SDL_Log("%-18s %8.2f ms  %8.1f MB/s in  %8.1f MB/s out\n", enc->name, seconds * 1000.0,
+                    seconds > 0.0 ? (double)wave_len / mb / seconds : 0.0,
+                    seconds > 0.0 ? (double)decoded_len / mb / seconds : 0.0);
+        }
+
+        SDL_free(wave);
+    }
+
+    SDLTest_CommonDestroyState(state);
+    return 0;
+}
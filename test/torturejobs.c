@@ -0,0 +1,280 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Stress test of the SDL job pool */
+
+#include <stdlib.h>
+#include <signal.h>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUMROUNDS    20
+#define NUMSUBMITS   4
+#define TREEDEPTH    6
+#define TREEWIDTH    4
+#define NUMELEMENTS  100000
+#define NUMSUMS      8
+
+static SDL_JobPool *pool;
+static SDL_AtomicInt jobs_run;
+static SDL_AtomicInt leaves_run;
+static SDL_AtomicInt submit_failures;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    if (pool) {
+        SDL_DestroyJobPool(pool);
+    }
+    SDL_Quit();
+    /* Let 'main()' return normally */
+    if (rc != 0) {
+        exit(rc);
+    }
+}
+
+/* Each job submits TREEWIDTH children into its own group and waits for them,
+   so workers end up waiting inside jobs and have to keep the pool moving. */
+static void SDLCALL
+TreeJob(void *data)
+{
+    int depth = (int)(uintptr_t)data;
+    SDL_JobGroup *group;
+    int i;
+
+    SDL_AtomicIncRef(&jobs_run);
+    if (depth == 0) {
+        SDL_AtomicIncRef(&leaves_run);
+        return;
+    }
+
+    group = SDL_CreateJobGroup(pool);
+    if (!group) {
+        SDL_AtomicIncRef(&submit_failures);
+        return;
+    }
+    for (i = 0; i < TREEWIDTH; i++) {
+        if (SDL_SubmitJob(pool, group, TreeJob, (void *)(uintptr_t)(depth - 1)) < 0) {
+            SDL_AtomicIncRef(&submit_failures);
+        }
+    }
+    SDL_WaitJobGroup(group);
+    SDL_DestroyJobGroup(group);
+}
+
+static void SDLCALL
+SquareRange(void *data, int start, int end)
+{
+    Sint64 *values = (Sint64 *)data;
+    int i;
+
+    for (i = start; i < end; i++) {
+        values[i] = (Sint64)i * i;
+    }
+}
+
+typedef struct
+{
+    const Sint64 *values;
+    int start;
+    int end;
+    Sint64 sum;
+} SumData;
+
+static void SDLCALL
+SumJob(void *data)
+{
+    SumData *sum = (SumData *)data;
+    int i;
+
+    sum->sum = 0;
+    for (i = sum->start; i < sum->end; i++) {
+        sum->sum += sum->values[i];
+    }
+}
+
+static void SDLCALL
+SubmitJob(void *data)
+{
+    SDL_JobGroup *group = (SDL_JobGroup *)data;
+
+    SDL_AtomicIncRef(&jobs_run);
+    if (SDL_SubmitJob(pool, group, TreeJob, (void *)(uintptr_t)0) < 0) {
+        SDL_AtomicIncRef(&submit_failures);
+    }
+}
+
+static int SDLCALL
+SubmitThread(void *data)
+{
+    SDL_JobGroup *group = (SDL_JobGroup *)data;
+    int i;
+
+    /* Submit from outside the pool while the workers are busy */
+    for (i = 0; i < 1000; i++) {
+        if (SDL_SubmitJob(pool, group, SubmitJob, group) < 0) {
+            SDL_AtomicIncRef(&submit_failures);
+        }
+    }
+    return 0;
+}
+
+static int
+RunRound(int round)
+{
+    static Sint64 values[NUMELEMENTS];
+    SumData sums[NUMSUMS];
+    SDL_JobGroup *group;
+    SDL_Thread *threads[NUMSUBMITS];
+    Sint64 expected = 0, total = 0;
+    int expected_jobs = 0, expected_leaves = 1;
+    int i;
+
+    SDL_AtomicSet(&jobs_run, 0);
+    SDL_AtomicSet(&leaves_run, 0);
+
+    /* A tree of nested jobs */
+    group = SDL_CreateJobGroup(pool);
+    if (!group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create job group: %s\n", SDL_GetError());
+        return -1;
+    }
+    if (SDL_SubmitJob(pool, group, TreeJob, (void *)(uintptr_t)TREEDEPTH) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't submit job: %s\n", SDL_GetError());
+        return -1;
+    }
+    SDL_WaitJobGroup(group);
+    for (i = 0; i <= TREEDEPTH; i++) {
+        expected_jobs += expected_leaves;
+        expected_leaves *= TREEWIDTH;
+    }
+    expected_leaves /= TREEWIDTH;
+    if (SDL_AtomicGet(&jobs_run) != expected_jobs || SDL_AtomicGet(&leaves_run) != expected_leaves) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Round %d: ran %d jobs with %d leaves, expected %d with %d\n",
+                     round, SDL_AtomicGet(&jobs_run), SDL_AtomicGet(&leaves_run), expected_jobs, expected_leaves);
+        return -1;
+    }
+
+    /* Jobs submitted from several threads at once, reusing the group */
+    SDL_AtomicSet(&jobs_run, 0);
+    for (i = 0; i < NUMSUBMITS; i++) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "Submit%d", i);
+        threads[i] = SDL_CreateThread(SubmitThread, name, group);
+        if (!threads[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s\n", SDL_GetError());
+            return -1;
+        }
+    }
+    for (i = 0; i < NUMSUBMITS; i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDL_WaitJobGroup(group);
+    if (SDL_AtomicGet(&jobs_run) != NUMSUBMITS * 1000 * 2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Round %d: ran %d submitted jobs, expected %d\n",
+                     round, SDL_AtomicGet(&jobs_run), NUMSUBMITS * 1000 * 2);
+        return -1;
+    }
+
+    /* A parallel loop, checked with a parallel sum */
+    SDL_memset(values, 0, sizeof(values));
+    if (SDL_ParallelFor(pool, 0, NUMELEMENTS, (round % 3) * 1000, SquareRange, values) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run parallel loop: %s\n", SDL_GetError());
+        return -1;
+    }
+    for (i = 0; i < NUMSUMS; i++) {
+        sums[i].values = values;
+        sums[i].start = (NUMELEMENTS * i) / NUMSUMS;
+        sums[i].end = (NUMELEMENTS * (i + 1)) / NUMSUMS;
+        if (SDL_SubmitJob(pool, group, SumJob, &sums[i]) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't submit job: %s\n", SDL_GetError());
+            return -1;
+        }
+    }
+    SDL_DestroyJobGroup(group);
+    for (i = 0; i < NUMSUMS; i++) {
+        total += sums[i].sum;
+    }
+    for (i = 0; i < NUMELEMENTS; i++) {
+        expected += (Sint64)i * i;
+    }
+    if (total != expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Round %d: parallel sum was %" SDL_PRIs64 ", expected %" SDL_PRIs64 "\n",
+                     round, total, expected);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Load the SDL library */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    (void)signal(SIGSEGV, SIG_DFL);
+
+    /* Check that the pool works with both a single worker and a full set */
+    for (i = 0; i < NUMROUNDS; i++) {
+        if (!pool) {
+            pool = SDL_CreateJobPool((i < NUMROUNDS / 2) ? 1 : 0);
+            if (!pool) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create job pool: %s\n", SDL_GetError());
+                quit(1);
+            }
+            SDL_Log("Running with %d worker threads\n", SDL_GetJobPoolThreadCount(pool));
+        }
+
+        if (RunRound(i) < 0) {
+            quit(1);
+        }
+
+        if (i == NUMROUNDS / 2 - 1) {
+            SDL_DestroyJobPool(pool);
+            pool = NULL;
+        }
+    }
+
+    if (SDL_AtomicGet(&submit_failures) > 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d jobs couldn't be submitted\n", SDL_AtomicGet(&submit_failures));
+        quit(1);
+    }
+    SDL_Log("All job rounds passed\n");
+
+    SDL_DestroyJobPool(pool);
+    pool = NULL;
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return 0;
+}